@@ -50,6 +50,7 @@ public:
 		std::cout << "  --project t\n\tLinearly project all aircraft t seconds for computing bands and alerting" << std::endl;
 		std::cout << "  --<var>=<val>\n\t<key> is any configuration variable and val is its value (including units, if any), e.g., --lookahead_time=5[min]" << std::endl;
 		std::cout << "  --precision <n>\n\tOutput decimal precision" << std::endl;
+		std::cout << "  --threads <n>\n\tProcess up to <n> files concurrently (0 for all hardware threads)" << std::endl;
 		std::cout << getHelpString() << std::endl;
 		exit(0);
 	}
@@ -85,16 +86,16 @@ public:
 		}
 	}
 
-	void printOutput(Daidalus& daa) {
+	void printOutput(Daidalus& daa, std::ostream& os) {
 		switch (format) {
 		case STANDARD:
-			(*out) << daa.outputString();
+			os << daa.outputString();
 			if (raw) {
-				(*out) << daa.rawString();
+				os << daa.rawString();
 			}
 			break;
 		case PVS:
-			(*out) << daa.toPVS(false);
+			os << daa.toPVS(false);
 			break;
 		}
 	}
@@ -103,8 +104,26 @@ public:
 	}
 
 	void processTime(Daidalus& daa, const std::string& filename) {
+		processTimeStep(daa,filename,*out);
+	}
+
+	void processTimeStep(Daidalus& daa, const std::string& filename, std::ostream& os) {
 		header(daa,filename);
-		printOutput(daa);
+		printOutput(daa,os);
+	}
+
+	void processFileHeader(Daidalus& daa, const std::string& filename, std::ostream& os) {
+		switch (format) {
+		case STANDARD:
+			os << "# File: "<< filename << std::endl;
+			break;
+		case PVS:
+			os << "%%% File:\n" << filename << std::endl;
+			os << "%%% Parameters:\n" << daa.getCore().parameters.toPVS() << std::endl;
+			break;
+		default:
+			break;
+		}
 	}
 
 };
@@ -117,6 +136,7 @@ int main(int argc, const char* argv[]) {
 	std::string options = "";
 	ParameterData params;
 	int precision = 6;
+	int threads = 1;
 	for (a=1;a < argc && argv[a][0]=='-'; ++a) {
 		std::string arga = argv[a];
 		options += arga + " ";
@@ -148,6 +168,9 @@ int main(int argc, const char* argv[]) {
 			++a;
 			std::istringstream(argv[a]) >> precision;
 			options += arga+" ";
+		} else if (startsWith(arga,"--thread") || startsWith(arga,"-thread")) {
+			++a;
+			std::istringstream(argv[a]) >> threads;
 		} else if (startsWith(arga,"-") && arga.find('=') != std::string::npos) {
 		      std::string keyval = arga.substr(arga.find_last_of('-')+1);
 		      params.set(keyval);
@@ -193,21 +216,7 @@ int main(int argc, const char* argv[]) {
 		(*walker.out) << "%%% Options: " << options << std::endl;
 		break;
 	}
-	for (unsigned int i=0; i < txtFiles.size(); ++i) {
-		std::string filename(txtFiles[i]);
-		switch (walker.format) {
-		case STANDARD:
-			(*walker.out) << "# File: "<< filename << std::endl;
-			break;
-		case PVS:
-			(*walker.out) << "%%% File:\n" << filename << std::endl;
-			(*walker.out) << "%%% Parameters:\n" << daa.getCore().parameters.toPVS() << std::endl;
-			break;
-		default:
-			break;
-		}
-		walker.processFile(filename,daa);
-	}
+	walker.processFiles(txtFiles,daa,*walker.out,threads);
 	if (output != "") {
 		fout.close();
 	}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+/*
+ * Timing of DAIDALUS band computation on synthetic encounters.
+ *
+ * Usage: DaidalusBenchmark [--conf <file>] [--traffic <n>] [--cycles <n>] [--seed <n>] [--daa <lines>] [--sum]
+ *
+ * Every cycle, the ownship and all intruders are moved and alerting, direction,
+ * horizontal speed, vertical speed, and altitude bands are computed from scratch.
+ * With --sum, the same cycles are run again with position and velocity uncertainty
+ * on every aircraft, which exercises the SUM detectors (e.g., WCV_TAUMOD_SUM).
+ * The extraction of the last bands in output units and the reconfiguration of
+ * the object from a parameter database are timed separately. Finally, a .daa
+ * file with the given number of state lines is generated, read with a
+ * DaidalusFileWalker, and walked time step by time step.
+ */
+
+#include "Daidalus.h"
+#include "DaidalusFileWalker.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+using namespace larcfm;
+
+// Position and velocity uncertainty of every aircraft when SUM is on, of the order of ADS-B accuracy
+static void set_uncertainty(Daidalus& daa, int ac) {
+  daa.setHorizontalPositionUncertainty(ac,30,30,0,"m");
+  daa.setVerticalPositionUncertainty(ac,15,"m");
+  daa.setHorizontalVelocityUncertainty(ac,3,3,0,"m/s");
+  daa.setVerticalSpeedUncertainty(ac,1,"m/s");
+}
+
+// Run ncycles of the encounters and return the time spent in DAIDALUS, in seconds
+static double run_cycles(Daidalus& daa, const Position& own_pos, const Velocity& own_vel,
+    const std::vector<Position>& ac_pos, const std::vector<Velocity>& ac_vel, int ncycles, bool sum, long& checksum) {
+  double time = 0.0;
+  std::chrono::duration<double> elapsed(0);
+  int ntraffic = static_cast<int>(ac_pos.size());
+  for (int cycle=0; cycle < ncycles; ++cycle, time += 1.0) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    daa.setOwnshipState("ownship",own_pos.linear(own_vel,time),own_vel,time);
+    if (sum) {
+      set_uncertainty(daa,0);
+    }
+    for (int i=0; i < ntraffic; ++i) {
+      int ac = daa.addTrafficState("ac"+Fmi(i),ac_pos[i].linear(ac_vel[i],time),ac_vel[i],time);
+      if (sum) {
+        set_uncertainty(daa,ac);
+      }
+    }
+    for (int ac=1; ac <= daa.lastTrafficIndex(); ++ac) {
+      checksum += daa.alertLevel(ac);
+    }
+    for (int i=0; i < daa.horizontalDirectionBandsLength(); ++i) {
+      checksum += daa.horizontalDirectionRegionAt(i)+static_cast<long>(1000*daa.horizontalDirectionIntervalAt(i).low);
+    }
+    for (int i=0; i < daa.horizontalSpeedBandsLength(); ++i) {
+      checksum += daa.horizontalSpeedRegionAt(i)+static_cast<long>(1000*daa.horizontalSpeedIntervalAt(i).low);
+    }
+    for (int i=0; i < daa.verticalSpeedBandsLength(); ++i) {
+      checksum += daa.verticalSpeedRegionAt(i)+static_cast<long>(1000*daa.verticalSpeedIntervalAt(i).low);
+    }
+    for (int i=0; i < daa.altitudeBandsLength(); ++i) {
+      checksum += daa.altitudeRegionAt(i)+static_cast<long>(1000*daa.altitudeIntervalAt(i).low);
+    }
+    elapsed += std::chrono::steady_clock::now()-start;
+  }
+  return elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+  std::string conf = "";
+  int ntraffic = 10;
+  int ncycles = 200;
+  unsigned int seed = 1;
+  int nlines = 200000;
+  bool sum = false;
+  for (int a=1; a < argc; ++a) {
+    std::string arg = argv[a];
+    if (arg == "--conf" && a+1 < argc) {
+      conf = argv[++a];
+    } else if (arg == "--traffic" && a+1 < argc) {
+      ntraffic = atoi(argv[++a]);
+    } else if (arg == "--cycles" && a+1 < argc) {
+      ncycles = atoi(argv[++a]);
+    } else if (arg == "--seed" && a+1 < argc) {
+      seed = atoi(argv[++a]);
+    } else if (arg == "--daa" && a+1 < argc) {
+      nlines = atoi(argv[++a]);
+    } else if (arg == "--sum") {
+      sum = true;
+    } else {
+      std::cerr << "Usage: DaidalusBenchmark [--conf <file>] [--traffic <n>] [--cycles <n>] [--seed <n>] [--daa <lines>] [--sum]" << std::endl;
+      return 1;
+    }
+  }
+
+  Daidalus daa;
+  if (conf != "") {
+    if (!daa.loadFromFile(conf)) {
+      std::cerr << "** Error: Configuration file " << conf << " not found" << std::endl;
+      return 1;
+    }
+  } else {
+    daa.set_DO_365A();
+  }
+
+  // Intruders are placed around the ownship, converging towards it
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> unif(0.0,1.0);
+  Position own_pos = Position::makeLatLonAlt(37.1,"deg",-76.3,"deg",5000,"ft");
+  Velocity own_vel = Velocity::makeTrkGsVs(45,"deg",150,"kn",0,"fpm");
+  std::vector<Position> ac_pos;
+  std::vector<Velocity> ac_vel;
+  for (int i=0; i < ntraffic; ++i) {
+    double brg = 2*Pi*unif(gen);
+    double range = Units::from("nmi",1.0+5.0*unif(gen));
+    ac_pos.push_back(own_pos.linearDist2D(brg,range).mkAlt(own_pos.alt()+Units::from("ft",1000*(unif(gen)-0.5))));
+    double trk = Util::to_2pi(brg+Pi+0.5*(unif(gen)-0.5));
+    ac_vel.push_back(Velocity::makeTrkGsVs(Units::to("deg",trk),"deg",100+100*unif(gen),"kn",500*(unif(gen)-0.5),"fpm"));
+  }
+
+  Daidalus daa_sum = daa;
+  long checksum = 0;
+  double elapsed = run_cycles(daa,own_pos,own_vel,ac_pos,ac_vel,ncycles,false,checksum);
+  printf("%d intruders, %d cycles: %.3f ms/cycle (checksum %ld)\n",
+      ntraffic,ncycles,1000*elapsed/ncycles,checksum);
+  if (sum) {
+    long checksum_sum = 0;
+    double elapsed_sum = run_cycles(daa_sum,own_pos,own_vel,ac_pos,ac_vel,ncycles,true,checksum_sum);
+    printf("%d intruders, %d cycles with SUM: %.3f ms/cycle (checksum %ld, %.2fx)\n",
+        ntraffic,ncycles,1000*elapsed_sum/ncycles,checksum_sum,elapsed_sum/elapsed);
+  }
+
+  // Extraction of the last bands in output units, as done by a traffic monitor
+  const int nextract = 20000;
+  double sum_str = 0.0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int k=0; k < nextract; ++k) {
+    for (int i=0; i < daa.horizontalDirectionBandsLength(); ++i) {
+      sum_str += daa.horizontalDirectionIntervalAt(i,"deg").low;
+    }
+    for (int i=0; i < daa.horizontalSpeedBandsLength(); ++i) {
+      sum_str += daa.horizontalSpeedIntervalAt(i,"m/s").low;
+    }
+    for (int i=0; i < daa.verticalSpeedBandsLength(); ++i) {
+      sum_str += daa.verticalSpeedIntervalAt(i,"m/s").low;
+    }
+    for (int i=0; i < daa.altitudeBandsLength(); ++i) {
+      sum_str += daa.altitudeIntervalAt(i,"m").low;
+    }
+  }
+  std::chrono::duration<double> elapsed_str = std::chrono::steady_clock::now()-start;
+  double sum_typed = 0.0;
+  start = std::chrono::steady_clock::now();
+  for (int k=0; k < nextract; ++k) {
+    for (int i=0; i < daa.horizontalDirectionBandsLength(); ++i) {
+      sum_typed += daa.horizontalDirectionIntervalAt(i,unit::deg).low;
+    }
+    for (int i=0; i < daa.horizontalSpeedBandsLength(); ++i) {
+      sum_typed += daa.horizontalSpeedIntervalAt(i,unit::mps).low;
+    }
+    for (int i=0; i < daa.verticalSpeedBandsLength(); ++i) {
+      sum_typed += daa.verticalSpeedIntervalAt(i,unit::mps).low;
+    }
+    for (int i=0; i < daa.altitudeBandsLength(); ++i) {
+      sum_typed += daa.altitudeIntervalAt(i,unit::m).low;
+    }
+  }
+  std::chrono::duration<double> elapsed_typed = std::chrono::steady_clock::now()-start;
+  printf("band extraction: %.3f us with string units, %.3f us with typed units%s\n",
+      1e6*elapsed_str.count()/nextract,1e6*elapsed_typed.count()/nextract,
+      sum_str == sum_typed ? "" : " (MISMATCH)");
+
+  // Reconfiguration from a full parameter database, including alerters
+  const int nconfig = 200;
+  ParameterData params = daa.getParameterData();
+  start = std::chrono::steady_clock::now();
+  for (int k=0; k < nconfig; ++k) {
+    daa.setParameterData(params);
+  }
+  std::chrono::duration<double> elapsed_config = std::chrono::steady_clock::now()-start;
+  printf("setParameterData: %.3f us (%d parameters)%s\n",
+      1e6*elapsed_config.count()/nconfig,params.size(),
+      daa.getParameterData().equals(params) ? "" : " (MISMATCH)");
+
+  // Reading of a large encounter file
+  if (nlines > 0) {
+    std::string filename = "DaidalusBenchmark.daa";
+    std::ofstream out(filename.c_str());
+    out << "NAME, lat, lon, alt, trk, gs, vs, time" << std::endl;
+    out << "[none], [deg], [deg], [ft], [deg], [knot], [fpm], [s]" << std::endl;
+    int naircraft = ntraffic+1;
+    for (int l=0; l < nlines; ++l) {
+      int i = l % naircraft;
+      double t = l / naircraft;
+      const Position& pos = i == 0 ? own_pos : ac_pos[i-1];
+      const Velocity& vel = i == 0 ? own_vel : ac_vel[i-1];
+      Position p = pos.linear(vel,t);
+      out << (i == 0 ? "ownship" : "ac"+Fmi(i-1)) << ", " << FmPrecision(Units::to("deg",p.lat()),8) << ", "
+          << FmPrecision(Units::to("deg",p.lon()),8) << ", " << FmPrecision(Units::to("ft",p.alt()),4) << ", "
+          << FmPrecision(Units::to("deg",vel.trk()),4) << ", " << FmPrecision(Units::to("knot",vel.gs()),4) << ", "
+          << FmPrecision(Units::to("fpm",vel.vs()),4) << ", " << Fm1(t) << std::endl;
+    }
+    std::streamoff bytes = out.tellp();
+    out.close();
+    start = std::chrono::steady_clock::now();
+    DaidalusFileWalker walker(filename);
+    std::chrono::duration<double> elapsed_read = std::chrono::steady_clock::now()-start;
+    printf("reading %d states: %.3f ms (%.1f MB/s, %d time steps)\n",
+        nlines,1000*elapsed_read.count(),bytes/1e6/elapsed_read.count(),walker.numberOfTimeSteps());
+    Daidalus daa_walk = daa;
+    start = std::chrono::steady_clock::now();
+    while (!walker.atEnd()) {
+      walker.readState(daa_walk);
+    }
+    std::chrono::duration<double> elapsed_walk = std::chrono::steady_clock::now()-start;
+    printf("walking %d time steps: %.3f ms\n",walker.numberOfTimeSteps(),1000*elapsed_walk.count());
+    std::remove(filename.c_str());
+  }
+  return 0;
+}
@@ -12,7 +12,7 @@
 #ifndef ALERTINGMOFN_H_
 #define ALERTINGMOFN_H_
 
-#include <deque>
+#include <vector>
 
 namespace larcfm {
 
@@ -69,7 +69,9 @@ private:
   double _last_time_;
   int    _alert_;
   int    _max_;
-  std::deque<int> _queue_;
+  // Last n alert levels, in a ring buffer where the oldest value is at _head_
+  std::vector<int> _queue_;
+  int    _head_;
 };
 
 } /* namespace larcfm */
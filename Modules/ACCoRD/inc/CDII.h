@@ -14,6 +14,7 @@
 #define CDII_H_
 
 #include <string>
+#include <vector>
 #include "Vect3.h"
 #include "Vect2.h"
 #include "ErrorLog.h"
@@ -220,6 +221,22 @@ namespace larcfm {
     bool detectionExtended(const Plan& ownship, const Plan& traffic, double startT, double endT,  bool interpolateVirtuals);
     bool detectionExtended(const Plan& ownship, const Plan& traffic, double startT, double endT);
 
+  /**
+   * Conflict detection between the ownship and each of several traffic aircraft. The traffic
+   * plans are checked concurrently, each with its own copy of this object and of the ownship plan.
+   * After the call, results[k] holds the conflicts between ownship and traffic[k], exactly as if 
+   * detection(ownship,traffic[k],startT,endT) had been called on a copy of this object.<p>
+   *
+   * @param ownship the trajectory intent of the ownship
+   * @param traffic the trajectory intents of the traffic aircraft
+   * @param startT the time, in [s], to start looking for conflicts. This can be 0.0.
+   * @param endT the time, in [s], to end looking for conflicts (absolute time)
+   * @param results conflict information for each traffic aircraft, resized to traffic.size()
+   * @param nthreads number of threads, if zero or negative the number of hardware threads is used
+   * @return true if there is a conflict with any traffic aircraft
+   */
+    bool detection(const Plan& ownship, const std::vector<Plan>& traffic, double startT, double endT, std::vector<CDII>& results, int nthreads) const;
+
     /** Experimental.  You are responsible for deleting c after this call. */
     void setCoreDetectionPtr(const Detection3D* c);
     void setCoreDetectionRef(const Detection3D& c);
@@ -23,6 +23,7 @@
 #include "ParameterData.h"
 #include "MovingPolygon2D.h"
 #include "MovingPolygon3D.h"
+#include "PreparedPolygon.h"
 
 namespace larcfm {
 
@@ -98,6 +99,23 @@ public:
    */
   bool nearEdge(const Vect3& so, const Poly3D& si, double h, double v) const;
 
+  /**
+   * Prepare a polygon for testing many points with this detector's buffer and checkNice setting.
+   * The prepared polygon gives the same answers as definitelyInside(), definitelyOutside() and
+   * nearEdge() (with h = buff), but the niceness check is only done once.
+   * @param si polygon
+   * @return prepared polygon
+   */
+  PreparedPolygon prepare(const Poly3D& si) const;
+
+  /**
+   * Prepare a polygon, projected with proj if it is in latitude/longitude
+   * @param si polygon
+   * @param proj projection
+   * @return prepared polygon
+   */
+  PreparedPolygon prepare(const SimplePoly& si, const EuclideanProjection& proj) const;
+
   ParameterData getParameters() const;
   void updateParameterData(ParameterData& p) const;
   void setParameters(const ParameterData& p);
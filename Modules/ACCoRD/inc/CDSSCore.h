@@ -174,6 +174,14 @@ public:
    */
   bool detectionBetween(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T, double timeHorizon);
 
+  /**
+   * Returns true if the core detection is a CDCylinder and the relative position so-si+t*(vo-vi),
+   * for t in [0,timeHorizon], stays on one side of the cylinder (horizontally in x or y, or vertically).
+   * There is then no conflict in [0,timeHorizon], and detectionBetween() with the same time horizon is false.
+   * This is a cheap test to skip detectionBetween(), a false result says nothing.
+   */
+  bool separatedWithin(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double timeHorizon) const;
+
   /**
    * Detects a conflict that lasts more than filter time in a given lookahead time
    * interval and computes the time interval of conflict (specified units).
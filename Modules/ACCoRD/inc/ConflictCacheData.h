@@ -0,0 +1,76 @@
+/*
+ * Cached conflict detection results of an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef CONFLICTCACHEDATA_H_
+#define CONFLICTCACHEDATA_H_
+
+#include "TrafficState.h"
+#include "ConflictData.h"
+#include "SUMData.h"
+#include <vector>
+
+namespace larcfm {
+
+class ConflictCacheData {
+public:
+  /*
+   * Creates an empty object
+   */
+  ConflictCacheData();
+
+  /*
+   * Returns true if cached values were computed for the given ownship and intruder states,
+   * including their uncertainties (SUM data), alerter index, and lookahead time
+   */
+  bool isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) const;
+
+  /*
+   * Clear cached values and set the states, alerter index, and lookahead time they depend on
+   */
+  void reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T);
+
+  /*
+   * Returns true if the conflict data of given alert level is cached
+   */
+  bool hasConflictData(int alert_level) const;
+
+  /*
+   * Returns cached conflict data of given alert level. Requires hasConflictData(alert_level)
+   */
+  const ConflictData& getConflictData(int alert_level) const;
+
+  void setConflictData(int alert_level, const ConflictData& det);
+
+  /*
+   * Flag used to discard entries of aircraft that are no longer in the traffic list
+   */
+  bool isUsed() const;
+
+  void setUsed(bool used);
+
+  std::string toString() const;
+
+  virtual ~ConflictCacheData() {};
+
+private:
+  Vect3    own_s_;
+  Velocity own_v_;
+  SUMData  own_sum_;
+  Vect3    ac_s_;
+  Velocity ac_v_;
+  SUMData  ac_sum_;
+  int      alerter_idx_;
+  double   lookahead_time_;
+  std::vector<ConflictData> conflict_data_; // Indexed by alert level - 1
+  std::vector<bool> computed_;
+  bool     used_;
+};
+
+}
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Cached horizontal contours and hazard zones of an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef CONTOURCACHEDATA_H_
+#define CONTOURCACHEDATA_H_
+
+#include "TrafficState.h"
+#include "Position.h"
+#include "SUMData.h"
+#include <string>
+#include <vector>
+
+namespace larcfm {
+
+class ContourCacheData {
+public:
+  /*
+   * Creates an empty object
+   */
+  ContourCacheData();
+
+  /*
+   * Returns true if cached values were computed for the given ownship and intruder states,
+   * including their uncertainties (SUM data), alerter index, and lookahead time. Contours and hazard zones are geodesic polygons, so
+   * the states are compared in absolute coordinates as well as in the ownship's projection.
+   */
+  bool isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) const;
+
+  /*
+   * Clear cached values and set the states, alerter index, and lookahead time they depend on
+   */
+  void reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T);
+
+  /*
+   * Returns true if the contours of given alert level are cached for contour threshold thr
+   */
+  bool hasContours(int alert_level, double thr) const;
+
+  /*
+   * Returns cached contours of given alert level. Requires hasContours(alert_level,thr)
+   */
+  const std::vector<std::vector<Position> >& getContours(int alert_level) const;
+
+  void setContours(int alert_level, double thr, const std::vector<std::vector<Position> >& blobs);
+
+  /*
+   * Returns true if the hazard zone of given alert level, loss and from_ownship flags is
+   * cached for time horizon T
+   */
+  bool hasHazardZone(int alert_level, bool loss, bool from_ownship, double T) const;
+
+  /*
+   * Returns cached hazard zone. Requires hasHazardZone(alert_level,loss,from_ownship,T)
+   */
+  const std::vector<Position>& getHazardZone(int alert_level, bool loss, bool from_ownship) const;
+
+  void setHazardZone(int alert_level, bool loss, bool from_ownship, double T, const std::vector<Position>& haz);
+
+  std::string toString() const;
+
+  virtual ~ContourCacheData() {};
+
+private:
+  static int hazard_index(int alert_level, bool loss, bool from_ownship);
+
+  Position own_pos_;
+  Velocity own_vel_;
+  Position ac_pos_;
+  Velocity ac_vel_;
+  Vect3    own_s_;
+  Velocity own_v_;
+  Vect3    ac_s_;
+  Velocity ac_v_;
+  SUMData  own_sum_;
+  SUMData  ac_sum_;
+  int      alerter_idx_;
+  double   lookahead_time_;
+  std::vector<std::vector<std::vector<Position> > > contours_; // Indexed by alert level - 1
+  std::vector<double> contour_thr_;   // Threshold of cached contours, NaN if not computed
+  std::vector<std::vector<Position> > hazard_zones_; // Indexed by hazard_index
+  std::vector<double> hazard_time_;   // Time horizon of cached hazard zones, NaN if not computed
+};
+
+}
+#endif
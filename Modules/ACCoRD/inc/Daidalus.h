@@ -16,6 +16,7 @@
 #include "DaidalusVsBands.h"
 #include "UrgencyStrategy.h"
 #include "Velocity.h"
+#include "UnitSymbol.h"
 #include "ErrorLog.h"
 #include "ErrorReporter.h"
 #include "TrafficState.h"
@@ -103,6 +104,8 @@ private:
 
   void stale_bands();
 
+  void stale();
+
 public:
   /* Constructors */
 
@@ -250,6 +253,30 @@ public:
    */
   bool removeTrafficAircraft(const std::string& name);
 
+  /**
+   * Same as setOwnshipState with ownship's identifier, i.e., set ownship state and current time, and clear
+   * all traffic, but the identifier is not copied and the ownship's state is updated in place. Returns false,
+   * and nothing is done, if ownship has not been set, or if pos is lat/lon and ownship's position is not,
+   * or vice versa.
+   * @param pos Ownship's position
+   * @param vel Ownship's ground velocity
+   * @param time Time stamp of ownship's state
+   */
+  bool updateOwnshipState(const Position& pos, const Velocity& vel, double time);
+
+  /**
+   * Update state of traffic aircraft at index ac_idx in place, keeping its identifier and index. This is the
+   * same as addTrafficState with the aircraft's identifier, i.e., the state is projected into current time,
+   * and alerter and SUM data are reset, but the identifier is not looked up or copied. Position and velocity
+   * are only projected again into the ownship's frame if they, or the frame, change.
+   * @param ac_idx Aircraft's index, between 1 and lastTrafficIndex
+   * @param pos Aircraft's position
+   * @param vel Aircraft's ground velocity
+   * @param time Time stamp of aircraft's state
+   * @return Aircraft's index, or -1 if nothing is done (e.g., index is out of bounds or the state is not valid)
+   */
+  int updateTrafficState(int ac_idx, const Position& pos, const Velocity& vel, double time);
+
   /**
    * Project ownship and traffic aircraft offset seconds in the future (if positive) or in the past (if negative)
    * EXPERT USE ONLY !!!
@@ -493,6 +520,30 @@ public:
   void horizontalHazardZone(std::vector<Position>& haz, int ac_idx, bool loss, bool from_ownship,
       BandsRegion::Region region);
 
+  /**
+   * Computes, using up to nthreads threads, the horizontal contours of all traffic aircraft for
+   * given alert level, so that subsequent calls to horizontalContours return them without
+   * recomputation. Contours are kept until the ownship or traffic state, or the parameters change.
+   * @param alert_level is the alert level used to compute detection. The value 0
+   * indicate the alert level of the corrective region, a negative value all the alert levels.
+   * @param nthreads maximum number of threads. All hardware threads are used when nthreads <= 0.
+   */
+  void computeHorizontalContours(int alert_level=0, int nthreads=0);
+
+  /**
+   * Computes, using up to nthreads threads, the horizontal hazard zones of all traffic aircraft for
+   * given alert level, so that subsequent calls to horizontalHazardZone return them without
+   * recomputation. Hazard zones are kept until the ownship or traffic state, or the parameters change.
+   * @param loss true means that the polygons represent the hazard zones. Otherwise,
+   * the polygons represent the hazard zones with an alerting time.
+   * @param from_ownship true means ownship point of view. Otherwise, the hazard zones are computed
+   * from the intruders' point of view.
+   * @param alert_level is the alert level used to compute detection. The value 0
+   * indicate the alert level of the corrective region, a negative value all the alert levels.
+   * @param nthreads maximum number of threads. All hardware threads are used when nthreads <= 0.
+   */
+  void computeHorizontalHazardZones(bool loss, bool from_ownship, int alert_level=0, int nthreads=0);
+
   /* Setting and getting DaidalusParameters */
 
   /**
@@ -1893,6 +1944,13 @@ public:
    */
   Interval horizontalDirectionIntervalAt(int i, const std::string& u);
 
+  /**
+   * @return the i-th interval, in specified units [u], of the computed direction bands.
+   * @param i index
+   * @param u units, resolved at compile time
+   */
+  Interval horizontalDirectionIntervalAt(int i, const AngleUnit& u);
+
   /**
    * @return the i-th region of the computed direction bands.
    * @param i index
@@ -2040,6 +2098,13 @@ public:
    */
   Interval horizontalSpeedIntervalAt(int i, const std::string& u);
 
+  /**
+   * @return the i-th interval, in specified units [u], of the computed horizontal speed bands.
+   * @param i index
+   * @param u units, resolved at compile time
+   */
+  Interval horizontalSpeedIntervalAt(int i, const SpeedUnit& u);
+
   /**
    * @return the i-th region of the computed horizontal speed bands.
    * @param i index
@@ -2187,6 +2252,13 @@ public:
    */
   Interval verticalSpeedIntervalAt(int i, const std::string& u);
 
+  /**
+   * @return the i-th interval, in specified units [u], of the computed vertical speed bands.
+   * @param i index
+   * @param u units, resolved at compile time
+   */
+  Interval verticalSpeedIntervalAt(int i, const SpeedUnit& u);
+
   /**
    * @return the i-th region of the computed vertical speed bands.
    * @param i index
@@ -2334,6 +2406,13 @@ public:
    */
   Interval altitudeIntervalAt(int i, const std::string& u);
 
+  /**
+   * @return the i-th interval, in specified units [u], of the computed altitude bands.
+   * @param i index
+   * @param u units, resolved at compile time
+   */
+  Interval altitudeIntervalAt(int i, const LengthUnit& u);
+
 
   /**
    * @return the i-th region of the computed altitude bands.
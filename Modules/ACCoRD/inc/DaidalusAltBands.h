@@ -66,9 +66,11 @@ private:
       const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic, bool dir, bool green, bool instantaneous) const;
 
 public:
-  virtual void none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
+  virtual void integer_none_bands(std::vector<Integerval>& bands_int, const Detection3D* conflict_det, const Detection3D* recovery_det,
       int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
 
+  virtual double integer_bands_origin(const TrafficState& ownship) const;
+
   virtual bool any_red(const Detection3D* conflict_det, const Detection3D* recovery_det,
       int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
 
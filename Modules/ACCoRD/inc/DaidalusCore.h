@@ -23,6 +23,8 @@
 #include <cmath>
 
 #include "HysteresisData.h"
+#include "ConflictCacheData.h"
+#include "ContourCacheData.h"
 
 namespace larcfm {
 
@@ -74,18 +76,64 @@ private:
    * NaN means that bands are not computed for that region*/
   bool bands4region_[BandsRegion::NUMBER_OF_CONFLICT_BANDS];
 
-  /**** HYSTERESIS VARIABLES ****/
-
-  // Alerting and DTA hysteresis per aircraft's ids
-  std::map<std::string,HysteresisData> alerting_hysteresis_acs_;
-  std::map<std::string,HysteresisData> dta_hysteresis_acs_;
+  /**** PER-AIRCRAFT VARIABLES ****/
+
+  // Alerting and DTA hysteresis, and conflict detection results, of one aircraft
+  struct AircraftSlot {
+    std::string id;
+    bool has_alerting_hysteresis;
+    HysteresisData alerting_hysteresis;
+    bool has_dta_hysteresis;
+    HysteresisData dta_hysteresis;
+    // Unlike the cached variables above, conflict detection results survive stale() and are only
+    // recomputed when ownship state, intruder state, or alerter change.
+    bool has_conflict_cache;
+    ConflictCacheData conflict_cache;
+    AircraftSlot();
+  };
+
+  // Per-aircraft variables are kept in slots. A slot is assigned to an aircraft's id when its state
+  // is set, and is kept, with the aircraft's hysteresis, until the aircraft is removed. The alerting
+  // logic finds the slots of the ownship and of the traffic aircraft by index, not by id.
+  std::vector<AircraftSlot> slots_;
+  std::map<std::string,int> slot_of_id_;
+  std::vector<int> free_slots_;
+  int ownship_slot_;               // -1 if not assigned yet
+  std::vector<int> traffic_slots_; // Slot of each aircraft in the traffic list
+
+  // Traffic list, and slots, before the ownship state was last set. The states of aircraft that are
+  // added again are updated in place, rather than built from scratch. Aircraft before recycled_next_
+  // have been added again, or skipped, so that the other recycled aircraft are not in the traffic list.
+  std::vector<TrafficState> recycled_traffic_;
+  std::vector<int> recycled_slots_;
+  int recycled_next_;
+
+  /**** PER-INTRUDER CACHED VARIABLES ****/
+
+  // Horizontal contours and hazard zones per aircraft's ids. These entries are computed on demand,
+  // survive stale(), and are kept until the states they were computed for change.
+  std::map<std::string,ContourCacheData> contour_cache_acs_;
 
   void copyFrom(const DaidalusCore& core);
+
+  // Move traffic list to recycled_traffic_ and clear it
+  void recycle_traffic();
+  // Forget recycled aircraft, when the traffic list changes other than by set_traffic_state
+  void clear_recycled_traffic();
+  // Index in recycled_traffic_ of aircraft id, which is removed from the recycled aircraft. -1 if none
+  int recycled_index(const std::string& id);
   void refresh_mua_eps();
 
+  // Slot of aircraft id, a new one if the id doesn't have one
+  int assign_slot(const std::string& id);
+  // Assign the slots of the ownship and the traffic list after they have been copied
+  void assign_slots();
+  // Slot of ac, which is usually the ownship or an element of the traffic list of this object
+  int slot_of(const TrafficState& ac);
+
 public:
   DaidalusCore();
-  virtual ~DaidalusCore() {};
+  virtual ~DaidalusCore();
   DaidalusCore& operator=(const DaidalusCore& core);
 
   DaidalusCore(const DaidalusCore& core);
@@ -118,6 +166,12 @@ public:
    */
   void stale();
 
+  /**
+   * Clear per-intruder conflict detection results, contours, and hazard zones. Required when parameters
+   * or alerters change.
+   */
+  void clear_conflict_cache();
+
   /**
    * Returns true is object is fresh
    */
@@ -192,6 +246,14 @@ public:
   // idx is 0-based index in traffic list
   bool remove_traffic(int idx);
 
+  // Same as set_ownship_state with ownship's identifier, but ownship's state is updated in place. Return false
+  // if nothing is done (e.g., there is no ownship, or pos is lat/lon and ownship is not, or vice versa)
+  bool update_ownship_state(const Position& pos, const Velocity& vel, double time);
+
+  // Update state of aircraft at 0-based index idx in traffic list in place, keeping its identifier. Return
+  // false if nothing is done (e.g., index is out of bounds or the state is not valid)
+  bool update_traffic_state(int idx, const Position& pos, const Velocity& vel, double time);
+
   void set_wind_velocity(const Velocity& wind);
 
   bool linear_projection(double offset);
@@ -217,6 +279,21 @@ public:
   int horizontal_hazard_zone(std::vector<Position>& haz, int idx, int alert_level,
       bool loss, bool from_ownship);
 
+  /*
+   * Computes and caches, using up to nthreads threads (all hardware threads if nthreads <= 0),
+   * the horizontal contours of every traffic aircraft for given alert level. The value 0 indicates
+   * the corrective level and a negative value all the levels of the aircraft's alerter.
+   * Aircraft whose contours are already cached, or that have no detector for a level, are skipped.
+   */
+  void horizontal_contours_all(int alert_level, int nthreads);
+
+  /*
+   * Computes and caches, using up to nthreads threads (all hardware threads if nthreads <= 0),
+   * the horizontal hazard zones of every traffic aircraft for given alert level, as in
+   * horizontal_contours_all.
+   */
+  void horizontal_hazard_zones_all(int alert_level, bool loss, bool from_ownship, int nthreads);
+
   /**
    * Computes alerting type of ownship and an the idx-th aircraft in the traffic list
    * The number 0 means no alert. A negative number means
@@ -244,12 +321,39 @@ private:
 
   bool greater_than_corrective() const;
 
-  int raw_alert_level(const Alerter& alerter, const TrafficState& intruder, int turning, int accelerating, int climbing);
+  int raw_alert_level(int alerter_idx, const TrafficState& intruder, int turning, int accelerating, int climbing);
 
   /**
    * Return true if and only if threshold values, defining an alerting level, are violated.
    */
-  bool check_alerting_thresholds(const Alerter& alerter, int alert_level, const TrafficState& intruder, int turning, int accelerating, int climbing);
+  bool check_alerting_thresholds(int alerter_idx, int alert_level, const TrafficState& intruder, int turning, int accelerating, int climbing);
+
+  /**
+   * Conflict detection of ownship and intruder over lookahead time for the core detector of given
+   * alerter and alert level. Results are reused until ownship state, intruder state, or alerter change.
+   */
+  ConflictData conflict_detection(const TrafficState& intruder, int alerter_idx, int alert_level);
+
+  /**
+   * Remove cached conflict detection results of aircraft that are no longer in the traffic list
+   */
+  void prune_conflict_cache();
+
+  /**
+   * Remove cached contours and hazard zones of aircraft that are no longer in the traffic list
+   */
+  void prune_contour_cache();
+
+  /*
+   * Cache entry of contours and hazard zones of intruder, valid for current states and given alerter
+   */
+  ContourCacheData& contour_cache_entry(const TrafficState& intruder, int alerter_idx);
+
+  /*
+   * Computes the contours (hazard zones if hazard is true) of all traffic aircraft that are not cached yet,
+   * with one detector call per aircraft and level shared among up to nthreads threads
+   */
+  void compute_contours_all(bool hazard, int alert_level, bool loss, bool from_ownship, int nthreads);
 
   /**
    * Requires 0 <= conflict_region < CONFICT_BANDS
@@ -64,9 +64,19 @@ class DaidalusFileWalker : public ErrorReporter {
 
   int indexOfTime(double t) const;
 
+  int numberOfTimeSteps() const;
+
   static void readExtraColumns(Daidalus& daa, const SequenceReader& sr, int ac_idx);
 
   void readState(Daidalus& daa);
+
+  /**
+   * Read the states of time step i into daa, as readState does, without moving the walker.
+   * The walker is not modified, so that different time steps may be read concurrently into
+   * different Daidalus objects.
+   */
+  void readStateAt(Daidalus& daa, int i) const;
+
   bool hasError() const;
 
   bool hasMessage() const;
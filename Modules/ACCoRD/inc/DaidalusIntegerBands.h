@@ -12,6 +12,7 @@
 #include "Vect3.h"
 #include "Position.h"
 #include "Detection3D.h"
+#include "DetectionDispatch.h"
 #include "Integerval.h"
 #include "IntervalSet.h"
 #include "CriteriaCore.h"
@@ -19,6 +20,7 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "TrafficState.h"
 
 namespace larcfm {
@@ -34,8 +36,17 @@ public:
   virtual std::pair<Vect3,Velocity> trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
       double time, bool dir, int target_step, bool instantaneous) const = 0;
 
+  DaidalusIntegerBands();
+
   virtual ~DaidalusIntegerBands() {}
 
+  /**
+   * When share is true, ownship trajectories are kept in a table indexed by maneuver and time, so that
+   * they are computed once and reused for every traffic aircraft and alert level. Ownship, parameters, and
+   * configuration must not change while trajectories are shared. The table is cleared by every call.
+   */
+  void share_ownship_trajectories(bool share);
+
   /*
    * In PVS: int_bands@CD_future_traj
    */
@@ -59,7 +70,54 @@ public:
   bool LOS_at(const Detection3D* det, bool trajdir, double tsk,
       const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic, int target_step, bool instantaneous) const;
 
+protected:
+  /**
+   * Resolve the concrete classes of the detectors used by a band computation, so that the checks in
+   * CD_future_traj and LOS_at do not go through virtual calls. Call with NULL detectors when the
+   * computation ends, other detectors are always checked through the Detection3D interface.
+   */
+  void resolve_detectors(const Detection3D* conflict_det, const Detection3D* recovery_det) const;
+
 private:
+  // Maneuver (direction, target step, instantaneous) and time of an ownship trajectory
+  struct TrajectoryKey {
+    double time;
+    int target_step;
+    bool dir;
+    bool instantaneous;
+    bool operator==(const TrajectoryKey& key) const;
+  };
+
+  struct TrajectoryKeyHash {
+    std::size_t operator()(const TrajectoryKey& key) const;
+  };
+
+  // Ownship trajectory at a given time and the ownship state used for detection from that time
+  struct OwnshipTrajectory {
+    std::pair<Vect3,Velocity> sovot;
+    TrafficState own;
+  };
+
+  mutable DetectionDispatch conflict_dispatch_;
+  mutable DetectionDispatch recovery_dispatch_;
+
+  // det->conflictWithTrafficState(own,traffic,B,T), through a resolved detector when det is one of them
+  bool conflict_with(const Detection3D* det, const TrafficState& own, const TrafficState& traffic, double B, double T) const;
+
+  bool share_trajectories_;
+  mutable std::unordered_map<TrajectoryKey,OwnshipTrajectory,TrajectoryKeyHash> trajectories_;
+
+  // Ownship at sot-tsk*vot (at sot when tsk is 0) with velocity vot
+  static TrafficState ownship_at(const TrafficState& ownship, double tsk, const std::pair<Vect3,Velocity>& sovot);
+
+  // Requires share_trajectories_. Entry of the trajectory table, computed if it is not there yet
+  const OwnshipTrajectory& shared_trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
+      double time, bool dir, int target_step, bool instantaneous) const;
+
+  // Same as trajectory, looked up in the trajectory table when trajectories are shared
+  std::pair<Vect3,Velocity> own_trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
+      double time, bool dir, int target_step, bool instantaneous) const;
+
   // In PVS: int_bands@first_los_step
   int kinematic_first_los_step(const Detection3D* det, double tstep, bool trajdir,
       int min, int max, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
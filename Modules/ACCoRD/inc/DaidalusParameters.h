@@ -124,6 +124,7 @@ private:
   double dta_radius_;
   double dta_height_;
   int dta_alerter_;
+  mutable Position dta_position_; // Cached position of dta_latitude_ and dta_longitude_
 
 
   // Alerting logic
@@ -943,6 +944,20 @@ private:
 
   static std::vector<std::string> getListString(const ParameterData& p,const std::string& key);
 
+  static const std::string* alias_in(const ParameterData& p, const ParameterKey& key);
+
+  static bool contains(const ParameterData& p, const ParameterKey& key);
+
+  static std::string getUnit(const ParameterData& p, const ParameterKey& key);
+
+  static double getValue(const ParameterData& p, const ParameterKey& key);
+
+  static bool getBool(const ParameterData& p, const ParameterKey& key);
+
+  static int getInt(const ParameterData& p, const ParameterKey& key);
+
+  static std::string getString(const ParameterData& p, const ParameterKey& key);
+
 public:
   bool setParameterData(const ParameterData& p);
 
@@ -9,7 +9,10 @@
 #define DAIDALUSPROCESSOR_H_
 
 #include "Daidalus.h"
+#include "DaidalusFileWalker.h"
 #include <vector>
+#include <ostream>
+#include <mutex>
 
 class DaidalusProcessor {
 private:
@@ -18,6 +21,10 @@ private:
 	double relative_;
 	std::string options_;
 	std::string ownship_;
+	std::mutex process_time_lock_; // processTime is called one time step at a time
+
+	bool timeRange(const larcfm::DaidalusFileWalker& dw, double& from, double& to) const;
+	bool selectOwnship(larcfm::Daidalus& daa, double t) const;
 
 public:
 	DaidalusProcessor(const std::string& own);
@@ -33,6 +40,41 @@ public:
 	std::string getOptionsString();
 	void processFile(const std::string& filename, larcfm::Daidalus& daa);
 	virtual void processTime(larcfm::Daidalus& daa, const std::string& filename) = 0;
+
+	/**
+	 * Process file as processFile(filename,daa), calling processTimeStep(daa,filename,out)
+	 * for every time step.
+	 */
+	void processFile(const std::string& filename, larcfm::Daidalus& daa, std::ostream& out);
+
+	/**
+	 * Process the files concurrently on up to nthreads threads (all hardware threads if nthreads <= 0),
+	 * each thread with its own copy of daa. Every file is processed in time order by one thread, so
+	 * the output is the same as processing the files one after the other. The output of each file
+	 * is written to out, in the order of the files.
+	 */
+	void processFiles(const std::vector<std::string>& filenames, const larcfm::Daidalus& daa, std::ostream& out, int nthreads);
+
+	/**
+	 * Process the time steps of the file concurrently on up to nthreads threads (all hardware threads if
+	 * nthreads <= 0), each thread with its own copy of daa. Time steps are independent: hysteresis
+	 * and persistence are cleared before every time step, so the output only matches processFile
+	 * when these are not configured. The output of each time step is written to out, in time order.
+	 */
+	void processTimeSteps(const std::string& filename, const larcfm::Daidalus& daa, std::ostream& out, int nthreads);
+
+	/**
+	 * Called at the beginning of every file by processFile(filename,daa,out) and processFiles,
+	 * e.g., to write a header. By default, it does nothing.
+	 */
+	virtual void processFileHeader(larcfm::Daidalus& daa, const std::string& filename, std::ostream& out);
+
+	/**
+	 * Process the current time step, writing output to out. This method is called from the
+	 * worker threads of processFiles and processTimeSteps, and must only modify daa and out.
+	 * By default, it calls processTime(daa,filename), one time step at a time.
+	 */
+	virtual void processTimeStep(larcfm::Daidalus& daa, const std::string& filename, std::ostream& out);
 };
 
 #endif /* DAIDALUSPROCESSOR_H_ */
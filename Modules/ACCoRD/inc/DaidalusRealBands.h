@@ -22,9 +22,11 @@
 #include "RecoveryInformation.h"
 #include "BandsMofN.h"
 #include "BandsHysteresis.h"
+#include "IntegerBandsCacheData.h"
 
 #include <vector>
 #include <string>
+#include <map>
 
 #include "ColorValue.h"
 #include "TrafficState.h"
@@ -85,6 +87,12 @@ private:
   double max_relative_; // Computed relative max value
   bool   circular_; // True if bands is fully circular
 
+  /**** PER-INTRUDER CACHED VARIABLES ****/
+
+  // Integer conflict bands contributed by each aircraft, per aircraft's ids. These entries survive
+  // stale(), are recomputed when the aircraft states change, and are cleared when parameters change.
+  std::map<std::string,IntegerBandsCacheData> bands_cache_acs_;
+
   /**** HYSTERESIS VARIABLES ****/
 
   BandsHysteresis bands_hysteresis_;
@@ -160,10 +168,15 @@ public:
   void stale();
 
   /**
-   * clear hysteresis
+   * clear hysteresis and per-intruder integer bands
    */
   void clear_hysteresis();
 
+  /**
+   * Clear per-intruder integer bands. Required when parameters or alerters change.
+   */
+  void clear_bands_cache();
+
   /**
    * Returns true is object is fresh
    */
@@ -229,6 +242,18 @@ private:
       Detection3D* det, Detection3D* recovery,
       bool recovery_case, double B, DaidalusCore& core);
 
+  /**
+   * None bands of intruder for the core detector of given alerter and alert level, without recovery
+   * detector. The integer bands are reused until the aircraft states or their inputs change.
+   */
+  void cached_none_bands(IntervalSet& noneset, Detection3D* detector, int alerter_idx, int alert_level,
+      int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic);
+
+  /**
+   * Remove cached integer bands of aircraft that are no longer in the traffic list
+   */
+  void prune_bands_cache(const DaidalusCore& core);
+
   /**
    * Compute recovery bands. Class variables recovery_time_, recovery_horizontal_distance_,
    * and recovery_vertical_distance_ are set.
@@ -302,11 +327,22 @@ public:
    */
   void toIntervalSet(IntervalSet& noneset, const std::vector<Integerval>& l, double scal, double add) const;
 
+  /**
+   * The output parameter bands_int has a list of non-conflict ranges in steps from integer_bands_origin
+   */
+  virtual void integer_none_bands(std::vector<Integerval>& bands_int, const Detection3D* conflict_det, const Detection3D* recovery_det,
+      int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
+
+  /**
+   * Value of step 0 of the integer bands
+   */
+  virtual double integer_bands_origin(const TrafficState& ownship) const;
+
   /**
    * The output parameter noneset has a list of non-conflict ranges orderd within [min,max]
    * values (or [0,mod] in the case of circular bands, i.e., when mod == 0).
    */
-  virtual void none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
+  void none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
       int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
 
   virtual bool any_red(const Detection3D* conflict_det, const Detection3D* recovery_det,
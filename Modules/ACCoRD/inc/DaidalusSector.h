@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2015-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef DAIDALUSSECTOR_H_
+#define DAIDALUSSECTOR_H_
+
+#include "Daidalus.h"
+#include "Position.h"
+#include "Velocity.h"
+#include "Interval.h"
+#include "BandsRegion.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace larcfm {
+
+/**
+ * Alerting and bands for every aircraft of a sector, computed from one traffic picture.<p>
+ *
+ * The aircraft of the sector are added once per cycle. compute(time) then runs DAIDALUS for every
+ * aircraft marked as ownship, with all the other aircraft of the picture as traffic. By default, the
+ * ownships are processed on the calling thread. With more threads, compute starts that many workers
+ * that take the next ownship as soon as they are done with the previous one. Each ownship
+ * has its own Daidalus object, a copy of the configured one, that is kept from one cycle to the next,
+ * so that hysteresis and persistence logic work as if each ownship were processed alone. The results
+ * are the same as calling setOwnshipState and addTrafficState on that object with the states
+ * projected to the time of the cycle, one ownship after the other.<p>
+ *
+ * The states of all aircraft are projected to the time of the cycle once, rather than once per
+ * ownship. Results are kept in flat arrays: a matrix of alert levels indexed by ownship and aircraft,
+ * and, for every type of band, the intervals and regions of all ownships one after the other.
+ */
+class DaidalusSector {
+public:
+
+  /** Sector with a default Daidalus configuration, computed on the calling thread */
+  DaidalusSector();
+
+  /**
+   * Sector where every ownship uses a copy of daa (only its configuration is used), computed
+   * on up to nthreads threads (see setNumberOfThreads)
+   */
+  explicit DaidalusSector(const Daidalus& daa, int nthreads = 1);
+
+  /** Set the configuration of every ownship. The Daidalus objects of previous cycles are discarded. */
+  void setDaidalus(const Daidalus& daa);
+
+  /** Configuration used for every ownship */
+  const Daidalus& getDaidalus() const;
+
+  /**
+   * Use up to n threads. The default, 1, computes on the calling thread. If n <= 0, all hardware
+   * threads are used. Threads are started by every call to compute.
+   */
+  void setNumberOfThreads(int n);
+
+  int getNumberOfThreads() const;
+
+  /** Remove all aircraft from the traffic picture, and the results. Hysteresis of the ownships is kept. */
+  void clear();
+
+  /**
+   * Add an aircraft to the traffic picture
+   * @param id Aircraft's identifier
+   * @param pos Aircraft's position
+   * @param vel Aircraft's ground velocity
+   * @param time Time stamp of aircraft's state
+   * @param isOwnship True if alerting and bands are computed for this aircraft
+   * @return Aircraft's index in the sector, -1 if an aircraft with the same identifier was already added
+   */
+  int addAircraft(const std::string& id, const Position& pos, const Velocity& vel, double time, bool isOwnship);
+
+  /** Add an aircraft to the traffic picture as an ownship */
+  int addAircraft(const std::string& id, const Position& pos, const Velocity& vel, double time);
+
+  int numberOfAircraft() const;
+
+  const std::string& getAircraftId(int ac) const;
+
+  /** Index of aircraft with given identifier, -1 if it is not in the sector */
+  int aircraftIndex(const std::string& id) const;
+
+  /** True if alerting and bands are computed for aircraft ac */
+  bool isOwnship(int ac) const;
+
+  /**
+   * Compute alerting and bands of all ownships at given time. The Daidalus objects of ownships
+   * that are no longer in the sector are discarded.
+   */
+  void compute(double time);
+
+  /** Time of the last computation */
+  double getCurrentTime() const;
+
+  /**
+   * Alert level of aircraft ac for ownship own (both are aircraft indices). Returns -1 if own is not
+   * an ownship, ac is own, or ac is not a valid intruder of own.
+   */
+  int alertLevel(int own, int ac) const;
+
+  /** Number of horizontal direction bands of ownship own, 0 if own is not an ownship */
+  int horizontalDirectionBandsLength(int own) const;
+
+  /** Horizontal direction interval i of ownship own, in internal units [rad] */
+  Interval horizontalDirectionIntervalAt(int own, int i) const;
+
+  BandsRegion::Region horizontalDirectionRegionAt(int own, int i) const;
+
+  /** Number of horizontal speed bands of ownship own, 0 if own is not an ownship */
+  int horizontalSpeedBandsLength(int own) const;
+
+  /** Horizontal speed interval i of ownship own, in internal units [m/s] */
+  Interval horizontalSpeedIntervalAt(int own, int i) const;
+
+  BandsRegion::Region horizontalSpeedRegionAt(int own, int i) const;
+
+  /** Number of vertical speed bands of ownship own, 0 if own is not an ownship */
+  int verticalSpeedBandsLength(int own) const;
+
+  /** Vertical speed interval i of ownship own, in internal units [m/s] */
+  Interval verticalSpeedIntervalAt(int own, int i) const;
+
+  BandsRegion::Region verticalSpeedRegionAt(int own, int i) const;
+
+  /** Number of altitude bands of ownship own, 0 if own is not an ownship */
+  int altitudeBandsLength(int own) const;
+
+  /** Altitude interval i of ownship own, in internal units [m] */
+  Interval altitudeIntervalAt(int own, int i) const;
+
+  BandsRegion::Region altitudeRegionAt(int own, int i) const;
+
+private:
+  // Bands of all ownships: the bands of ownship row k are [offset[k],offset[k+1])
+  struct SectorBands {
+    std::vector<int> offset;
+    std::vector<Interval> interval;
+    std::vector<BandsRegion::Region> region;
+    void clear();
+    void add(const std::vector<Interval>& ints, const std::vector<BandsRegion::Region>& regs);
+    int length(int row) const;
+  };
+
+  // Output of one ownship, filled by a worker thread
+  struct OwnshipResult {
+    std::vector<Interval> ints[4];
+    std::vector<BandsRegion::Region> regs[4];
+  };
+
+  void computeOwnship(int row, Daidalus& daa, OwnshipResult& res);
+
+  Daidalus daa_;
+  int nthreads_;
+  double time_;
+  std::vector<std::string> ids_;
+  std::vector<Position> pos_;
+  std::vector<Velocity> vel_;
+  std::vector<double> times_;
+  std::vector<int> row_;                 // row of each aircraft in the results, -1 if it's not an ownship
+  std::vector<int> ownships_;            // aircraft index of each row
+  std::map<std::string,int> index_;      // aircraft index by identifier
+  std::map<std::string,Daidalus> own_;   // Daidalus object of each ownship, kept across cycles
+  std::vector<Position> cur_pos_;        // positions projected to the time of the last computation
+  std::vector<int> alerts_;              // alert level by row and aircraft index
+  SectorBands bands_[4];                 // direction, horizontal speed, vertical speed, altitude
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * DelimiterPattern
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef DELIMITERPATTERN_H_
+#define DELIMITERPATTERN_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace larcfm {
+
+/**
+ * A regular expression that separates fields, compiled once for repeated splitting.
+ * Splitting gives the same fields as split_regex() with the same pattern, without compiling
+ * the expression for every line. Patterns that are a bracket expression of plain characters
+ * followed by "+", e.g., "[\t ,;]+", are matched as a set of characters, without the
+ * regular expression engine. Copies share the compiled expression.
+ */
+class DelimiterPattern {
+public:
+	/** A pattern that never matches, i.e., lines are not split */
+	DelimiterPattern();
+
+	/** Compile the given regular expression. Use valid() to check that it compiled. */
+	explicit DelimiterPattern(const std::string& rgx);
+
+	/** True if the regular expression compiled */
+	bool valid() const;
+
+	/** The regular expression of this pattern */
+	const std::string& pattern() const;
+
+	/**
+	 * Split str into fields. The strings already in fields are reused, so that repeated
+	 * calls with the same vector do not allocate once the vector has grown to its working size.
+	 */
+	void split(const std::string& str, std::vector<std::string>& fields) const;
+
+	/** Split str into fields */
+	std::vector<std::string> split(const std::string& str) const;
+
+private:
+	class Regex;
+
+	// Bounds [begin,end) of the first non-empty match at or after pos, false if there is none
+	bool find(const std::string& str, std::size_t pos, std::size_t& begin, std::size_t& end) const;
+
+	std::string rgx_;
+	std::string charset_;                  // characters of a "[...]+" pattern, empty otherwise
+	std::shared_ptr<const Regex> regex_;   // compiled expression, null for character sets
+	bool valid_;
+};
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2015-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef DETECTIONDISPATCH_H_
+#define DETECTIONDISPATCH_H_
+
+#include "Detection3D.h"
+#include "TrafficState.h"
+
+namespace larcfm {
+
+/**
+ * Conflict and violation checks of a Detection3D object, with the concrete class of the detector resolved
+ * once, when the dispatch is created, rather than through virtual calls for every check. WCV_TAUMOD, WCV_TCPA,
+ * CDCylinder, TCAS3D, and WCV_TAUMOD_SUM are checked by code instantiated for each class, that computes the
+ * interval of loss of separation and nothing else. Any other detector, including subclasses of these
+ * classes, goes through the virtual Detection3D interface.
+ *
+ * The answers are the same as Detection3D::conflictWithTrafficState and violationAtWithTrafficState. The
+ * detector must outlive the dispatch.
+ */
+class DetectionDispatch {
+public:
+  /** Dispatch for no detector, it must not be used for checks */
+  DetectionDispatch();
+
+  explicit DetectionDispatch(const Detection3D* det);
+
+  const Detection3D* getDetector() const;
+
+  /** Same as getDetector()->conflictWithTrafficState(ownship,intruder,B,T) */
+  bool conflictWithTrafficState(const TrafficState& ownship, const TrafficState& intruder, double B, double T) const;
+
+  /** Same as getDetector()->violationAtWithTrafficState(ownship,intruder,t) */
+  bool violationAtWithTrafficState(const TrafficState& ownship, const TrafficState& intruder, double t) const;
+
+private:
+  enum Kind { GENERIC, WCV_TAUMOD_KIND, WCV_TCPA_KIND, CDCYLINDER_KIND, TCAS3D_KIND, WCV_TAUMOD_SUM_KIND };
+
+  // Detection3D::conflictWithTrafficState, with the loss interval computed by class D
+  template <class D>
+  static bool conflict(const D& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T);
+
+  const Detection3D* det_;
+  Kind kind_;
+};
+
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "Position.h"
 #include "Point.h"
 #include "Util.h"
+#include <vector>
 
 namespace larcfm {
 
@@ -41,6 +42,12 @@ namespace larcfm {
     double projAlt;
     Vect3 ref;
     LatLonAlt llaRef;
+    // rows of the rotation taking ref to the x axis, computed once per projection
+    Vect3 xmult;
+    Vect3 ymult;
+    Vect3 zmult;
+
+    void initRotation();
  
   public:
 
@@ -100,6 +107,15 @@ namespace larcfm {
     
     /** Return a LatLonAlt value corresponding to the given Euclidean position */
     LatLonAlt inverse(const Vect3& xyz) const; 
+
+    /** Projections of many points, out[i] = project(lla[i]). out is resized to lla.size(). */
+    void project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const;
+
+    /** Projections of many points, out[i] = project(sip[i]). out is resized to sip.size(). */
+    void project(const std::vector<Position>& sip, std::vector<Vect3>& out) const;
+
+    /** Inverses of many points, out[i] = inverse(xyz[i]). out is resized to xyz.size(). */
+    void inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const;
     
     /** Given a velocity from a point in geodetic coordinates, return a projection of this velocity in Euclidean 3-space 
      * Note that, due to the distortions introduced by this projection, the projected track and ground speed may change as distance from the projection point increases!
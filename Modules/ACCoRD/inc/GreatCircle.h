@@ -22,6 +22,7 @@
 #include "Velocity.h"
 #include "LatLonAlt.h"
 #include "Triple.h"
+#include <vector>
 
 
 namespace larcfm {
@@ -127,6 +128,16 @@ namespace larcfm {
 	 */
   static double distance(const LatLonAlt& p1, const LatLonAlt& p2);
 
+	/**
+	 * Compute the great circle distances from one point to many points, i.e., dist[i] = distance(p1,p2[i]).
+	 * The trigonometric functions of p1 are computed once.
+	 * 
+	 * @param p1 one point
+	 * @param p2 other points
+	 * @param dist distances, resized to p2.size()
+	 */
+  static void distance(const LatLonAlt& p1, const std::vector<LatLonAlt>& p2, std::vector<double>& dist);
+
 	/**
 	 * Determines if two points are close to each other, see
 	 * Constants.get_horizontal_accuracy().
@@ -201,6 +212,16 @@ namespace larcfm {
 	 */
   static double initial_course(const LatLonAlt& p1, const LatLonAlt& p2);
 
+	/**
+	 * The initial true courses from one point to many points, i.e., course[i] = initial_course(p1,p2[i]).
+	 * The trigonometric functions of p1 are computed once.
+	 * 
+	 * @param p1 a point
+	 * @param p2 other points
+	 * @param course initial courses, resized to p2.size()
+	 */
+  static void initial_course(const LatLonAlt& p1, const std::vector<LatLonAlt>& p2, std::vector<double>& course);
+
 	/**
 	 * <p>Course of the great circle coming in from point #1 to point #2.  This
 	 * value is NOT a compass angle (in the 0 to 2 Pi range), but is in radians 
@@ -569,6 +590,17 @@ public:
 	 */
   static LatLonAlt linear_initial(const LatLonAlt& s, double track, double dist);
 
+	/**
+	 * Find many points from the given lat/lon ('s'), i.e., out[i] = linear_initial(s,track[i],dist[i]).
+	 * The trigonometric functions of s are computed once.
+	 * 
+	 * @param s     a position
+	 * @param track initial courses coming from point s
+	 * @param dist  distances from point s [m], same size as track
+	 * @param out   new positions, resized to the smaller of track.size() and dist.size()
+	 */
+  static void linear_initial(const LatLonAlt& s, const std::vector<double>& track, const std::vector<double>& dist, std::vector<LatLonAlt>& out);
+
 	/**
 	 * <p>This function forms a great circle from p1 to p2, then computes 
 	 * the shortest distance of another point (offCircle) to the great circle.  This is the 
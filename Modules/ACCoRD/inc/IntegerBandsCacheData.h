@@ -0,0 +1,91 @@
+/*
+ * Cached integer bands contributed by an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef INTEGERBANDSCACHEDATA_H_
+#define INTEGERBANDSCACHEDATA_H_
+
+#include "TrafficState.h"
+#include "SUMData.h"
+#include "Integerval.h"
+#include <string>
+#include <vector>
+
+namespace larcfm {
+
+class IntegerBandsCacheData {
+public:
+  /*
+   * Inputs of the integer bands of one alert level, other than aircraft states and parameters
+   */
+  struct BandsInput {
+    int    epsh;    // Horizontal epsilon for implicit coordination
+    int    epsv;    // Vertical epsilon for implicit coordination
+    double B;       // Start of time interval
+    double T;       // End of time interval
+    double tstep;   // Time step of kinematic bands, 0 for instantaneous bands
+    int    maxdown; // Number of steps below (or left of) the current value
+    int    maxup;   // Number of steps above (or right of) the current value
+    double min_val; // Absolute min value of the bands
+    double max_val; // Absolute max value of the bands
+
+    bool operator==(const BandsInput& input) const;
+  };
+
+  /*
+   * Creates an empty object
+   */
+  IntegerBandsCacheData();
+
+  /*
+   * Returns true if cached values were computed for the given ownship and intruder states,
+   * including their uncertainties (SUM data), and alerter index. Ownship maneuvers are
+   * computed from its unprojected state, so that state is part of the key as well.
+   */
+  bool isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx) const;
+
+  /*
+   * Clear cached values and set the states and alerter index they depend on
+   */
+  void reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx);
+
+  /*
+   * Returns true if the integer bands of given alert level are cached for the given input
+   */
+  bool hasIntegerBands(int alert_level, const BandsInput& input) const;
+
+  /*
+   * Returns cached integer bands of given alert level. Requires hasIntegerBands(alert_level,input)
+   */
+  const std::vector<Integerval>& getIntegerBands(int alert_level) const;
+
+  void setIntegerBands(int alert_level, const BandsInput& input, const std::vector<Integerval>& bands);
+
+  std::string toString() const;
+
+  virtual ~IntegerBandsCacheData() {};
+
+private:
+  Position own_pos_;
+  Velocity own_vel_;
+  Vect3    own_s_;
+  Velocity own_v_;
+  SUMData  own_sum_;
+  Vect3    ac_s_;
+  Velocity ac_v_;
+  SUMData  ac_sum_;
+  int      alerter_idx_;
+  std::vector<BandsInput> inputs_; // Indexed by alert level - 1
+  std::vector<std::vector<Integerval> > bands_;
+  std::vector<bool> computed_;
+
+  static bool samePosition(const Position& p1, const Position& p2);
+};
+
+}
+#endif
@@ -49,13 +49,14 @@ namespace larcfm {
  * }
  * </code></pre><p>
  *
- * The current implementation does not allocate any dynamic (heap) memory.
+ * The first inline_intervals intervals are stored within the object. Larger sets
+ * spill to the heap.
  */
 class IntervalSet {// : ErrorReporter {
 
 public:
-	/** The maximum number of intervals */
-	static const int max_intervals = 400;
+	/** The number of intervals stored without heap allocation */
+	static const int inline_intervals = 8;
 
 public:
 	/** Construct an empty IntervalSet */
@@ -66,6 +67,17 @@ public:
 	 * */ 
 	IntervalSet(const IntervalSet& l);
 
+	/** Move the IntervalSet into a new set, l is left empty
+	 * @param l IntervalSet to move
+	 * */
+	IntervalSet(IntervalSet&& l) noexcept;
+
+	IntervalSet& operator=(const IntervalSet& l);
+
+	IntervalSet& operator=(IntervalSet&& l) noexcept;
+
+	~IntervalSet();
+
 	/** Build an IntervalSet from the given vector */
 	explicit IntervalSet(const std::vector<Interval>& v);
 
@@ -223,10 +235,14 @@ private:
 	void insert(int i, const Interval& r);
 	void remove(int i);
 	void remove(int i, int len);
+	void reserve(int n);
+	void append(const Interval& r);
 
 	static const Interval empty;
-	Interval r[max_intervals];
+	Interval* r;       // points to buf or to heap storage
 	int length;
+	int capacity;
+	Interval buf[inline_intervals];
 };
 
 }
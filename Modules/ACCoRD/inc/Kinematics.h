@@ -17,6 +17,7 @@
 #include "Tuple5.h"
 #include "StateVector.h"
 #include "Triple.h"
+#include <vector>
 
 
 namespace larcfm {
@@ -218,6 +219,27 @@ public:
 	 */
 	static std::pair<Vect3,Velocity> turnOmega(const Vect3& s0, const Velocity& v0, double t, double omega);
 
+	/**
+	 * Position/Velocity after turning t0, t0+dt, ..., t0+(n-1)*dt time units according to track rate omega,
+	 * i.e., pos[i],vel[i] is turnOmega(s0,v0,t0+i*dt,omega) up to the rounding of the track change.  The
+	 * sample track changes are composed of a table of rotations by omega*j*dt (j < about sqrt(n)) and a
+	 * rotation to the start of each block of samples, so only about 2*sqrt(n) sines and cosines are
+	 * computed. The samples within a block are independent of each other. Velocities are within a few
+	 * ulps of gs*(1+|omega*t|) of the per-sample ones, and positions within a few ulps of
+	 * |s0|+gs/|omega|*(1+|omega*t|).
+	 *
+	 * @param s0          starting position
+	 * @param v0          initial velocity
+	 * @param t0          time of the first sample
+	 * @param dt          time between samples
+	 * @param n           number of samples
+	 * @param omega       rate of change of track, sign indicates direction
+	 * @param pos         positions, resized to n
+	 * @param vel         velocities, resized to n
+	 */
+	static void turnOmega(const Vect3& s0, const Velocity& v0, double t0, double dt, int n, double omega,
+			std::vector<Vect3>& pos, std::vector<Velocity>& vel);
+
 
 	static Vect2 center(const Vect3& s0, const Velocity& v0, double omega);
 
@@ -519,6 +541,23 @@ public:
 	 */
 	static std::pair<Vect3,Velocity> gsAccel(const Vect3& so3, const Velocity& vo3,  double t, double a);
 
+	/**
+	 * Position/Velocity after a constant GS acceleration for t0, t0+dt, ..., t0+(n-1)*dt seconds,
+	 * i.e., pos[i],vel[i] is gsAccel(so3,vo3,t0+i*dt,a).  The ground speed and direction of vo3 are
+	 * computed once.
+	 *
+	 * @param so3        current position
+	 * @param vo3        current velocity
+	 * @param t0         time of the first sample
+	 * @param dt         time between samples
+	 * @param n          number of samples
+	 * @param a          acceleration,  i.e. a positive  or negative acceleration
+	 * @param pos        positions, resized to n
+	 * @param vel        velocities, resized to n
+	 */
+	static void gsAccel(const Vect3& so3, const Velocity& vo3, double t0, double dt, int n, double a,
+			std::vector<Vect3>& pos, std::vector<Velocity>& vel);
+
 	/**
 	 * returns time required to accelerate to target ground speed GoalGs
 	 *
@@ -676,6 +715,22 @@ public:
 
 	static std::pair<Vect3,Velocity> vsAccel(const std::pair<Vect3,Velocity>& sv0,  double t, double a);
 
+	/**
+	 * Position/Velocity after a constant vertical speed acceleration for t0, t0+dt, ..., t0+(n-1)*dt seconds,
+	 * i.e., pos[i],vel[i] is vsAccel(so3,vo3,t0+i*dt,a).
+	 *
+	 * @param so3        current position
+	 * @param vo3        current velocity
+	 * @param t0         time of the first sample
+	 * @param dt         time between samples
+	 * @param n          number of samples
+	 * @param a          acceleration,  i.e. a positive  or negative acceleration
+	 * @param pos        positions, resized to n
+	 * @param vel        velocities, resized to n
+	 */
+	static void vsAccel(const Vect3& so3, const Velocity& vo3, double t0, double dt, int n, double a,
+			std::vector<Vect3>& pos, std::vector<Velocity>& vel);
+
 	/**
 	 * returns time required to vertically accelerate to target GoalVS
 	 *
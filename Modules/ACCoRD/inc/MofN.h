@@ -12,8 +12,8 @@
 #ifndef MOFN_H_
 #define MOFN_H_
 
-#include <deque>
 #include <string>
+#include <vector>
 
 namespace larcfm {
 
@@ -70,7 +70,12 @@ private:
   int m_;
   int n_;
   int    max_;
-  std::deque<int> queue_;
+  // Last n values, in a ring buffer where the oldest value is at head_
+  std::vector<int> queue_;
+  int head_;
+
+  // k-th oldest value, 0 <= k < n
+  int at(int k) const;
 
 };
 
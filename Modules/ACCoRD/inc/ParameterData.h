@@ -14,6 +14,8 @@
 #include "format.h"
 #include "string_util.h"
 #include "ParameterEntry.h"
+#include "ParameterKey.h"
+#include "ParameterStore.h"
 #include "Function.h"
 #include <string>
 #include <iostream>
@@ -228,6 +230,19 @@ public:
 	 * @return long representation of parameter
 	 */
 	long getLong(const std::string& key) const;
+
+	/** Returns true if the parameter key was defined. The key is resolved without string operations. */
+	bool contains(const ParameterKey& key) const;
+	/** Same as getString(key.name()), the key is resolved without string operations */
+	std::string getString(const ParameterKey& key) const;
+	/** Same as getValue(key.name()), the key is resolved without string operations */
+	double getValue(const ParameterKey& key) const;
+	/** Same as getUnit(key.name()), the key is resolved without string operations */
+	std::string getUnit(const ParameterKey& key) const;
+	/** Same as getBool(key.name()), the key is resolved without string operations */
+	bool getBool(const ParameterKey& key) const;
+	/** Same as getInt(key.name()), the key is resolved without string operations */
+	int getInt(const ParameterKey& key) const;
 	/**
 	 * Parses the given string as a parameter assignment. If successful, returns
 	 * a true value and adds the parameter. Otherwise returns a false value and
@@ -581,7 +596,7 @@ private:
 	bool preserveUnits;
 	bool unitCompatibility;
 	std::string listPatternStr;
-	typedef std::map<std::string, ParameterEntry, stringCaseInsensitive> paramtype;
+	typedef ParameterStore paramtype;
 	paramtype parameters;
 
 	class comp_order {
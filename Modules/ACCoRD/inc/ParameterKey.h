@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2014-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef PARAMETERKEY_H_
+#define PARAMETERKEY_H_
+
+#include <string>
+#include <cstddef>
+
+namespace larcfm {
+
+/**
+ * An interned, case insensitive parameter key. The key is lowercased and hashed once, when
+ * the handle is constructed, and all handles for the same key share the same id. Looking up
+ * a ParameterKey in a ParameterData does not hash the key again. Constructing a handle takes
+ * a global lock and interned keys are never released, so handles are meant to be built once,
+ * e.g., as static objects, and used in repeated reads:
+ *
+ * <pre>
+ * static const ParameterKey LOOKAHEAD_TIME("lookahead_time");
+ * double t = p.getValue(LOOKAHEAD_TIME);
+ * </pre>
+ */
+class ParameterKey {
+public:
+	explicit ParameterKey(const std::string& key);
+
+	/** Unique id of this key. Keys that only differ in case have the same id. */
+	int id() const;
+
+	/** Case insensitive hash of this key */
+	std::size_t hash() const;
+
+	/** Lowercase name of this key */
+	const std::string& name() const;
+
+	bool operator==(const ParameterKey& k) const;
+	bool operator!=(const ParameterKey& k) const;
+
+	/** Case insensitive hash of a string, equal to ParameterKey(key).hash() */
+	static std::size_t hashOf(const std::string& key);
+
+	/** Case insensitive string equality */
+	static bool equals(const std::string& s1, const std::string& s2);
+
+	/** Number of interned keys */
+	static int count();
+
+private:
+	int id_;
+	std::size_t hash_;
+	const std::string* name_;
+};
+
+} /* namespace larcfm */
+
+#endif /* PARAMETERKEY_H_ */
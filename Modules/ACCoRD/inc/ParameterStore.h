@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2014-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef PARAMETERSTORE_H_
+#define PARAMETERSTORE_H_
+
+#include "ParameterEntry.h"
+#include "ParameterKey.h"
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace larcfm {
+
+/**
+ * Storage of the entries of a ParameterData. Keys are case insensitive, but are stored with the
+ * capitalization used when they were first inserted. Entries are kept in a vector and are found
+ * through an open addressed (linear probing) hash table. A ParameterKey carries its hash, so
+ * finding it costs a probe and a single string comparison.
+ *
+ * The interface follows the subset of std::map used by ParameterData, but entries are not kept
+ * in key order: erase moves the last entry into the erased position. Iterators are invalidated by
+ * insertions and removals.
+ */
+class ParameterStore {
+public:
+	typedef std::pair<std::string, ParameterEntry> value_type;
+	typedef std::vector<value_type>::iterator iterator;
+	typedef std::vector<value_type>::const_iterator const_iterator;
+
+	ParameterStore();
+
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+
+	std::size_t size() const;
+	void clear();
+
+	iterator find(const std::string& key);
+	const_iterator find(const std::string& key) const;
+	iterator find(const ParameterKey& key);
+	const_iterator find(const ParameterKey& key) const;
+
+	/** Entry for key, a default entry is inserted if key is not in the store */
+	ParameterEntry& operator[](const std::string& key);
+
+	void erase(iterator pos);
+
+private:
+	int index(const std::string& key, std::size_t hash) const;
+	std::size_t slot_of(int i) const;
+	void insert_slot(int i);
+	void remove_slot(std::size_t s);
+	void rehash(std::size_t capacity);
+
+	std::vector<value_type> entries_;
+	std::vector<std::size_t> hashes_; // case insensitive hash of each entry
+	std::vector<int> slots_;          // hash table of entry indices, -1 if empty. Size is a power of 2
+};
+
+} /* namespace larcfm */
+
+#endif /* PARAMETERSTORE_H_ */
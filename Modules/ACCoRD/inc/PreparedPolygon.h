@@ -0,0 +1,143 @@
+/*
+ * PreparedPolygon - a polygon prepared for repeated Polycarp containment queries
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef PREPAREDPOLYGON_H_
+#define PREPAREDPOLYGON_H_
+
+#include "Vect2.h"
+#include "Vect3.h"
+#include "Poly3D.h"
+#include "SimplePoly.h"
+#include "EuclideanProjection.h"
+#include "BoundingRectangle.h"
+#include <vector>
+
+namespace larcfm {
+
+/**
+ * A 3D polygon prepared once for many Polycarp containment queries and geometric tests. The vertices are
+ * copied, checked for "niceness" (and reversed if they are clockwise, as Polycarp3D does), and the edge
+ * vectors, outward edge normals, bounding rectangle, convexity and centroid are computed when the polygon
+ * is built, rather than for every point tested. A geofence that does not move can be prepared once and
+ * used in every monitoring cycle, as long as the projection does not change.
+ *
+ * The answers are the same as Polycarp3D::definitely_inside(), definitely_outside() and nearEdge()
+ * with the same buffer and checkNice flag. Points more than three buffers to the left or right of
+ * the bounding rectangle are answered without looking at the edges, points that are not near any
+ * vertex need no "fixed" copy of the polygon.
+ */
+class PreparedPolygon {
+public:
+	/** An empty polygon, it is not nice */
+	PreparedPolygon();
+
+	/**
+	 * Prepare polygon p for queries with horizontal and vertical buffer buff
+	 * @param p polygon
+	 * @param buff buffer distance
+	 * @param checkNice if true, check that the polygon is nice, reversing the vertex order if necessary.
+	 *        If false, the polygon is assumed to be nice.
+	 */
+	PreparedPolygon(const Poly3D& p, double buff, bool checkNice);
+
+	/**
+	 * Prepare polygon p, projected with proj if it is in latitude/longitude
+	 * @param p polygon
+	 * @param proj projection used if p is in latitude/longitude
+	 * @param buff buffer distance
+	 * @param checkNice if true, check that the polygon is nice, reversing the vertex order if necessary.
+	 */
+	PreparedPolygon(const SimplePoly& p, const EuclideanProjection& proj, double buff, bool checkNice);
+
+	/** False if the polygon failed the niceness check, all containment queries are then false */
+	bool isNice() const;
+
+	double getBuff() const;
+	double getBottom() const;
+	double getTop() const;
+
+	/** The polygon as given, i.e., not reversed */
+	const Poly3D& poly3D() const;
+
+	/** Vertices, in counterclockwise order if checkNice was set */
+	const std::vector<Vect2>& getVertices() const;
+
+	/** Number of vertices (and edges) */
+	int size() const;
+
+	/** Edge from vertex i to vertex i+1 (to vertex 0 for the last edge), as a vector */
+	const Vect2& edge(int i) const;
+
+	/** Unit normal of edge i pointing out of the polygon, zero for an edge of zero length */
+	const Vect2& edgeNormal(int i) const;
+
+	/** Smallest rectangle containing all vertices */
+	const BoundingRectangle& getBoundingRectangle() const;
+
+	/** True if no two consecutive edges turn in opposite directions */
+	bool isConvex() const;
+
+	/** Centroid of the horizontal polygon, as Poly2D::centroid() */
+	const Vect2& centroid() const;
+
+	/** True if so is definitely inside the polygon, as Polycarp3D::definitely_inside() */
+	bool definitelyInside(const Vect3& so) const;
+
+	/** True if so is definitely outside the polygon, as Polycarp3D::definitely_outside() */
+	bool definitelyOutside(const Vect3& so) const;
+
+	/**
+	 * True if so is within the buffer of an edge, or vertically within v of the top or bottom,
+	 * as Polycarp3D::nearEdge() with h = getBuff()
+	 */
+	bool nearEdge(const Vect3& so, double v) const;
+
+	/**
+	 * True if so is within h of an edge, or vertically within v of the top or bottom, as Polycarp3D::nearEdge().
+	 * If the polygon was prepared with checkNice and h is not the buffer, the niceness depends on h and this
+	 * is answered by Polycarp3D::nearEdge().
+	 */
+	bool nearEdge(const Vect3& so, double h, double v) const;
+
+	/** ans[i] = definitelyInside(so[i]). ans is resized to so.size(). */
+	void definitelyInside(const std::vector<Vect3>& so, std::vector<bool>& ans) const;
+
+	/** ans[i] = definitelyOutside(so[i]). ans is resized to so.size(). */
+	void definitelyOutside(const std::vector<Vect3>& so, std::vector<bool>& ans) const;
+
+	/** ans[i] = nearEdge(so[i],v). ans is resized to so.size(). */
+	void nearEdge(const std::vector<Vect3>& so, double v, std::vector<bool>& ans) const;
+
+private:
+	void prepare(bool checkNice);
+	// True if s is so far left or right of the polygon that it is outside and not near any edge
+	bool farAway(const Vect2& s, double BUFF) const;
+	// True if fix_polygon() would move a vertex for s
+	bool needsFix(const Vect2& s, double BUFF) const;
+	// PolycarpContain::near_any_edge() on the vertices, using the stored edge vectors
+	bool nearAnyEdge(const Vect2& s, double BUFF) const;
+	bool inside2D(const Vect2& s, double BUFF) const;
+	bool outside2D(const Vect2& s, double BUFF) const;
+
+	Poly3D poly;
+	std::vector<Vect2> vertices;
+	std::vector<Vect2> edges;   // vertices[i+1]-vertices[i], the last edge closes the polygon
+	std::vector<double> sqlen;  // squared length of each edge
+	std::vector<Vect2> normals; // outward unit normal of each edge
+	BoundingRectangle rect;
+	Vect2 center;
+	double buff;
+	bool checked;               // niceness was checked with buff
+	bool nice;
+	bool convex;
+};
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * ProjectionArrays.h
+ *
+ * Array versions of project and inverse, shared by the projection classes.
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef PROJECTIONARRAYS_H_
+#define PROJECTIONARRAYS_H_
+
+#include "Vect3.h"
+#include "LatLonAlt.h"
+#include <vector>
+
+namespace larcfm {
+
+/** Projections of many points with the given projection, out[i] = proj.project(in[i]). out is resized to in.size(). */
+template <typename Proj, typename Point>
+void projectAll(const Proj& proj, const std::vector<Point>& in, std::vector<Vect3>& out) {
+  out.resize(in.size());
+  for (int i = 0; i < (int) in.size(); i++) {
+    out[i] = proj.project(in[i]);
+  }
+}
+
+/** Inverses of many points with the given projection, out[i] = proj.inverse(xyz[i]). out is resized to xyz.size(). */
+template <typename Proj>
+void inverseAll(const Proj& proj, const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) {
+  out.resize(xyz.size());
+  for (int i = 0; i < (int) xyz.size(); i++) {
+    out[i] = proj.inverse(xyz[i]);
+  }
+}
+
+}
+
+#endif /* PROJECTIONARRAYS_H_ */
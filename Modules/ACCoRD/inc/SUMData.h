@@ -133,6 +133,11 @@ public:
    */
   bool is_SUM() const;
 
+  /**
+   * Check if both objects have exactly the same uncertainties
+   */
+  bool equals(const SUMData& sum) const;
+
 };
 }
 #endif
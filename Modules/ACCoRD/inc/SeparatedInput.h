@@ -18,6 +18,7 @@
 #include "ErrorReporter.h"
 #include "ParameterReader.h"
 #include "Quad.h"
+#include "DelimiterPattern.h"
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -257,6 +258,22 @@ namespace larcfm {
 	 */
 	double getColumn(int i, const std::string& default_unit) const;
 
+	/**
+	 * Returns the value of the given column (as a double) in internal units.  If
+	 * no units were specified in the file, then this value is assumed to be
+	 * in the given default units, e.g., unit::deg.
+	 * @param i column index
+	 * @param default_unit unit, if none is specified
+	 * @return value of column
+	 */
+	template <typename D>
+	double getColumn(int i, const UnitSymbol<D>& default_unit) const {
+		if (!unitSpecified(i)) {
+			return default_unit.from(getColumn(i, 0.0, true));
+		}
+		return getColumn(i, 0.0, true);
+	}
+
 
 	/**
 	 * Returns the value of the given column (as a double) in internal units.
@@ -329,6 +346,9 @@ namespace larcfm {
     bool caseSensitive;
     
     std::string patternStr;
+    DelimiterPattern pattern;  // compiled patternStr
+
+    std::string line_buf;      // line being processed, reused between lines
     
     std::string preambleImage;
 
@@ -338,12 +358,13 @@ namespace larcfm {
     ParameterData parameters;
     
     double getUnitFactor(int i) const;
+    bool unitSpecified(int i) const;
     bool process_units(const std::string& str);
     bool process_preamble(std::string str);
     void process_line(const std::string& str);
 	
     std::vector<std::string> processQuotes(const std::string& str) const; 
-	std::string readFullLine(std::istream* reader);  
+	void readFullLine(std::istream* reader, std::string& line);
   };
 }
 
@@ -148,6 +148,18 @@ public:
 	Velocity getSequenceVelocity(const std::string& name, double time);
 
 
+	/**
+	 * Returns the names, positions, and velocities of the aircraft that have an entry at the given time,
+	 * in the order they first appear in the file. These are the states of the active set for a window
+	 * of size 1 at that time, but the active set is not modified, so this method may be called
+	 * concurrently from several threads.
+	 * @param time
+	 * @param acNames names of the aircraft
+	 * @param positions positions of the aircraft
+	 * @param velocities velocities of the aircraft
+	 */
+	void getSequenceEntry(double time, std::vector<std::string>& acNames, std::vector<Position>& positions, std::vector<Velocity>& velocities) const;
+
 	/** sets a particular entry without reading in from a file 
 	 * @param time 
 	 * @param name 
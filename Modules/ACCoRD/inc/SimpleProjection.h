@@ -18,6 +18,7 @@
 #include "Velocity.h"
 #include "Position.h"
 #include "Util.h"
+#include <vector>
 #include "Point.h"
 
 namespace larcfm {
@@ -109,6 +110,15 @@ namespace larcfm {
     
     /** Return a LatLonAlt value corresponding to the given Euclidean position */
     LatLonAlt inverse(const Vect3& xyz) const; 
+
+    /** Projections of many points, out[i] = project(lla[i]). out is resized to lla.size(). */
+    void project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const;
+
+    /** Projections of many points, out[i] = project(sip[i]). out is resized to sip.size(). */
+    void project(const std::vector<Position>& sip, std::vector<Vect3>& out) const;
+
+    /** Inverses of many points, out[i] = inverse(xyz[i]). out is resized to xyz.size(). */
+    void inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const;
     
     /** Given a velocity from a point in geodetic coordinates, return a projection of this velocity in Euclidean 3-space */
     Velocity projectVelocity(const LatLonAlt& lla, const Velocity& v) const;
@@ -75,6 +75,10 @@ private:
    */
   void applyEuclideanProjection();
 
+  // Set state as a new aircraft with the current projection. Position (velocity) is not projected again
+  // if the projection and position (and velocity) didn't change.
+  void updateState(const Position& pos, const Velocity& vel, const Velocity& wind_vector, bool same_frame);
+
 public:
 
   /**
@@ -105,6 +109,24 @@ public:
    */
   TrafficState makeIntruder(const std::string& id, const Position& pos, const Velocity& vel) const;
 
+  /**
+   * Update ownship's position and ground velocity in place, keeping its identifier. The result is the same
+   * as makeOwnship(getId(),pos,vel) followed by applyWindVector(wind_vector), but the projection is only
+   * created again if the ownship's latitude or longitude change, and the state is projected once.
+   * Requires pos to be lat/lon if and only if this aircraft is lat/lon.
+   * @return true if the Euclidean projection changed
+   */
+  bool updateOwnship(const Position& pos, const Velocity& vel, const Velocity& wind_vector);
+
+  /**
+   * Update intruder's position and ground velocity in place, keeping its identifier. The result is the same
+   * as ownship.makeIntruder(getId(),pos,vel) followed by applyWindVector(wind_vector), but the state is
+   * projected once, and, if the ownship's projection didn't change, position and velocity are only projected
+   * again if they change.
+   * @return false, and this aircraft doesn't change, if the resulting aircraft is not valid
+   */
+  bool updateIntruder(const TrafficState& ownship, const Position& pos, const Velocity& vel, const Velocity& wind_vector);
+
   /**
    * Set alerter index for this aircraft
    * @param alerter
@@ -389,6 +389,30 @@ public:
 	 */
 	static Plan makeKinematicPlan(const Plan& fp, double bankAngle, double gsAccel, double vsAccel);
 
+	/**
+	 * Update, in place, a kinematic plan after some points of the linear plan it was generated from have been edited.
+	 * Only the part of the trajectory between the legs that bracket the edited points is regenerated; it is spliced
+	 * into kpc at the middle of these legs, where the trajectory is straight and unaccelerated.  Points after the
+	 * edited window may have been shifted in time and altitude as a whole, e.g., when all remaining altitudes are
+	 * raised, in which case the old kinematic tail is shifted the same way.
+	 *
+	 * If no such legs exist, or if the edit changes the number of points, the whole plan is regenerated with
+	 * makeKinematicPlan.
+	 *
+	 *  @param kpc        kinematic plan generated by makeKinematicPlan(oldLpc, bankAngle, gsAccel, vsAccel, repairTurn, repairGs, repairVs)
+	 *  @param oldLpc     linear plan kpc was generated from
+	 *  @param lpc        edited linear plan
+	 *  @param bankAngle  maximum allowed (and default) bank angle for turns
+	 *  @param gsAccel    maximum allowed (and default) ground speed acceleration (m/s^2)
+	 *  @param vsAccel    maximum allowed (and default) vertical speed acceleration (m/s^2)
+	 *  @param repairTurn attempt to repair infeasible turns as a preprocessing step
+	 *  @param repairGs   attempt to repair infeasible ground speed accelerations
+	 *  @param repairVs   attempt to repair infeasible vertical speed accelerations as a preprocessing step
+	 *  @return true if only a window of kpc was regenerated, false if the whole plan was
+	 */
+	static bool updateKinematicPlan(Plan& kpc, const Plan& oldLpc, const Plan& lpc, double bankAngle, double gsAccel, double vsAccel,
+			bool repairTurn, bool repairGs, bool repairVs);
+
 	/**
 	 * This assumes a plan that has altitude preserve points marked.  Generate the vertical profile (only) for VsTCPs in this plan.
 	 * @param p         input plan (need not be linear)
@@ -407,6 +431,12 @@ public:
 	 * @return
 	 */
 private: static  double directToContinueTime(const Plan& lpc, const Position& so, const Velocity& vo, double to, double bankAngle) ;
+
+	/**
+	 * Time at which kinematic plan kpc passes through pos on a straight, unaccelerated segment.
+	 * Returns false if kpc passes through pos more than once, or not on such a segment.
+	 */
+	static bool unacceleratedTimeAt(const Plan& kpc, const Position& pos, double& t);
 		
 public:
 	/**  *** UNUSED ***
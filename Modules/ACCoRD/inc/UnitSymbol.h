@@ -0,0 +1,123 @@
+/*
+ * UnitSymbol.h
+ *
+ * Compile-time unit conversion factors.
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#ifndef UNITSYMBOL_H_
+#define UNITSYMBOL_H_
+
+#include "Util.h"
+
+namespace larcfm {
+
+/** Dimensions of the typed unit symbols */
+namespace dimension {
+struct Length {};
+struct Time {};
+struct Angle {};
+struct Speed {};
+struct Acceleration {};
+struct AngularSpeed {};
+}
+
+/**
+ * <p>A unit whose conversion factor is known at compile time. The dimension is part of
+ * the type, so a symbol can only be passed where a quantity of that dimension is expected,
+ * e.g., an angle unit cannot be given for a speed.</p>
+ *
+ * <p>The symbols in the namespace larcfm::unit have the same factors as the corresponding
+ * string units, so <code>unit::deg.to(x)</code> returns the same value as
+ * <code>Units::to("deg",x)</code> without looking up the string. Only units defined by a
+ * plain factor are provided, temperatures still go through the Units class.</p>
+ */
+template <typename D>
+class UnitSymbol {
+public:
+	/** Conversion factor to internal units */
+	const double factor;
+	/** String representation of this unit, as understood by the Units class */
+	const char* const symbol;
+
+	constexpr UnitSymbol(double f, const char* s) : factor(f), symbol(s) {}
+
+	/** Convert the value in internal units to this unit */
+	constexpr double to(double value) const {
+		return value / factor;
+	}
+
+	/** Convert the value from this unit into internal units */
+	constexpr double from(double value) const {
+		return value * factor;
+	}
+};
+
+typedef UnitSymbol<dimension::Length> LengthUnit;
+typedef UnitSymbol<dimension::Time> TimeUnit;
+typedef UnitSymbol<dimension::Angle> AngleUnit;
+typedef UnitSymbol<dimension::Speed> SpeedUnit;
+typedef UnitSymbol<dimension::Acceleration> AccelerationUnit;
+typedef UnitSymbol<dimension::AngularSpeed> AngularSpeedUnit;
+
+namespace unit {
+
+/** meter */
+constexpr LengthUnit m(1.0, "m");
+/** kilometer */
+constexpr LengthUnit km(1000.0, "km");
+/** nautical mile */
+constexpr LengthUnit NM(1852.0, "NM");
+/** foot */
+constexpr LengthUnit ft(0.3048, "ft");
+/** statute mile */
+constexpr LengthUnit mi(5280.0 * 0.3048, "mi");
+/** millimeter */
+constexpr LengthUnit mm(0.001, "mm");
+
+/** second */
+constexpr TimeUnit s(1.0, "s");
+/** minute */
+constexpr TimeUnit minute(60.0, "min");
+/** hour */
+constexpr TimeUnit hour(3600.0, "hour");
+/** millisecond */
+constexpr TimeUnit ms(0.001, "ms");
+
+/** radian */
+constexpr AngleUnit rad(1.0, "rad");
+/** degree */
+constexpr AngleUnit deg(M_PI / 180.0, "deg");
+
+/** meters per second */
+constexpr SpeedUnit mps(1.0, "m/s");
+/** kilometers per hour */
+constexpr SpeedUnit kph(1000.0 / 3600.0, "kph");
+/** knot */
+constexpr SpeedUnit knot(1852.0 / 3600.0, "knot");
+/** feet per minute */
+constexpr SpeedUnit fpm(0.3048 / 60.0, "fpm");
+/** feet per second */
+constexpr SpeedUnit fps(0.3048, "fps");
+/** miles per hour */
+constexpr SpeedUnit mph(5280.0 * 0.3048 / 3600.0, "mph");
+
+/** meters per second squared */
+constexpr AccelerationUnit meter_per_second2(1.0, "m/s^2");
+/** standard gravity */
+constexpr AccelerationUnit G(9.80665, "G");
+
+/** radians per second */
+constexpr AngularSpeedUnit radian_per_second(1.0, "rad/s");
+/** degrees per second */
+constexpr AngularSpeedUnit degree_per_second(M_PI / 180.0, "deg/s");
+
+}
+
+}
+
+#endif
@@ -16,6 +16,7 @@
 #define UNITS_H_
 
 #include "Util.h"
+#include "UnitSymbol.h"
 #include <string>
 
 namespace larcfm {
@@ -475,6 +476,17 @@ public:
 	static double from(const std::string& units, double value);
 	static double fromInternal(const std::string& defaultUnits, const std::string& units, double value);
 
+	/** Convert the value in internal units to the given units, the conversion factor is resolved at compile time */
+	template <typename D>
+	static constexpr double to(const UnitSymbol<D>& symbol, double value) {
+		return symbol.to(value);
+	}
+	/** Convert the value from the given units into internal units, the conversion factor is resolved at compile time */
+	template <typename D>
+	static constexpr double from(const UnitSymbol<D>& symbol, double value) {
+		return symbol.from(value);
+	}
+
 	/** Get the unit conversion factor for the given string unit */
 	static double getFactor(const std::string& unit);
   /** Determine if the given string is a valid unit
@@ -150,6 +150,13 @@ public:
   bool WCV_taumod_uncertain_detection(double B, double T, const Vect3& s, const Vect3& v,
       double s_err, double sz_err, double v_err, double vz_err) const;
 
+  /**
+   * Interval of loss of well-clear between B and T, taking into account the uncertainty of ownship and
+   * intruder. This is the LossData part of conflictDetectionWithTrafficState, without the time and
+   * distance at closest approach, for callers that only need to know whether there is a conflict.
+   */
+  LossData WCV_taumod_uncertain_loss(const TrafficState& ownship, const TrafficState& intruder, double B, double T) const;
+
   virtual bool contains(const Detection3D* cd) const;
 
   void updateParameterData(ParameterData& p) const;
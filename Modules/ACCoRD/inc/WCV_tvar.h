@@ -14,6 +14,8 @@
 #include "ConflictData.h"
 #include "LossData.h"
 #include "WCV_Vertical.h"
+#include "Horizontal.h"
+#include "Util.h"
 #include <string>
 
 namespace larcfm {
@@ -75,6 +77,17 @@ public:
 
   LossData WCV_interval(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T) const;
 
+  /**
+   * Same as horizontal_WCV and WCV_interval, with horizontal_tvar and horizontal_WCV_interval taken from h
+   * instead of this object. A caller that knows the concrete class of this object can pass an h that calls
+   * these methods without virtual dispatch.
+   */
+  template <class H>
+  bool horizontal_WCV_with(const H& h, const Vect2& s, const Vect2& v) const;
+
+  template <class H>
+  LossData WCV_interval_with(const H& h, const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T) const;
+
   bool containsTable(WCV_tvar* wcv) const;
 
   virtual std::string toString() const;
@@ -105,5 +118,50 @@ public:
   virtual bool equals(Detection3D* o) const;
 
 };
+
+template <class H>
+bool WCV_tvar::horizontal_WCV_with(const H& h, const Vect2& s, const Vect2& v) const {
+  if (s.norm() <= table.getDTHR()) return true;
+  if (Horizontal::dcpa(s,v) <= table.getDTHR()) {
+    double tvar = h.horizontal_tvar(s,v);
+    return 0  <= tvar && tvar <= table.getTTHR();
+  }
+  return false;
+}
+
+// Assumes 0 <= B < T
+template <class H>
+LossData WCV_tvar::WCV_interval_with(const H& h, const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T) const {
+  double time_in = T;
+  double time_out = B;
+
+  Vect2 so2 = so.vect2();
+  Vect2 si2 = si.vect2();
+  Vect2 s2 = so2.Sub(si2);
+  Vect2 vo2 = vo.vect2();
+  Vect2 vi2 = vi.vect2();
+  Vect2 v2 = vo2.Sub(vi2);
+  double sz = so.z-si.z;
+  double vz = vo.z-vi.z;
+
+  Interval ii = wcv_vertical->vertical_WCV_interval(table.getZTHR(),table.getTCOA(),B,T,sz,vz);
+
+  if (ii.low > ii.up) {
+    return LossData(time_in,time_out);
+  }
+  Vect2 step = v2.ScalAdd(ii.low,s2);
+  if (Util::almost_equals(ii.low,ii.up)) { // [CAM] Changed from == to almost_equals to mitigate numerical problems
+    if (horizontal_WCV_with(h,step,v2)) {
+      time_in = ii.low;
+      time_out = ii.up;
+    }
+    return LossData(time_in,time_out);
+  }
+  LossData ld = h.horizontal_WCV_interval(ii.up-ii.low,step,v2);
+  time_in = ld.getTimeIn() + ii.low;
+  time_out = ld.getTimeOut() + ii.low;
+  return LossData(time_in,time_out);
+}
+
 }
 #endif
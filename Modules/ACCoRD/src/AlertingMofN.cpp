@@ -12,8 +12,6 @@
 #include "AlertingMofN.h"
 #include "Util.h"
 
-#include <vector>
-
 namespace larcfm {
 
 /*
@@ -43,10 +41,8 @@ void AlertingMofN::reset() {
   _last_time_ = NaN;
   _alert_ = -1;
   _max_ = 0;
-  _queue_.clear();
-  for (int i=0;i<n_;++i) {
-    _queue_.push_back(0);
-  }
+  _queue_.assign(Util::max(n_,0),0);
+  _head_ = 0;
 }
 
 /*
@@ -87,20 +83,22 @@ int AlertingMofN::m_of_n(int alert_level) {
   if (alert_level > _max_) {
     _max_ = alert_level;
   }
-  _queue_.pop_front();
-  _queue_.push_back(alert_level);
+  // The newest alert level replaces the oldest one
+  _queue_[_head_] = alert_level;
+  _head_ = _head_+1 < n_ ? _head_+1 : 0;
   if (_max_ == 0) {
     return 0;
   }
-  std::vector<int> count(_max_,0);
-  for (std::deque<int>::const_iterator alert_ptr = _queue_.begin(); alert_ptr != _queue_.end(); ++alert_ptr) {
-    for (int i=(*alert_ptr)-1;i >= 0;--i) {
-      count[i]++;
+  // An alert level counts for all the levels 1 <= i <= alert level
+  for (int i=_max_; i > 0; --i) {
+    int count = 0;
+    for (int k=0; k < n_; ++k) {
+      if (_queue_[k] >= i) {
+        ++count;
+      }
     }
-  }
-  for (int i=_max_-1; i >= 0; --i) {
-    if (count[i] >= m_) {
-      return i+1;
+    if (count >= m_) {
+      return i;
     }
   }
   return 0;
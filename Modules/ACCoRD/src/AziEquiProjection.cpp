@@ -10,6 +10,7 @@
  * Rights Reserved.
  */
 #include "AziEquiProjection.h"
+#include "ProjectionArrays.h"
 #include "EuclideanProjection.h"
 #include "LatLonAlt.h"
 #include "GreatCircle.h"
@@ -231,6 +232,17 @@ namespace larcfm {
     }
    }
 
+  void AziEquiProjection::project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const {
+    projectAll(*this,lla,out);
+  }
+
+  void AziEquiProjection::project(const std::vector<Position>& sip, std::vector<Vect3>& out) const {
+    projectAll(*this,sip,out);
+  }
+
+  void AziEquiProjection::inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const {
+    inverseAll(*this,xyz,out);
+  }
 
 }
 
@@ -20,6 +20,9 @@
 #include "CDCylinder.h"
 #include "PlanUtil.h"
 #include <limits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace larcfm {
 
@@ -208,6 +211,36 @@ bool CDII::detection(const Plan& ownship, const Plan& traffic, double startT, do
   return detection(ownship,traffic,startT,endT,true);
 }
 
+bool CDII::detection(const Plan& ownship, const std::vector<Plan>& traffic, double startT, double endT, std::vector<CDII>& results, int nthreads) const {
+  int n = static_cast<int>(traffic.size());
+  results.assign(n,*this);
+  if (nthreads <= 0) {
+    nthreads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  nthreads = std::max(1,std::min(nthreads,n));
+  // Plans carry a mutable error log, so every worker uses its own copy of the ownship plan
+  std::atomic<int> next(0);
+  auto worker = [&]() {
+    Plan own = ownship;
+    for (int k = next++; k < n; k = next++) {
+      results[k].detection(own,traffic[k],startT,endT);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int w = 1; w < nthreads; w++) {
+    threads.push_back(std::thread(worker));
+  }
+  worker();
+  for (std::thread& t : threads) {
+    t.join();
+  }
+  bool conflict = false;
+  for (int k = 0; k < n; k++) {
+    conflict = conflict || results[k].size() > 0;
+  }
+  return conflict;
+}
+
 bool CDII::detectionExtended(const Plan& ownship, const Plan& traffic, double startT, double endT, bool interpolateVirtuals) {
   if (ownship.isLatLon() != traffic.isLatLon()) {
     error.addError("Ownship and traffic flight plans are not both Euclidean or Lat/Lon");
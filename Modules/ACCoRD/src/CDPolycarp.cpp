@@ -78,6 +78,14 @@ bool CDPolycarp::nearEdge(const Vect3& so, const Poly3D& si, double h, double v)
 }
 
 
+PreparedPolygon CDPolycarp::prepare(const Poly3D& si) const {
+  return PreparedPolygon(si, buff, checkNice);
+}
+
+PreparedPolygon CDPolycarp::prepare(const SimplePoly& si, const EuclideanProjection& proj) const {
+  return PreparedPolygon(si, proj, buff, checkNice);
+}
+
 bool CDPolycarp::violation(const Vect3& so, const Velocity& vo, const Poly3D& si) const {
   return Polycarp3D::violation(so, si, buff, checkNice);
 }
@@ -236,6 +236,10 @@ bool CDSICore::detectionXYZ(const Vect3& so, const Velocity& vo, double t0, doub
     if (checkSmallTimes && dt > 0.0 && dt < 0.000001) {
       error.addWarning("Attempting detectionXYZ on segment "+Fm0(j)+" of "+intent.getID()+" with very small offset: "+Fm12(dt));
     }
+    // the state aircraft is only predicted until state_horizon, there can be no conflict in this or later segments
+    if (state_horizon - (t_base - t0) <= 0.0) {
+      break;
+    }
 
 
     Vect3 sop = so.AddScal((t_base - t0),vo);
@@ -275,7 +279,8 @@ bool CDSICore::detectionXYZ(const Vect3& so, const Velocity& vo, double t0, doub
         }
 
 
-        if ( cdsscore.detectionBetween(sop, vo, sip, intent.initialVelocity(j, linear), BT, NT, HT) ) {
+        Velocity vi = intent.initialVelocity(j, linear);
+        if ( !cdsscore.separatedWithin(sop, vo, sip, vi, HT) && cdsscore.detectionBetween(sop, vo, sip, vi, BT, NT, HT) ) {
           if (std::abs((t0+B) - (cdsscore.getTimeOut()+t_base)) > 0.0000001) {
             captureOutput(t_base, j);
           }
@@ -338,6 +343,10 @@ bool CDSICore::detectionLL(const LatLonAlt& so, const Velocity& vo, double t0, d
     if (checkSmallTimes && dt > 0.0 && dt < 0.000001) {
       error.addWarning("Attempting detectionLL on segment "+Fm0(j)+" of "+intent.getID()+" with very small offset: "+Fm12(dt));
     }
+    // the state aircraft is only predicted until state_horizon, there can be no conflict in this or later segments
+    if (state_horizon - (t_base - t0) <= 0.0) {
+      break;
+    }
 
     LatLonAlt so2p = GreatCircle::linear_initial(so, vo, t_base-t0);  //CHANGED!!!
     LatLonAlt sip = intent.position(t_base,linear).lla();
@@ -393,7 +402,7 @@ bool CDSICore::detectionLL(const LatLonAlt& so, const Velocity& vo, double t0, d
         }
 
 
-        if ( cdsscore.detectionBetween(so3, vop, si3, vip, BT, NT, HT) ) {  //CHANGED!!!
+        if ( !cdsscore.separatedWithin(so3, vop, si3, vip, HT) && cdsscore.detectionBetween(so3, vop, si3, vip, BT, NT, HT) ) {  //CHANGED!!!
           if (std::abs((t0+B) - (cdsscore.getTimeOut()+t_base)) > 0.0000001) {
             captureOutput(t_base, j);
             //	    	  if ( ! captureOutput(t_base, j, cdsscore)) {
@@ -23,6 +23,7 @@
 #include "format.h"
 #include "Detection3D.h"
 #include "WCV_TAUMOD.h"
+#include "CDCylinder.h"
 #include "EuclideanProjection.h"
 #include "Projection.h"
 #include "string_util.h"
@@ -196,6 +197,22 @@ bool CDSSCore::detectionBetween(const Vect3& so, const Velocity& vo, const Vect3
   return conflict && t_in < T && t_out >= B;
 }
 
+bool CDSSCore::separatedWithin(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double timeHorizon) const {
+  const CDCylinder* cyl = dynamic_cast<const CDCylinder*>(cd);
+  if (cyl == NULL || timeHorizon < 0) {
+    return false;
+  }
+  // the relative trajectory is a line segment, it is beyond a face of the cylinder if both end points are.
+  // The margin covers the rounding in the loss computation.
+  double D = cyl->getHorizontalSeparation()*(1+1e-9)+1e-6;
+  double H = cyl->getVerticalSeparation()*(1+1e-9)+1e-6;
+  Vect3 s0 = so.Sub(si);
+  Vect3 s1 = s0.AddScal(timeHorizon, vo.Sub(vi));
+  return (s0.x > D && s1.x > D) || (s0.x < -D && s1.x < -D) ||
+      (s0.y > D && s1.y > D) || (s0.y < -D && s1.y < -D) ||
+      (s0.z > H && s1.z > H) || (s0.z < -H && s1.z < -H);
+}
+
 bool CDSSCore::detectionBetween(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T, const std::string& ut) {
   return detectionBetween(so,vo,si,vi,Units::from(ut,B),Units::from(ut,T));
 }
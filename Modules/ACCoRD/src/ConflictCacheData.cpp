@@ -0,0 +1,104 @@
+/*
+ * Cached conflict detection results of an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "ConflictCacheData.h"
+
+#include "Util.h"
+#include "format.h"
+
+namespace larcfm {
+
+/*
+ * Creates an empty object
+ */
+ConflictCacheData::ConflictCacheData() :
+    alerter_idx_(-1),
+    lookahead_time_(NaN),
+    used_(false) {}
+
+/*
+ * Returns true if cached values were computed for the given ownship and intruder states,
+ * including their uncertainties (SUM data), alerter index, and lookahead time
+ */
+bool ConflictCacheData::isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) const {
+  return alerter_idx_ == alerter_idx && lookahead_time_ == T &&
+      own_s_ == ownship.get_s() && own_v_ == ownship.get_v() &&
+      ac_s_ == intruder.get_s() && ac_v_ == intruder.get_v() &&
+      own_sum_.equals(ownship.sum()) && ac_sum_.equals(intruder.sum());
+}
+
+/*
+ * Clear cached values and set the states, alerter index, and lookahead time they depend on
+ */
+void ConflictCacheData::reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) {
+  own_s_ = ownship.get_s();
+  own_v_ = ownship.get_v();
+  ac_s_ = intruder.get_s();
+  ac_v_ = intruder.get_v();
+  own_sum_ = ownship.sum();
+  ac_sum_ = intruder.sum();
+  alerter_idx_ = alerter_idx;
+  lookahead_time_ = T;
+  conflict_data_.clear();
+  computed_.clear();
+}
+
+/*
+ * Returns true if the conflict data of given alert level is cached
+ */
+bool ConflictCacheData::hasConflictData(int alert_level) const {
+  return 0 < alert_level && alert_level <= static_cast<int>(computed_.size()) && computed_[alert_level-1];
+}
+
+/*
+ * Returns cached conflict data of given alert level. Requires hasConflictData(alert_level)
+ */
+const ConflictData& ConflictCacheData::getConflictData(int alert_level) const {
+  return conflict_data_[alert_level-1];
+}
+
+void ConflictCacheData::setConflictData(int alert_level, const ConflictData& det) {
+  if (alert_level > static_cast<int>(computed_.size())) {
+    conflict_data_.resize(alert_level);
+    computed_.resize(alert_level,false);
+  }
+  conflict_data_[alert_level-1] = det;
+  computed_[alert_level-1] = true;
+}
+
+/*
+ * Flag used to discard entries of aircraft that are no longer in the traffic list
+ */
+bool ConflictCacheData::isUsed() const {
+  return used_;
+}
+
+void ConflictCacheData::setUsed(bool used) {
+  used_ = used;
+}
+
+std::string ConflictCacheData::toString() const {
+  std::string s = "<alerter_idx: "+Fmi(alerter_idx_)+", lookahead_time: "+FmPrecision(lookahead_time_)+
+      ", levels: {";
+  bool comma = false;
+  for (int i=0; i < static_cast<int>(computed_.size()); ++i) {
+    if (computed_[i]) {
+      if (comma) {
+        s += ", ";
+      } else {
+        comma = true;
+      }
+      s += Fmi(i+1);
+    }
+  }
+  s += "}>\n";
+  return s;
+}
+
+}
@@ -0,0 +1,140 @@
+/*
+ * Cached horizontal contours and hazard zones of an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "ContourCacheData.h"
+
+#include "Util.h"
+#include "format.h"
+
+namespace larcfm {
+
+/*
+ * Creates an empty object
+ */
+ContourCacheData::ContourCacheData() :
+    own_pos_(Position::INVALID()),
+    ac_pos_(Position::INVALID()),
+    alerter_idx_(-1),
+    lookahead_time_(NaN) {}
+
+/*
+ * Returns true if cached values were computed for the given ownship and intruder states,
+ * including their uncertainties (SUM data), alerter index, and lookahead time. Contours and hazard zones are geodesic polygons, so
+ * the states are compared in absolute coordinates as well as in the ownship's projection.
+ */
+bool ContourCacheData::isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) const {
+  return alerter_idx_ == alerter_idx && lookahead_time_ == T &&
+      own_pos_ == ownship.getPosition() && own_vel_ == ownship.getVelocity() &&
+      ac_pos_ == intruder.getPosition() && ac_vel_ == intruder.getVelocity() &&
+      own_s_ == ownship.get_s() && own_v_ == ownship.get_v() &&
+      ac_s_ == intruder.get_s() && ac_v_ == intruder.get_v() &&
+      own_sum_.equals(ownship.sum()) && ac_sum_.equals(intruder.sum());
+}
+
+/*
+ * Clear cached values and set the states, alerter index, and lookahead time they depend on
+ */
+void ContourCacheData::reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx, double T) {
+  own_pos_ = ownship.getPosition();
+  own_vel_ = ownship.getVelocity();
+  ac_pos_ = intruder.getPosition();
+  ac_vel_ = intruder.getVelocity();
+  own_s_ = ownship.get_s();
+  own_v_ = ownship.get_v();
+  ac_s_ = intruder.get_s();
+  ac_v_ = intruder.get_v();
+  own_sum_ = ownship.sum();
+  ac_sum_ = intruder.sum();
+  alerter_idx_ = alerter_idx;
+  lookahead_time_ = T;
+  contours_.clear();
+  contour_thr_.clear();
+  hazard_zones_.clear();
+  hazard_time_.clear();
+}
+
+/*
+ * Returns true if the contours of given alert level are cached for contour threshold thr
+ */
+bool ContourCacheData::hasContours(int alert_level, double thr) const {
+  return 0 < alert_level && alert_level <= static_cast<int>(contour_thr_.size()) && contour_thr_[alert_level-1] == thr;
+}
+
+/*
+ * Returns cached contours of given alert level. Requires hasContours(alert_level,thr)
+ */
+const std::vector<std::vector<Position> >& ContourCacheData::getContours(int alert_level) const {
+  return contours_[alert_level-1];
+}
+
+void ContourCacheData::setContours(int alert_level, double thr, const std::vector<std::vector<Position> >& blobs) {
+  if (alert_level > static_cast<int>(contour_thr_.size())) {
+    contours_.resize(alert_level);
+    contour_thr_.resize(alert_level,NaN);
+  }
+  contours_[alert_level-1] = blobs;
+  contour_thr_[alert_level-1] = thr;
+}
+
+// Four hazard zones per alert level, one for each combination of loss and from_ownship
+int ContourCacheData::hazard_index(int alert_level, bool loss, bool from_ownship) {
+  return 4*(alert_level-1)+(loss ? 2 : 0)+(from_ownship ? 1 : 0);
+}
+
+/*
+ * Returns true if the hazard zone of given alert level, loss and from_ownship flags is
+ * cached for time horizon T
+ */
+bool ContourCacheData::hasHazardZone(int alert_level, bool loss, bool from_ownship, double T) const {
+  int idx = hazard_index(alert_level,loss,from_ownship);
+  return 0 < alert_level && idx < static_cast<int>(hazard_time_.size()) && hazard_time_[idx] == T;
+}
+
+/*
+ * Returns cached hazard zone. Requires hasHazardZone(alert_level,loss,from_ownship,T)
+ */
+const std::vector<Position>& ContourCacheData::getHazardZone(int alert_level, bool loss, bool from_ownship) const {
+  return hazard_zones_[hazard_index(alert_level,loss,from_ownship)];
+}
+
+void ContourCacheData::setHazardZone(int alert_level, bool loss, bool from_ownship, double T, const std::vector<Position>& haz) {
+  int idx = hazard_index(alert_level,loss,from_ownship);
+  if (idx >= static_cast<int>(hazard_time_.size())) {
+    hazard_zones_.resize(4*alert_level);
+    hazard_time_.resize(4*alert_level,NaN);
+  }
+  hazard_zones_[idx] = haz;
+  hazard_time_[idx] = T;
+}
+
+std::string ContourCacheData::toString() const {
+  std::string s = "<alerter_idx: "+Fmi(alerter_idx_)+", lookahead_time: "+FmPrecision(lookahead_time_)+
+      ", contour levels: {";
+  bool comma = false;
+  for (int i=0; i < static_cast<int>(contour_thr_.size()); ++i) {
+    if (!ISNAN(contour_thr_[i])) {
+      if (comma) {
+        s += ", ";
+      } else {
+        comma = true;
+      }
+      s += Fmi(i+1);
+    }
+  }
+  int zones = 0;
+  for (int i=0; i < static_cast<int>(hazard_time_.size()); ++i) {
+    if (!ISNAN(hazard_time_[i])) {
+      ++zones;
+    }
+  }
+  s += "}, hazard zones: "+Fmi(zones)+">\n";
+  return s;
+}
+
+}
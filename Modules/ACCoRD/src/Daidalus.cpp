@@ -371,6 +371,37 @@ bool Daidalus::removeTrafficAircraft(const std::string& name) {
   return false;
 }
 
+/**
+ * Same as setOwnshipState with ownship's identifier, but the ownship's state is updated in place.
+ * Returns false, and nothing is done, if ownship has not been set, or if pos is lat/lon and ownship's
+ * position is not, or vice versa.
+ */
+bool Daidalus::updateOwnshipState(const Position& pos, const Velocity& vel, double time) {
+  if (!hasOwnship() || core_.ownship.isLatLon() != pos.isLatLon()) {
+    return false;
+  }
+  if (time < getCurrentTime() || time-getCurrentTime() > getHysteresisTime()) {
+    clearHysteresis();
+    core_.update_ownship_state(pos,vel,time);
+  } else {
+    core_.update_ownship_state(pos,vel,time);
+    stale_bands();
+  }
+  return true;
+}
+
+/**
+ * Update state of traffic aircraft at index ac_idx in place, keeping its identifier and index.
+ * Returns aircraft's index, or -1 if nothing is done.
+ */
+int Daidalus::updateTrafficState(int ac_idx, const Position& pos, const Velocity& vel, double time) {
+  if (core_.update_traffic_state(ac_idx-1,pos,vel,time)) {
+    stale_bands();
+    return ac_idx;
+  }
+  return -1;
+}
+
 /**
  * Project ownship and traffic aircraft offset seconds in the future (if positive) or in the past (if negative)
  * XPERT USE ONLY !!!
@@ -551,7 +582,7 @@ void Daidalus::setHorizontalPositionUncertainty(int ac_idx, double s_EW_std, dou
     } else {
       core_.traffic[ac_idx-1].setHorizontalPositionUncertainty(s_EW_std,s_NS_std,s_EN_std);
     }
-    reset();
+    stale();
   }
 }
 
@@ -576,7 +607,7 @@ void Daidalus::setVerticalPositionUncertainty(int ac_idx, double sz_std) {
     } else {
       core_.traffic[ac_idx-1].setVerticalPositionUncertainty(sz_std);
     }
-    reset();
+    stale();
   }
 }
 
@@ -601,7 +632,7 @@ void Daidalus::setHorizontalVelocityUncertainty(int ac_idx, double v_EW_std, dou
     } else {
       core_.traffic[ac_idx-1].setHorizontalVelocityUncertainty(v_EW_std,v_NS_std,v_EN_std);
     }
-    reset();
+    stale();
   }
 }
 
@@ -626,7 +657,7 @@ void Daidalus::setVerticalSpeedUncertainty(int ac_idx, double vz_std) {
     } else {
       core_.traffic[ac_idx-1].setVerticalSpeedUncertainty(vz_std);
     }
-    reset();
+    stale();
   }
 }
 
@@ -648,7 +679,7 @@ void Daidalus::resetUncertainty(int ac_idx) {
     } else {
       core_.traffic[ac_idx-1].resetUncertainty();
     }
-    reset();
+    stale();
   }
 }
 
@@ -780,6 +811,34 @@ void Daidalus::horizontalHazardZone(std::vector<Position>& haz, int ac_idx, bool
   horizontalHazardZone(haz,ac_idx,loss,from_ownship,alertLevelOfRegion(ac_idx,region));
 }
 
+/**
+ * Computes, using up to nthreads threads, the horizontal contours of all traffic aircraft for
+ * given alert level, so that subsequent calls to horizontalContours return them without
+ * recomputation. Contours are kept until the ownship or traffic state, or the parameters change.
+ * @param alert_level is the alert level used to compute detection. The value 0
+ * indicate the alert level of the corrective region, a negative value all the alert levels.
+ * @param nthreads maximum number of threads. All hardware threads are used when nthreads <= 0.
+ */
+void Daidalus::computeHorizontalContours(int alert_level, int nthreads) {
+  core_.horizontal_contours_all(alert_level,nthreads);
+}
+
+/**
+ * Computes, using up to nthreads threads, the horizontal hazard zones of all traffic aircraft for
+ * given alert level, so that subsequent calls to horizontalHazardZone return them without
+ * recomputation. Hazard zones are kept until the ownship or traffic state, or the parameters change.
+ * @param loss true means that the polygons represent the hazard zones. Otherwise,
+ * the polygons represent the hazard zones with an alerting time.
+ * @param from_ownship true means ownship point of view. Otherwise, the hazard zones are computed
+ * from the intruders' point of view.
+ * @param alert_level is the alert level used to compute detection. The value 0
+ * indicate the alert level of the corrective region, a negative value all the alert levels.
+ * @param nthreads maximum number of threads. All hardware threads are used when nthreads <= 0.
+ */
+void Daidalus::computeHorizontalHazardZones(bool loss, bool from_ownship, int alert_level, int nthreads) {
+  core_.horizontal_hazard_zones_all(alert_level,loss,from_ownship,nthreads);
+}
+
 /* Setting and getting DaidalusParameters */
 
 /**
@@ -1338,7 +1397,7 @@ int Daidalus::getAlertingParameterM() const {
  * @return Alerting parameter n of "M of N" strategy
  */
 int Daidalus::getAlertingParameterN() const {
-  return core_.parameters.getAlertingParameterM();
+  return core_.parameters.getAlertingParameterN();
 }
 
 /**
@@ -2747,6 +2806,19 @@ void Daidalus::stale_bands() {
  * Set cached values to stale conditions and clear hysteresis variables.
  */
 void Daidalus::reset() {
+  core_.clear_conflict_cache();
+  hdir_band_.clear_bands_cache();
+  hs_band_.clear_bands_cache();
+  vs_band_.clear_bands_cache();
+  alt_band_.clear_bands_cache();
+  stale();
+}
+
+/**
+ * Set cached values to stale conditions. Per-aircraft caches are kept, since they are
+ * keyed on the aircraft states and uncertainties.
+ */
+void Daidalus::stale() {
   core_.stale();
   stale_bands();
 }
@@ -2829,6 +2901,19 @@ Interval Daidalus::horizontalDirectionIntervalAt(int i, const std::string& u) {
   return Interval(Units::to(u, ia.low), Units::to(u, ia.up));
 }
 
+/**
+ * @return the i-th interval, in specified units [u], of the computed direction bands.
+ * @param i index
+ * @param u units, resolved at compile time
+ */
+Interval Daidalus::horizontalDirectionIntervalAt(int i, const AngleUnit& u) {
+  Interval ia = hdir_band_.interval(core_,i);
+  if (ia.isEmpty()) {
+    return ia;
+  }
+  return Interval(u.to(ia.low), u.to(ia.up));
+}
+
 /**
  * @return the i-th region of the computed direction bands.
  * @param i index
@@ -3038,6 +3123,19 @@ Interval Daidalus::horizontalSpeedIntervalAt(int i, const std::string& u) {
   return Interval(Units::to(u, ia.low), Units::to(u, ia.up));
 }
 
+/**
+ * @return the i-th interval, in specified units [u], of the computed horizontal speed bands.
+ * @param i index
+ * @param u units, resolved at compile time
+ */
+Interval Daidalus::horizontalSpeedIntervalAt(int i, const SpeedUnit& u) {
+  Interval ia = hs_band_.interval(core_,i);
+  if (ia.isEmpty()) {
+    return ia;
+  }
+  return Interval(u.to(ia.low), u.to(ia.up));
+}
+
 /**
  * @return the i-th region of the computed horizontal speed bands.
  * @param i index
@@ -3248,6 +3346,19 @@ Interval Daidalus::verticalSpeedIntervalAt(int i, const std::string& u) {
   return Interval(Units::to(u, ia.low), Units::to(u, ia.up));
 }
 
+/**
+ * @return the i-th interval, in specified units [u], of the computed vertical speed bands.
+ * @param i index
+ * @param u units, resolved at compile time
+ */
+Interval Daidalus::verticalSpeedIntervalAt(int i, const SpeedUnit& u) {
+  Interval ia = vs_band_.interval(core_,i);
+  if (ia.isEmpty()) {
+    return ia;
+  }
+  return Interval(u.to(ia.low), u.to(ia.up));
+}
+
 /**
  * @return the i-th region of the computed vertical speed bands.
  * @param i index
@@ -3457,6 +3568,19 @@ Interval Daidalus::altitudeIntervalAt(int i, const std::string& u) {
   return Interval(Units::to(u, ia.low), Units::to(u, ia.up));
 }
 
+/**
+ * @return the i-th interval, in specified units [u], of the computed altitude bands.
+ * @param i index
+ * @param u units, resolved at compile time
+ */
+Interval Daidalus::altitudeIntervalAt(int i, const LengthUnit& u) {
+  Interval ia = alt_band_.interval(core_,i);
+  if (ia.isEmpty()) {
+    return ia;
+  }
+  return Interval(u.to(ia.low), u.to(ia.up));
+}
+
 /**
  * @return the i-th region of the computed altitude bands.
  * @param i index
@@ -145,24 +145,35 @@ void DaidalusAltBands::alt_bands_generic(std::vector<Integerval>& l,
   }
 }
 
-void DaidalusAltBands::none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
+void DaidalusAltBands::integer_none_bands(std::vector<Integerval>& bands_int, const Detection3D* conflict_det, const Detection3D* recovery_det,
     int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
   int maxup = (int)std::floor((get_max_val_()-get_min_val_())/get_step(parameters))+1;
-  std::vector<Integerval> altint;
-  alt_bands_generic(altint,conflict_det,recovery_det,B,T,maxup,parameters,ownship,traffic,instantaneous_bands(parameters));
-  toIntervalSet(noneset,altint,get_step(parameters),get_min_val_());
+  resolve_detectors(conflict_det,recovery_det);
+  alt_bands_generic(bands_int,conflict_det,recovery_det,B,T,maxup,parameters,ownship,traffic,instantaneous_bands(parameters));
+  resolve_detectors(NULL,NULL);
+}
+
+// Altitude steps are counted from the minimum altitude
+double DaidalusAltBands::integer_bands_origin(const TrafficState& ownship) const {
+  return get_min_val_();
 }
 
 bool DaidalusAltBands::any_red(const Detection3D* conflict_det, const Detection3D* recovery_det,
     int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
-  return first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,true,false,instantaneous_bands(parameters)) >= 0 ||
+  resolve_detectors(conflict_det,recovery_det);
+  bool red = first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,true,false,instantaneous_bands(parameters)) >= 0 ||
       first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,false,false,instantaneous_bands(parameters)) >= 0;
+  resolve_detectors(NULL,NULL);
+  return red;
 }
 
 bool DaidalusAltBands::all_red(const Detection3D* conflict_det, const Detection3D* recovery_det,
     int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
-  return first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,true,true,instantaneous_bands(parameters)) < 0 &&
+  resolve_detectors(conflict_det,recovery_det);
+  bool red = first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,true,true,instantaneous_bands(parameters)) < 0 &&
       first_band_alt_generic(conflict_det,recovery_det,B,T,parameters,ownship,traffic,false,true,instantaneous_bands(parameters)) < 0;
+  resolve_detectors(NULL,NULL);
+  return red;
 }
 
 int DaidalusAltBands::first_nat(int mini, int maxi, bool dir, const Detection3D* conflict_det, const Detection3D* recovery_det,
@@ -20,6 +20,10 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <thread>
 #include "TrafficState.h"
 
 namespace larcfm {
@@ -32,7 +36,9 @@ DaidalusCore::DaidalusCore()
 , parameters()
 , urgency_strategy_(new NoneUrgencyStrategy())
 , cache_(0) // Cached_ variables are cleared
-, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
+, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS))
+, ownship_slot_(-1)
+, recycled_next_(0) {
   stale();
 }
 
@@ -44,7 +50,9 @@ DaidalusCore::DaidalusCore(const Alerter& alerter)
 , parameters()
 , urgency_strategy_(new NoneUrgencyStrategy())
 , cache_(0) // Cached_ variables are cleared
-, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
+, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS))
+, ownship_slot_(-1)
+, recycled_next_(0) {
   parameters.addAlerter(alerter);
   stale();
 }
@@ -57,7 +65,9 @@ DaidalusCore::DaidalusCore(const Detection3D* det, double T)
 , parameters()
 , urgency_strategy_(new NoneUrgencyStrategy())
 , cache_(0) // Cached_ variables are cleared
-, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
+, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS))
+, ownship_slot_(-1)
+, recycled_next_(0) {
   parameters.addAlerter(Alerter::SingleBands(det,T,T));
   parameters.setLookaheadTime(T);
   stale();
@@ -69,12 +79,19 @@ DaidalusCore::DaidalusCore(const DaidalusCore& core)
 , current_time(core.current_time)
 , wind_vector(core.wind_vector)
 , parameters(core.parameters)
-, urgency_strategy_(core.urgency_strategy_)
+, urgency_strategy_(core.urgency_strategy_->copy())
 , cache_(0) // Cached_ variables are cleared
-, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
+, acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS))
+, ownship_slot_(-1)
+, recycled_next_(0) {
+  assign_slots();
   stale();
 }
 
+DaidalusCore::~DaidalusCore() {
+  delete urgency_strategy_;
+}
+
 void DaidalusCore::copyFrom(const DaidalusCore& core) {
   if (&core != this) {
     ownship = core.ownship;
@@ -86,10 +103,63 @@ void DaidalusCore::copyFrom(const DaidalusCore& core) {
     urgency_strategy_ = core.urgency_strategy_->copy();
     // Cached_ variables are cleared
     cache_ = 0;
+    for (int slot = 0; slot < static_cast<int>(slots_.size()); ++slot) {
+      slots_[slot].has_conflict_cache = false;
+      slots_[slot].conflict_cache = ConflictCacheData();
+    }
+    contour_cache_acs_.clear();
+    clear_recycled_traffic();
+    assign_slots();
     stale();
   }
 }
 
+DaidalusCore::AircraftSlot::AircraftSlot()
+: has_alerting_hysteresis(false)
+, has_dta_hysteresis(false)
+, has_conflict_cache(false) {}
+
+int DaidalusCore::assign_slot(const std::string& id) {
+  std::map<std::string,int>::const_iterator slot_ptr = slot_of_id_.find(id);
+  if (slot_ptr != slot_of_id_.end()) {
+    return slot_ptr->second;
+  }
+  int slot;
+  if (free_slots_.empty()) {
+    slot = static_cast<int>(slots_.size());
+    slots_.push_back(AircraftSlot());
+  } else {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  slots_[slot].id = id;
+  slot_of_id_[id] = slot;
+  return slot;
+}
+
+void DaidalusCore::assign_slots() {
+  ownship_slot_ = ownship.isValid() ? assign_slot(ownship.getId()) : -1;
+  traffic_slots_.clear();
+  for (int i = 0; i < static_cast<int>(traffic.size()); ++i) {
+    traffic_slots_.push_back(assign_slot(traffic[i].getId()));
+  }
+}
+
+int DaidalusCore::slot_of(const TrafficState& ac) {
+  if (&ac == &ownship) {
+    if (ownship_slot_ < 0) {
+      ownship_slot_ = assign_slot(ownship.getId());
+    }
+    return ownship_slot_;
+  }
+  if (!traffic.empty() && traffic_slots_.size() == traffic.size() &&
+      !std::less<const TrafficState*>()(&ac,&traffic.front()) &&
+      std::less<const TrafficState*>()(&ac,&traffic.front()+traffic.size())) {
+    return traffic_slots_[&ac-&traffic.front()];
+  }
+  return assign_slot(ac.getId());
+}
+
 DaidalusCore& DaidalusCore::operator=(const DaidalusCore& core) {
   copyFrom(core);
   return *this;
@@ -116,6 +186,8 @@ bool DaidalusCore::set_urgency_strategy(const UrgencyStrategy* strat) {
 void DaidalusCore::clear() {
   ownship = TrafficState::INVALID();
   traffic.clear();
+  ownship_slot_ = -1;
+  traffic_slots_.clear();
   current_time = 0;
   clear_hysteresis();
 }
@@ -150,8 +222,12 @@ bool DaidalusCore::set_alerter_traffic(int idx, int alerter_idx) {
  *  Clear alerting hysteresis information from this object.
  */
 void DaidalusCore::clear_hysteresis() {
-  alerting_hysteresis_acs_.clear();
-  dta_hysteresis_acs_.clear();
+  for (int slot = 0; slot < static_cast<int>(slots_.size()); ++slot) {
+    slots_[slot].has_alerting_hysteresis = false;
+    slots_[slot].has_dta_hysteresis = false;
+  }
+  // Hysteresis is cleared when parameters are (re)loaded
+  clear_conflict_cache();
   stale();
 }
 
@@ -171,16 +247,29 @@ void DaidalusCore::stale() {
       tiov_[conflict_region] = Interval::EMPTY;
       bands4region_[conflict_region] = false;
     }
-    std::map<std::string,HysteresisData>::iterator hysteresis_ptr;
-    for (hysteresis_ptr = alerting_hysteresis_acs_.begin();hysteresis_ptr != alerting_hysteresis_acs_.end();++hysteresis_ptr) {
-      hysteresis_ptr->second.outdateIfCurrentTime(current_time);
-    }
-    for (hysteresis_ptr = dta_hysteresis_acs_.begin();hysteresis_ptr != dta_hysteresis_acs_.end();++hysteresis_ptr) {
-      hysteresis_ptr->second.outdateIfCurrentTime(current_time);
+    for (int slot = 0; slot < static_cast<int>(slots_.size()); ++slot) {
+      if (slots_[slot].has_alerting_hysteresis) {
+        slots_[slot].alerting_hysteresis.outdateIfCurrentTime(current_time);
+      }
+      if (slots_[slot].has_dta_hysteresis) {
+        slots_[slot].dta_hysteresis.outdateIfCurrentTime(current_time);
+      }
     }
   }
 }
 
+/**
+ * Clear per-intruder conflict detection results, contours, and hazard zones. Required when parameters
+ * or alerters change.
+ */
+void DaidalusCore::clear_conflict_cache() {
+  for (int slot = 0; slot < static_cast<int>(slots_.size()); ++slot) {
+    slots_[slot].has_conflict_cache = false;
+    slots_[slot].conflict_cache = ConflictCacheData();
+  }
+  contour_cache_acs_.clear();
+}
+
 /**
  * Returns true is object is fresh
  */
@@ -225,6 +314,8 @@ void DaidalusCore::refresh() {
       }
     }
     refresh_mua_eps();
+    prune_conflict_cache();
+    prune_contour_cache();
     cache_ = 1;
   }
 }
@@ -349,10 +440,35 @@ double DaidalusCore::minVerticalRecovery() const {
   return TCASTable::TCASII_RA().getZTHR(sl);
 }
 
-void DaidalusCore::set_ownship_state(const std::string& id, const Position& pos, const Velocity& vel, double time) {
+void DaidalusCore::recycle_traffic() {
+  recycled_traffic_.swap(traffic);
+  recycled_slots_.swap(traffic_slots_);
+  recycled_next_ = 0;
   traffic.clear();
+  traffic_slots_.clear();
+}
+
+void DaidalusCore::clear_recycled_traffic() {
+  recycled_traffic_.clear();
+  recycled_slots_.clear();
+  recycled_next_ = 0;
+}
+
+int DaidalusCore::recycled_index(const std::string& id) {
+  for (int k = recycled_next_; k < static_cast<int>(recycled_traffic_.size()); ++k) {
+    if (equals(recycled_traffic_[k].getId(),id)) {
+      recycled_next_ = k+1;
+      return k;
+    }
+  }
+  return -1;
+}
+
+void DaidalusCore::set_ownship_state(const std::string& id, const Position& pos, const Velocity& vel, double time) {
+  recycle_traffic();
   ownship = TrafficState::makeOwnship(id,pos,vel);
   ownship.applyWindVector(wind_vector);
+  ownship_slot_ = assign_slot(id);
   current_time = time;
   stale();
 }
@@ -375,21 +491,37 @@ int DaidalusCore::set_traffic_state(const std::string& id, const Position& pos,
   }
   double dt = current_time-time;
   Position pt = dt == 0 ? pos : pos.linear(vel,dt);
-  TrafficState ac = ownship.makeIntruder(id,pt,vel);
-  if (ac.isValid()) {
-    ac.applyWindVector(wind_vector);
-    int idx = find_traffic_state(id);
+  // The state of an aircraft that was in the list before the ownship state was set, or that is already in
+  // the list, is updated in place. It's the same as ownship.makeIntruder(id,pt,vel) with wind applied.
+  // A recycled aircraft is not in the list, nor is its identifier copied or looked up.
+  int idx;
+  int k = recycled_index(id);
+  if (k >= 0) {
+    if (!recycled_traffic_[k].updateIntruder(ownship,pt,vel,wind_vector)) {
+      return -1;
+    }
+    idx = traffic.size();
+    traffic.push_back(std::move(recycled_traffic_[k]));
+    traffic_slots_.push_back(recycled_slots_[k]);
+  } else {
+    idx = find_traffic_state(id);
     if (idx >= 0) {
-      traffic[idx]=ac;
+      if (!traffic[idx].updateIntruder(ownship,pt,vel,wind_vector)) {
+        return -1;
+      }
     } else {
+      TrafficState ac = ownship.makeIntruder(id,pt,vel);
+      if (!ac.isValid()) {
+        return -1;
+      }
+      ac.applyWindVector(wind_vector);
       idx = traffic.size();
       traffic.push_back(ac);
+      traffic_slots_.push_back(assign_slot(id));
     }
-    stale();
-    return idx;
-  } else {
-    return -1;
   }
+  stale();
+  return idx;
 }
 
 // idx is 0-based index in traffic list
@@ -398,6 +530,8 @@ void DaidalusCore::reset_ownship(int idx) {
   ownship = traffic[idx];
   ownship.setAsOwnship();
   old_own.setAsIntruderOf(ownship);
+  std::swap(ownship_slot_,traffic_slots_[idx]);
+  clear_recycled_traffic();
   for (int i = 0; i < static_cast<int>(traffic.size()); ++i) {
     if (i == idx) {
       traffic[i] = old_own;
@@ -411,9 +545,37 @@ void DaidalusCore::reset_ownship(int idx) {
 // idx is 0-based index in traffic list
 bool DaidalusCore::remove_traffic(int idx) {
   if (0 < idx && idx < static_cast<int>(traffic.size())) {
-    dta_hysteresis_acs_.erase(traffic[idx].getId());
-    alerting_hysteresis_acs_.erase(traffic[idx].getId());
+    int slot = traffic_slots_[idx];
+    slot_of_id_.erase(slots_[slot].id);
+    slots_[slot] = AircraftSlot();
+    free_slots_.push_back(slot);
+    contour_cache_acs_.erase(traffic[idx].getId());
     traffic.erase(traffic.begin()+idx);
+    traffic_slots_.erase(traffic_slots_.begin()+idx);
+    stale();
+    return true;
+  }
+  return false;
+}
+
+bool DaidalusCore::update_ownship_state(const Position& pos, const Velocity& vel, double time) {
+  if (!ownship.isValid() || ownship.isLatLon() != pos.isLatLon()) {
+    return false;
+  }
+  recycle_traffic();
+  ownship.updateOwnship(pos,vel,wind_vector);
+  current_time = time;
+  stale();
+  return true;
+}
+
+// idx is 0-based index in traffic list
+bool DaidalusCore::update_traffic_state(int idx, const Position& pos, const Velocity& vel, double time) {
+  if (idx < 0 || idx >= static_cast<int>(traffic.size())) {
+    return false;
+  }
+  double dt = current_time-time;
+  if (traffic[idx].updateIntruder(ownship,dt == 0 ? pos : pos.linear(vel,dt),vel,wind_vector)) {
     stale();
     return true;
   }
@@ -421,7 +583,8 @@ bool DaidalusCore::remove_traffic(int idx) {
 }
 
 void DaidalusCore::set_wind_velocity(const Velocity& wind) {
-  if (has_ownship()) {
+  // Aircraft states don't change, and don't need to be projected again, if wind is the same
+  if (has_ownship() && wind != wind_vector) {
     ownship.applyWindVector(wind);
     std::vector<TrafficState>::iterator ac_ptr;
     for (ac_ptr=traffic.begin();ac_ptr != traffic.end(); ++ac_ptr) {
@@ -471,9 +634,15 @@ int DaidalusCore::horizontal_contours(std::vector<std::vector<Position> >& blobs
     if (alert_level > 0) {
       Detection3D* detector = alerter.getDetectorPtr(alert_level);
       if (detector != NULL) {
-        detector->horizontalContours(blobs,ownship,intruder,
-            parameters.getHorizontalContourThreshold(),
-            parameters.getLookaheadTime());
+        double thr = parameters.getHorizontalContourThreshold();
+        ContourCacheData& entry = contour_cache_entry(intruder,alerter_idx);
+        if (!entry.hasContours(alert_level,thr)) {
+          std::vector<std::vector<Position> > contours;
+          detector->horizontalContours(contours,ownship,intruder,thr,parameters.getLookaheadTime());
+          entry.setContours(alert_level,thr,contours);
+        }
+        const std::vector<std::vector<Position> >& contours = entry.getContours(alert_level);
+        blobs.insert(blobs.end(),contours.begin(),contours.end());
       } else {
         return 1;
       }
@@ -504,10 +673,16 @@ int DaidalusCore::horizontal_hazard_zone(std::vector<Position>& haz, int idx, in
     if (alert_level > 0) {
       Detection3D* detector = alerter.getDetectorPtr(alert_level);
       if (detector != NULL) {
-        detector->horizontalHazardZone(haz,
-            (from_ownship ? ownship : intruder),
-            (from_ownship ? intruder : ownship),
-            (loss ? 0 : alerter.getLevel(alert_level).getAlertingTime()));
+        double T = loss ? 0 : alerter.getLevel(alert_level).getAlertingTime();
+        ContourCacheData& entry = contour_cache_entry(intruder,alerter_idx);
+        if (!entry.hasHazardZone(alert_level,loss,from_ownship,T)) {
+          detector->horizontalHazardZone(haz,
+              (from_ownship ? ownship : intruder),
+              (from_ownship ? intruder : ownship),T);
+          entry.setHazardZone(alert_level,loss,from_ownship,T,haz);
+        } else {
+          haz = entry.getHazardZone(alert_level,loss,from_ownship);
+        }
       } else {
         return 1;
       }
@@ -541,15 +716,15 @@ void DaidalusCore::conflict_aircraft(int conflict_region) {
       if (alert_level > 0) {
         Detection3D* detector =  alerter.getLevel(alert_level).getCoreDetectionPtr();
         if (detector != NULL) {
-          std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
+          const AircraftSlot& slot = slots_[slot_of(intruder)];
           double alerting_time = alerter.getLevel(alert_level).getAlertingTime();
-          if (alerting_hysteresis_ptr != alerting_hysteresis_acs_.end() &&
-              !ISNAN(alerting_hysteresis_ptr->second.getInitTime()) &&
-              alerting_hysteresis_ptr->second.getInitTime() < current_time &&
-              alerting_hysteresis_ptr->second.getLastValue() == alert_level) {
+          if (slot.has_alerting_hysteresis &&
+              !ISNAN(slot.alerting_hysteresis.getInitTime()) &&
+              slot.alerting_hysteresis.getInitTime() < current_time &&
+              slot.alerting_hysteresis.getLastValue() == alert_level) {
             alerting_time = alerter.getLevel(alert_level).getEarlyAlertingTime();
           }
-          ConflictData det = detector->conflictDetectionWithTrafficState(ownship,intruder,0.0,parameters.getLookaheadTime());
+          ConflictData det = conflict_detection(intruder,alerter_idx,alert_level);
           if (det.conflict()) {
             if (det.conflictBefore(alerting_time)) {
               acs_conflict_bands_[conflict_region].push_back(IndexLevelT(ac,alert_level,parameters.getLookaheadTime()));
@@ -589,25 +764,20 @@ const Interval& DaidalusCore::tiov(int conflict_region) {
 int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac) {
   if (parameters.getDTALogic() != 0 && parameters.getDTAAlerter() != 0 &&
       parameters.getDTARadius() > 0 && parameters.getDTAHeight() > 0) {
-    std::map<std::string,HysteresisData>::iterator dta_hysteresis_ptr = dta_hysteresis_acs_.find(ac.getId());
-    if (dta_hysteresis_ptr ==  dta_hysteresis_acs_.end()) {
-      HysteresisData dta_hysteresis = HysteresisData(
+    AircraftSlot& slot = slots_[slot_of(ac)];
+    if (!slot.has_dta_hysteresis) {
+      slot.dta_hysteresis = HysteresisData(
           parameters.getHysteresisTime(),
           parameters.getPersistenceTime(),
           parameters.getAlertingParameterM(),
           parameters.getAlertingParameterN());
-      int raw_dta = Util::almost_leq(ac.getPosition().distanceH(parameters.getDTAPosition()),parameters.getDTARadius()) &&
-          Util::almost_leq(ac.getPosition().alt(),parameters.getDTAHeight()) ? 1 : 0;
-      int actual_dta = dta_hysteresis.applyHysteresisLogic(raw_dta,current_time);
-      dta_hysteresis_acs_[ac.getId()] = dta_hysteresis;
-      return actual_dta;
-    } else if (dta_hysteresis_ptr->second.isUpdatedAtCurrentTime(current_time)) {
-      return dta_hysteresis_ptr->second.getLastValue();
-    } else {
-      int raw_dta = Util::almost_leq(ac.getPosition().distanceH(parameters.getDTAPosition()),parameters.getDTARadius()) &&
-          Util::almost_leq(ac.getPosition().alt(),parameters.getDTAHeight()) ? 1 : 0;
-      return dta_hysteresis_ptr->second.applyHysteresisLogic(raw_dta,current_time);
+      slot.has_dta_hysteresis = true;
+    } else if (slot.dta_hysteresis.isUpdatedAtCurrentTime(current_time)) {
+      return slot.dta_hysteresis.getLastValue();
     }
+    int raw_dta = Util::almost_leq(ac.getPosition().distanceH(parameters.getDTAPosition()),parameters.getDTARadius()) &&
+        Util::almost_leq(ac.getPosition().alt(),parameters.getDTAHeight()) ? 1 : 0;
+    return slot.dta_hysteresis.applyHysteresisLogic(raw_dta,current_time);
   } else {
     return 0;
   }
@@ -668,21 +838,22 @@ TrafficState DaidalusCore::recovery_ac() {
 /**
  * Return true if and only if threshold values, defining an alerting level, are violated.
  */
-bool DaidalusCore::check_alerting_thresholds(const Alerter& alerter, int alert_level, const TrafficState& intruder, int turning, int accelerating, int climbing) {
+bool DaidalusCore::check_alerting_thresholds(int alerter_idx, int alert_level, const TrafficState& intruder, int turning, int accelerating, int climbing) {
+  const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
   const AlertThresholds& athr = alerter.getLevel(alert_level);
   if (athr.isValid()) {
     Detection3D* detector = athr.getCoreDetectionPtr();
-    std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
+    const AircraftSlot& slot = slots_[slot_of(intruder)];
     double alerting_time = alerter.getLevel(alert_level).getAlertingTime();
-    if (alerting_hysteresis_ptr != alerting_hysteresis_acs_.end() &&
-        !ISNAN(alerting_hysteresis_ptr->second.getLastTime()) &&
-        alerting_hysteresis_ptr->second.getLastTime() < current_time &&
-        alerting_hysteresis_ptr->second.getLastValue() == alert_level) {
+    if (slot.has_alerting_hysteresis &&
+        !ISNAN(slot.alerting_hysteresis.getLastTime()) &&
+        slot.alerting_hysteresis.getLastTime() < current_time &&
+        slot.alerting_hysteresis.getLastValue() == alert_level) {
       alerting_time = alerter.getLevel(alert_level).getEarlyAlertingTime();
     }
     int epsh = epsilonH(false,intruder);
     int epsv = epsilonV(false,intruder);
-    ConflictData det = detector->conflictDetectionWithTrafficState(ownship,intruder,0.0,parameters.getLookaheadTime());
+    ConflictData det = conflict_detection(intruder,alerter_idx,alert_level);
     if (det.conflictBefore(alerting_time)) {
       return true;
     }
@@ -728,24 +899,24 @@ bool DaidalusCore::check_alerting_thresholds(const Alerter& alerter, int alert_l
 int DaidalusCore::alerting_hysteresis_current_value(const TrafficState& intruder, int turning, int accelerating, int climbing) {
   int alerter_idx = alerter_index_of(intruder);
   if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
-    std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
-    if (alerting_hysteresis_ptr == alerting_hysteresis_acs_.end()) {
+    // Slots may be added while the raw alert level is computed, so the slot is accessed by index
+    int slot = slot_of(intruder);
+    if (!slots_[slot].has_alerting_hysteresis) {
       HysteresisData alerting_hysteresis = HysteresisData(
           parameters.getHysteresisTime(),
           parameters.getPersistenceTime(),
           parameters.getAlertingParameterM(),
           parameters.getAlertingParameterN());
-      const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
-      int raw_alert = raw_alert_level(alerter,intruder,turning,accelerating,climbing);
+      int raw_alert = raw_alert_level(alerter_idx,intruder,turning,accelerating,climbing);
       int actual_alert = alerting_hysteresis.applyHysteresisLogic(raw_alert,current_time);
-      alerting_hysteresis_acs_[intruder.getId()] = alerting_hysteresis;
+      slots_[slot].alerting_hysteresis = alerting_hysteresis;
+      slots_[slot].has_alerting_hysteresis = true;
       return actual_alert;
-    } else if (alerting_hysteresis_ptr->second.isUpdatedAtCurrentTime(current_time)) {
-      return alerting_hysteresis_ptr->second.getLastValue();
+    } else if (slots_[slot].alerting_hysteresis.isUpdatedAtCurrentTime(current_time)) {
+      return slots_[slot].alerting_hysteresis.getLastValue();
     } else {
-      const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
-      int raw_alert = raw_alert_level(alerter,intruder,turning,accelerating,climbing);
-      return alerting_hysteresis_ptr->second.applyHysteresisLogic(raw_alert,current_time);
+      int raw_alert = raw_alert_level(alerter_idx,intruder,turning,accelerating,climbing);
+      return slots_[slot].alerting_hysteresis.applyHysteresisLogic(raw_alert,current_time);
     }
   } else {
     return -1;
@@ -777,15 +948,181 @@ int DaidalusCore::alert_level(int idx, int turning, int accelerating, int climbi
   }
 }
 
-int DaidalusCore::raw_alert_level(const Alerter& alerter, const TrafficState& intruder, int turning, int accelerating, int climbing) {
+int DaidalusCore::raw_alert_level(int alerter_idx, const TrafficState& intruder, int turning, int accelerating, int climbing) {
+  const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
   for (int alert_level=alerter.mostSevereAlertLevel(); alert_level > 0; --alert_level) {
-    if (check_alerting_thresholds(alerter,alert_level,intruder,turning,accelerating,climbing)) {
+    if (check_alerting_thresholds(alerter_idx,alert_level,intruder,turning,accelerating,climbing)) {
       return alert_level;
     }
   }
   return 0;
 }
 
+/**
+ * Conflict detection of ownship and intruder over lookahead time for the core detector of given
+ * alerter and alert level. Results are reused until ownship state, intruder state, or alerter change.
+ */
+ConflictData DaidalusCore::conflict_detection(const TrafficState& intruder, int alerter_idx, int alert_level) {
+  double T = parameters.getLookaheadTime();
+  AircraftSlot& slot = slots_[slot_of(intruder)];
+  slot.has_conflict_cache = true;
+  ConflictCacheData& entry = slot.conflict_cache;
+  if (!entry.isValidFor(ownship,intruder,alerter_idx,T)) {
+    entry.reset(ownship,intruder,alerter_idx,T);
+  }
+  entry.setUsed(true);
+  if (!entry.hasConflictData(alert_level)) {
+    Detection3D* detector = parameters.getAlerterAt(alerter_idx).getLevel(alert_level).getCoreDetectionPtr();
+    entry.setConflictData(alert_level,detector->conflictDetectionWithTrafficState(ownship,intruder,0.0,T));
+  }
+  return entry.getConflictData(alert_level);
+}
+
+/**
+ * Remove cached conflict detection results of aircraft that are no longer in the traffic list
+ */
+void DaidalusCore::prune_conflict_cache() {
+  for (int slot = 0; slot < static_cast<int>(slots_.size()); ++slot) {
+    AircraftSlot& entry = slots_[slot];
+    if (!entry.has_conflict_cache) {
+      continue;
+    }
+    if (entry.conflict_cache.isUsed()) {
+      entry.conflict_cache.setUsed(false);
+    } else {
+      entry.has_conflict_cache = false;
+      entry.conflict_cache = ConflictCacheData();
+    }
+  }
+}
+
+/**
+ * Remove cached contours and hazard zones of aircraft that are no longer in the traffic list
+ */
+void DaidalusCore::prune_contour_cache() {
+  std::map<std::string,ContourCacheData>::iterator entry_ptr = contour_cache_acs_.begin();
+  while (entry_ptr != contour_cache_acs_.end()) {
+    if (find_traffic_state(entry_ptr->first) >= 0) {
+      ++entry_ptr;
+    } else {
+      contour_cache_acs_.erase(entry_ptr++);
+    }
+  }
+}
+
+ContourCacheData& DaidalusCore::contour_cache_entry(const TrafficState& intruder, int alerter_idx) {
+  double T = parameters.getLookaheadTime();
+  ContourCacheData& entry = contour_cache_acs_[intruder.getId()];
+  if (!entry.isValidFor(ownship,intruder,alerter_idx,T)) {
+    entry.reset(ownship,intruder,alerter_idx,T);
+  }
+  return entry;
+}
+
+void DaidalusCore::horizontal_contours_all(int alert_level, int nthreads) {
+  compute_contours_all(false,alert_level,false,false,nthreads);
+}
+
+void DaidalusCore::horizontal_hazard_zones_all(int alert_level, bool loss, bool from_ownship, int nthreads) {
+  compute_contours_all(true,alert_level,loss,from_ownship,nthreads);
+}
+
+// Contours or hazard zone of one aircraft and level, computed by a worker thread
+struct ContourJob {
+  ContourCacheData* entry;
+  const TrafficState* intruder;
+  Detection3D* detector;
+  int alert_level;
+  double time;
+  std::vector<std::vector<Position> > blobs;
+  std::vector<Position> haz;
+};
+
+void DaidalusCore::compute_contours_all(bool hazard, int alert_level, bool loss, bool from_ownship, int nthreads) {
+  // Cache entries are looked up, and missing results listed, before the workers start. The workers only
+  // call the detectors, whose contour and hazard zone methods are const, and write to their own job.
+  double thr = parameters.getHorizontalContourThreshold();
+  std::vector<ContourJob> jobs;
+  for (int idx = 0; idx < static_cast<int>(traffic.size()); ++idx) {
+    const TrafficState& intruder = traffic[idx];
+    int alerter_idx = alerter_index_of(intruder);
+    if (alerter_idx < 1 || alerter_idx > parameters.numberOfAlerters()) {
+      continue;
+    }
+    const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
+    int first = alert_level;
+    int last = alert_level;
+    if (alert_level == 0) {
+      first = last = parameters.correctiveAlertLevel(alerter_idx);
+    } else if (alert_level < 0) {
+      first = 1;
+      last = alerter.mostSevereAlertLevel();
+    }
+    ContourCacheData& entry = contour_cache_entry(intruder,alerter_idx);
+    for (int level = std::max(1,first); level <= last; ++level) {
+      Detection3D* detector = alerter.getDetectorPtr(level);
+      if (detector == NULL) {
+        continue;
+      }
+      ContourJob job;
+      job.entry = &entry;
+      job.intruder = &intruder;
+      job.detector = detector;
+      job.alert_level = level;
+      if (hazard) {
+        job.time = loss ? 0 : alerter.getLevel(level).getAlertingTime();
+        if (entry.hasHazardZone(level,loss,from_ownship,job.time)) {
+          continue;
+        }
+      } else {
+        job.time = thr;
+        if (entry.hasContours(level,thr)) {
+          continue;
+        }
+      }
+      jobs.push_back(job);
+    }
+  }
+  int njobs = static_cast<int>(jobs.size());
+  if (nthreads <= 0) {
+    nthreads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  nthreads = std::max(1,std::min(nthreads,njobs));
+  double T = parameters.getLookaheadTime();
+  std::atomic<int> next(0);
+  auto work = [&]() {
+    for (int j = next++; j < njobs; j = next++) {
+      ContourJob& job = jobs[j];
+      if (hazard) {
+        job.detector->horizontalHazardZone(job.haz,
+            (from_ownship ? ownship : *job.intruder),
+            (from_ownship ? *job.intruder : ownship),job.time);
+      } else {
+        job.detector->horizontalContours(job.blobs,ownship,*job.intruder,thr,T);
+      }
+    }
+  };
+  if (nthreads == 1) {
+    work();
+  } else {
+    std::vector<std::thread> workers;
+    for (int w = 0; w < nthreads; ++w) {
+      workers.push_back(std::thread(work));
+    }
+    for (int w = 0; w < nthreads; ++w) {
+      workers[w].join();
+    }
+  }
+  for (int j = 0; j < njobs; ++j) {
+    ContourJob& job = jobs[j];
+    if (hazard) {
+      job.entry->setHazardZone(job.alert_level,loss,from_ownship,job.time,job.haz);
+    } else {
+      job.entry->setContours(job.alert_level,thr,job.blobs);
+    }
+  }
+}
+
 std::string DaidalusCore::outputStringAircraftStates(bool internal) const {
   std::string ualt = internal ? "m" : parameters.getUnitsOf("step_alt");
   std::string uhs = internal ? "m/s" : parameters.getUnitsOf("step_hs");
@@ -843,24 +1180,45 @@ std::string DaidalusCore::rawString() const {
     s += Fmb(bands4region_[conflict_region]);
   }
   s += "}\n";
-  std::map<std::string,HysteresisData>::const_iterator entry_ptr = alerting_hysteresis_acs_.begin();
-  while (entry_ptr != alerting_hysteresis_acs_.end()) {
-    s+="alerting_hysteresis_acs_["+entry_ptr->first+"] = "+
-        entry_ptr->second.toString();
-    ++entry_ptr;
+  // Per-aircraft variables are listed by aircraft's id
+  std::map<std::string,int>::const_iterator slot_ptr;
+  bool any = false;
+  for (slot_ptr = slot_of_id_.begin(); slot_ptr != slot_of_id_.end(); ++slot_ptr) {
+    const AircraftSlot& slot = slots_[slot_ptr->second];
+    if (slot.has_alerting_hysteresis) {
+      s+="alerting_hysteresis_acs_["+slot_ptr->first+"] = "+
+          slot.alerting_hysteresis.toString();
+      any = true;
+    }
   }
-  if (!alerting_hysteresis_acs_.empty()) {
+  if (any) {
     s+="\n";
   }
-  entry_ptr = dta_hysteresis_acs_.begin();
-  while (entry_ptr != dta_hysteresis_acs_.end()) {
-    s+="dta_hysteresis_acs_["+entry_ptr->first+"] = "+
-        entry_ptr->second.toString();
-    ++entry_ptr;
+  any = false;
+  for (slot_ptr = slot_of_id_.begin(); slot_ptr != slot_of_id_.end(); ++slot_ptr) {
+    const AircraftSlot& slot = slots_[slot_ptr->second];
+    if (slot.has_dta_hysteresis) {
+      s+="dta_hysteresis_acs_["+slot_ptr->first+"] = "+
+          slot.dta_hysteresis.toString();
+      any = true;
+    }
   }
-  if (!dta_hysteresis_acs_.empty()) {
+  if (any) {
     s+="\n";
   }
+  for (slot_ptr = slot_of_id_.begin(); slot_ptr != slot_of_id_.end(); ++slot_ptr) {
+    const AircraftSlot& slot = slots_[slot_ptr->second];
+    if (slot.has_conflict_cache) {
+      s+="conflict_cache_acs_["+slot_ptr->first+"] = "+
+          slot.conflict_cache.toString();
+    }
+  }
+  std::map<std::string,ContourCacheData>::const_iterator contour_ptr = contour_cache_acs_.begin();
+  while (contour_ptr != contour_cache_acs_.end()) {
+    s+="contour_cache_acs_["+contour_ptr->first+"] = "+
+        contour_ptr->second.toString();
+    ++contour_ptr;
+  }
   s+="wind_vector = "+wind_vector.toString()+"\n";
   s+="## Ownship and Traffic Relative to Wind\n";
   s+=outputStringAircraftStates(true);
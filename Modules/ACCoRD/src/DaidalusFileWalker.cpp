@@ -10,6 +10,7 @@
  */
 
 #include "DaidalusFileWalker.h"
+#include <algorithm>
 
 namespace larcfm {
 
@@ -27,8 +28,6 @@ void DaidalusFileWalker::init() {
   sr_.setWindowSize(1);
   index_ = 0;
   times_ = sr_.sequenceKeys();
-  if (times_.size() > 0)
-    sr_.setActive(times_[0]);
 }
 
 double DaidalusFileWalker::firstTime() const {
@@ -72,7 +71,6 @@ bool DaidalusFileWalker::goToTime(double t) {
 bool DaidalusFileWalker::goToTimeStep(int i) {
   if (0 <= i && (unsigned int)i < times_.size()) {
     index_ = i;
-    sr_.setActive(times_[index_]);
     return true;
   }
   return false;
@@ -102,16 +100,16 @@ void DaidalusFileWalker::goPrev() {
 int DaidalusFileWalker::indexOfTime(double t) const {
   int i = -1;
   if (t >= firstTime() && t <= lastTime()) {
-    i = 0;
-    for (; (unsigned int)i < times_.size()-1; ++i) {
-      if (t >= times_[i] && t < times_[i+1]) {
-        break;
-      }
-    }
+    // last time step at or before t
+    i = static_cast<int>(std::upper_bound(times_.begin(),times_.end(),t)-times_.begin())-1;
   }
   return i;
 }
 
+int DaidalusFileWalker::numberOfTimeSteps() const {
+  return static_cast<int>(times_.size());
+}
+
 ParameterData DaidalusFileWalker::extraColumnsToParameters(const SequenceReader& sr, double time, const std::string& ac_name) {
   ParameterData pd;
   std::vector<std::string> columns = sr.getExtraColumnList();
@@ -177,22 +175,31 @@ void DaidalusFileWalker::readExtraColumns(Daidalus& daa, const SequenceReader& s
 }
 
 void DaidalusFileWalker::readState(Daidalus& daa) {
+  readStateAt(daa,index_);
+  goNext();
+}
+
+void DaidalusFileWalker::readStateAt(Daidalus& daa, int i) const {
+  if (i < 0 || (unsigned int)i >= times_.size()) {
+    return;
+  }
   if (p_.size() > 0) {
     daa.setParameterData(p_);
     daa.reset();
   }
-  for (int ac = 0; ac < sr_.size();++ac) {
-    std::string ida = sr_.getName(ac);
-    Position sa = sr_.getPosition(ac);
-    Velocity va = sr_. getVelocity(ac);
+  double time = times_[i];
+  std::vector<std::string> ids;
+  std::vector<Position> positions;
+  std::vector<Velocity> velocities;
+  sr_.getSequenceEntry(time,ids,positions,velocities);
+  for (int ac = 0; ac < (int)ids.size(); ++ac) {
     if (ac==0) {
-      daa.setOwnshipState(ida,sa,va,getTime());
+      daa.setOwnshipState(ids[ac],positions[ac],velocities[ac],time);
     } else {
-      daa.addTrafficState(ida,sa,va);
+      daa.addTrafficState(ids[ac],positions[ac],velocities[ac]);
     }
     readExtraColumns(daa,sr_,ac);
   }
-  goNext();
 }
 
 // ErrorReporter Interface Methods
@@ -11,9 +11,77 @@
 #include "Util.h"
 #include <vector>
 #include <string>
+#include <cstring>
+#include <stdint.h>
 
 namespace larcfm {
 
+DaidalusIntegerBands::DaidalusIntegerBands() :
+        share_trajectories_(false) {}
+
+void DaidalusIntegerBands::share_ownship_trajectories(bool share) {
+  share_trajectories_ = share;
+  trajectories_.clear();
+}
+
+// Times are compared bit by bit, so that a trajectory is only reused for exactly the same time
+bool DaidalusIntegerBands::TrajectoryKey::operator==(const TrajectoryKey& key) const {
+  return std::memcmp(&time,&key.time,sizeof(double)) == 0 && target_step == key.target_step &&
+      dir == key.dir && instantaneous == key.instantaneous;
+}
+
+std::size_t DaidalusIntegerBands::TrajectoryKeyHash::operator()(const TrajectoryKey& key) const {
+  uint64_t bits;
+  std::memcpy(&bits,&key.time,sizeof(double));
+  bits ^= (static_cast<uint64_t>(static_cast<uint32_t>(key.target_step)) << 2) ^ (key.dir ? 1 : 0) ^ (key.instantaneous ? 2 : 0);
+  return std::hash<uint64_t>()(bits*0x9E3779B97F4A7C15ULL);
+}
+
+void DaidalusIntegerBands::resolve_detectors(const Detection3D* conflict_det, const Detection3D* recovery_det) const {
+  conflict_dispatch_ = DetectionDispatch(conflict_det);
+  recovery_dispatch_ = DetectionDispatch(recovery_det);
+}
+
+bool DaidalusIntegerBands::conflict_with(const Detection3D* det, const TrafficState& own, const TrafficState& traffic, double B, double T) const {
+  if (det == conflict_dispatch_.getDetector()) {
+    return conflict_dispatch_.conflictWithTrafficState(own,traffic,B,T);
+  }
+  if (det == recovery_dispatch_.getDetector()) {
+    return recovery_dispatch_.conflictWithTrafficState(own,traffic,B,T);
+  }
+  return det->conflictWithTrafficState(own,traffic,B,T);
+}
+
+TrafficState DaidalusIntegerBands::ownship_at(const TrafficState& ownship, double tsk, const std::pair<Vect3,Velocity>& sovot) {
+  Vect3 sot = sovot.first;
+  Velocity vot = sovot.second;
+  Vect3 sat = tsk == 0.0 ? sot : vot.ScalAdd(-tsk,sot);
+  TrafficState own = ownship;
+  own.setPosition(Position(sat));
+  own.setAirVelocity(vot);
+  return own;
+}
+
+const DaidalusIntegerBands::OwnshipTrajectory& DaidalusIntegerBands::shared_trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
+    double time, bool dir, int target_step, bool instantaneous) const {
+  TrajectoryKey key = {time,target_step,dir,instantaneous};
+  std::unordered_map<TrajectoryKey,OwnshipTrajectory,TrajectoryKeyHash>::const_iterator ptr = trajectories_.find(key);
+  if (ptr != trajectories_.end()) {
+    return ptr->second;
+  }
+  std::pair<Vect3,Velocity> sovot = trajectory(parameters,ownship,time,dir,target_step,instantaneous);
+  OwnshipTrajectory entry = {sovot,ownship_at(ownship,time,sovot)};
+  return trajectories_.insert(std::make_pair(key,entry)).first->second;
+}
+
+std::pair<Vect3,Velocity> DaidalusIntegerBands::own_trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
+    double time, bool dir, int target_step, bool instantaneous) const {
+  if (share_trajectories_) {
+    return shared_trajectory(parameters,ownship,time,dir,target_step,instantaneous).sovot;
+  }
+  return trajectory(parameters,ownship,time,dir,target_step,instantaneous);
+}
+
 /**
  * In PVS: int_bands@CD_future_traj
  */
@@ -21,14 +89,12 @@ bool DaidalusIntegerBands::CD_future_traj(const Detection3D* det, double B, doub
     const DaidalusParameters& parameters,  const TrafficState& ownship, const TrafficState& traffic, int target_step, bool instantaneous) const {
   T = Util::min(parameters.getLookaheadTime(),T);
   if (tsk > T || B > T) return false;
-  std::pair<Vect3,Velocity> sovot = trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous);
-  Vect3 sot = sovot.first;
-  Velocity vot = sovot.second;
-  Vect3 sat = tsk == 0.0 ? sot : vot.ScalAdd(-tsk,sot);
-  TrafficState own = ownship;
-  own.setPosition(Position(sat));
-  own.setAirVelocity(vot);
-  return det->conflictWithTrafficState(own,traffic,Util::max(B,tsk),T);
+  if (share_trajectories_) {
+    const TrafficState& own = shared_trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous).own;
+    return conflict_with(det,own,traffic,Util::max(B,tsk),T);
+  }
+  TrafficState own = ownship_at(ownship,tsk,trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous));
+  return conflict_with(det,own,traffic,Util::max(B,tsk),T);
 }
 
 /**
@@ -53,14 +119,18 @@ bool DaidalusIntegerBands::LOS_at(const Detection3D* det, bool trajdir, double t
   if (tsk >= parameters.getLookaheadTime()) {
       return false;
   }
-  std::pair<Vect3,Velocity> sovot = trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous);
+  // The shared ownship is placed at sot when tsk is 0, which is not always the same zero as sot-0*vot
+  if (share_trajectories_ && tsk != 0.0) {
+    return conflict_with(det,shared_trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous).own,traffic,tsk,tsk);
+  }
+  std::pair<Vect3,Velocity> sovot = own_trajectory(parameters,ownship,tsk,trajdir,target_step,instantaneous);
   Vect3 sot = sovot.first;
   Velocity vot = sovot.second;
   Vect3 sat = vot.ScalAdd(-tsk,sot);
   TrafficState own = ownship;
   own.setPosition(Position(sat));
   own.setAirVelocity(vot);
-  return det->violationAtWithTrafficState(own,traffic,tsk);
+  return conflict_with(det,own,traffic,tsk,tsk);
 }
 
 // In PVS: int_bands@first_los_step
@@ -165,8 +235,8 @@ int DaidalusIntegerBands::first_kinematic_green(const Detection3D* conflict_det,
 }
 
 Vect3 DaidalusIntegerBands::kinematic_linvel(const DaidalusParameters& parameters, const TrafficState& ownship, double tstep, bool trajdir, int k) const {
-  Vect3 s1 = trajectory(parameters,ownship,(k+1)*tstep,trajdir,0,false).first;
-  Vect3 s0 = trajectory(parameters,ownship,k*tstep,trajdir,0,false).first;
+  Vect3 s1 = own_trajectory(parameters,ownship,(k+1)*tstep,trajdir,0,false).first;
+  Vect3 s0 = own_trajectory(parameters,ownship,k*tstep,trajdir,0,false).first;
   return s1.Sub(s0).Scal(1/tstep);
 }
 
@@ -176,7 +246,7 @@ bool DaidalusIntegerBands::kinematic_repulsive_at(double tstep, bool trajdir, in
   if (k==0) {
     return true;
   }
-  std::pair<Vect3,Velocity> sovo = trajectory(parameters,ownship,0,trajdir,0,false);
+  std::pair<Vect3,Velocity> sovo = own_trajectory(parameters,ownship,0,trajdir,0,false);
   Vect2 so = sovo.first.vect2();
   Vect2 vo = sovo.second.vect2();
   Vect2 si = traffic.get_s().vect2();
@@ -186,7 +256,7 @@ bool DaidalusIntegerBands::kinematic_repulsive_at(double tstep, bool trajdir, in
     rep = CriteriaCore::horizontal_new_repulsive_criterion(so.Sub(si), vo, vi, kinematic_linvel(parameters,ownship,tstep,trajdir,0).vect2(), epsh);
   }
   if (rep) {
-    std::pair<Vect3,Velocity> sovot = trajectory(parameters,ownship,k*tstep,trajdir,0,false);
+    std::pair<Vect3,Velocity> sovot = own_trajectory(parameters,ownship,k*tstep,trajdir,0,false);
     Vect2 sot = sovot.first.vect2();
     Vect2 vot = sovot.second.vect2();
     Vect2 sit = vi.ScalAdd(k*tstep,si);
@@ -216,7 +286,7 @@ bool DaidalusIntegerBands::kinematic_vert_repul_at(double tstep, bool trajdir, i
   if (k==0) {
     return true;
   }
-  std::pair<Vect3,Velocity> sovo = trajectory(parameters,ownship,0,trajdir,0,false);
+  std::pair<Vect3,Velocity> sovo = own_trajectory(parameters,ownship,0,trajdir,0,false);
   Vect3 so = sovo.first;
   Vect3 vo = sovo.second;
   Vect3 si = traffic.get_s();
@@ -226,7 +296,7 @@ bool DaidalusIntegerBands::kinematic_vert_repul_at(double tstep, bool trajdir, i
     rep = CriteriaCore::vertical_new_repulsive_criterion(so.Sub(si),vo,vi,kinematic_linvel(parameters,ownship,tstep,trajdir,0),epsv);
   }
   if (rep) {
-    std::pair<Vect3,Velocity> sovot = trajectory(parameters,ownship,k*tstep,trajdir,0,false);
+    std::pair<Vect3,Velocity> sovot = own_trajectory(parameters,ownship,k*tstep,trajdir,0,false);
     Vect3 sot = sovot.first;
     Vect3 vot = sovot.second;
     Vect3 sit = vi.ScalAdd(k*tstep,si);
@@ -293,7 +363,7 @@ bool DaidalusIntegerBands::no_instantaneous_conflict(const Detection3D* conflict
     int epsh, int epsv, int target_step) const {
   bool usehcrit = epsh != 0;
   bool usevcrit = epsv != 0;
-  std::pair<Vect3,Velocity> nsovo = trajectory(parameters,ownship,0,trajdir,target_step,true);
+  std::pair<Vect3,Velocity> nsovo = own_trajectory(parameters,ownship,0,trajdir,target_step,true);
   Vect3 so = ownship.get_s();
   Velocity vo = ownship.get_v();
   Vect3 si = traffic.get_s();
@@ -438,6 +508,7 @@ void DaidalusIntegerBands::integer_bands_combine(std::vector<Integerval>& l, con
     double B, double T,
     int maxl, int maxr,const DaidalusParameters& parameters,  const TrafficState& ownship, const TrafficState& traffic,
     int epsh, int epsv) const {
+  resolve_detectors(conflict_det,recovery_det);
   if (tstep == 0) {
     instantaneous_bands_combine(l,conflict_det,recovery_det,
         B,T,maxl,maxr,parameters,ownship,traffic,
@@ -447,32 +518,39 @@ void DaidalusIntegerBands::integer_bands_combine(std::vector<Integerval>& l, con
         B,T,maxl,maxr,parameters,ownship,traffic,
         epsh,epsv);
   }
+  resolve_detectors(NULL,NULL);
 }
 
 bool DaidalusIntegerBands::all_integer_red(const Detection3D* conflict_det, const Detection3D* recovery_det, double tstep,
     double B, double T,
     int maxl, int maxr,const DaidalusParameters& parameters,  const TrafficState& ownship, const TrafficState& traffic,
     int epsh, int epsv, int dir) const {
-  return tstep == 0 ?
+  resolve_detectors(conflict_det,recovery_det);
+  bool red = tstep == 0 ?
       all_instantaneous_red(conflict_det,recovery_det,
           B,T,maxl,maxr, parameters,ownship,traffic,
           epsh,epsv,dir)
           : all_kinematic_red(conflict_det,recovery_det,tstep,
               B,T,maxl,maxr, parameters,ownship,traffic,
               epsh,epsv,dir);
+  resolve_detectors(NULL,NULL);
+  return red;
 }
 
 bool DaidalusIntegerBands::any_integer_red(const Detection3D* conflict_det, const Detection3D* recovery_det, double tstep,
     double B, double T,
     int maxl, int maxr,const DaidalusParameters& parameters,  const TrafficState& ownship, const TrafficState& traffic,
     int epsh, int epsv, int dir) const {
-  return tstep == 0 ?
+  resolve_detectors(conflict_det,recovery_det);
+  bool red = tstep == 0 ?
       any_instantaneous_red(conflict_det,recovery_det,
           B,T,maxl,maxr, parameters,ownship,traffic,
           epsh,epsv,dir)
           : any_kinematic_red(conflict_det,recovery_det,tstep,
               B,T,maxl,maxr, parameters,ownship,traffic,
               epsh,epsv,dir);
+  resolve_detectors(NULL,NULL);
+  return red;
 }
 
 }
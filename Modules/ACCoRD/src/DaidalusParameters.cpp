@@ -7,6 +7,7 @@
 
 #include "DaidalusParameters.h"
 #include "ParameterData.h"
+#include "ParameterKey.h"
 #include "StateReader.h"
 #include "Units.h"
 #include "Util.h"
@@ -1654,24 +1655,23 @@ void DaidalusParameters::setDTALogic(int dta_logic) {
  * Get DAA Terminal Area (DTA) position (lat/lon)
  */
 const Position& DaidalusParameters::getDTAPosition() const {
-  static Position dta_position;
-  if (dta_latitude_ != dta_position.lat() ||
-      dta_longitude_ != dta_position.lon()) {
+  if (dta_latitude_ != dta_position_.lat() ||
+      dta_longitude_ != dta_position_.lon()) {
     std::string ulat = getUnitsOf("dta_latitude");
     std::string ulon = getUnitsOf("dta_longitude");
     if (Units::isCompatible(ulat,ulon)) {
       if (Units::isCompatible("m",ulat)) {
-        dta_position = Position::mkXYZ(dta_latitude_,dta_longitude_,0.0);
+        dta_position_ = Position::mkXYZ(dta_latitude_,dta_longitude_,0.0);
       } else if (Units::isCompatible("deg",ulat)) {
-        dta_position = Position::mkLatLonAlt(dta_latitude_,dta_longitude_,0.0);
+        dta_position_ = Position::mkLatLonAlt(dta_latitude_,dta_longitude_,0.0);
       } else {
-        dta_position = Position::INVALID();
+        dta_position_ = Position::INVALID();
       }
     } else {
-      dta_position = Position::INVALID();
+      dta_position_ = Position::INVALID();
     }
   }
-  return dta_position;
+  return dta_position_;
 }
 
 /**
@@ -2181,6 +2181,53 @@ std::string DaidalusParameters::getString(const ParameterData& p,const std::stri
   return parameter_data<std::string>(p,key,f);
 }
 
+// Alias of key that is set in p, when key itself is not set in p. Returns NULL otherwise.
+const std::string* DaidalusParameters::alias_in(const ParameterData& p, const ParameterKey& key) {
+  if (p.contains(key)) {
+    return NULL;
+  }
+  aliasestype::const_iterator find_ptr = getAliases().find(key.name());
+  if (find_ptr == getAliases().end()) {
+    return NULL;
+  }
+  std::vector<std::string>::const_iterator alias_ptr;
+  for (alias_ptr = find_ptr->second.begin(); alias_ptr != find_ptr->second.end(); ++alias_ptr) {
+    if (p.contains(*alias_ptr)) {
+      return &(*alias_ptr);
+    }
+  }
+  return NULL;
+}
+
+bool DaidalusParameters::contains(const ParameterData& p, const ParameterKey& key) {
+  return p.contains(key) || alias_in(p,key) != NULL;
+}
+
+std::string DaidalusParameters::getUnit(const ParameterData& p, const ParameterKey& key) {
+  const std::string* alias = alias_in(p,key);
+  return alias == NULL ? p.getUnit(key) : p.getUnit(*alias);
+}
+
+double DaidalusParameters::getValue(const ParameterData& p, const ParameterKey& key) {
+  const std::string* alias = alias_in(p,key);
+  return alias == NULL ? p.getValue(key) : p.getValue(*alias);
+}
+
+bool DaidalusParameters::getBool(const ParameterData& p, const ParameterKey& key) {
+  const std::string* alias = alias_in(p,key);
+  return alias == NULL ? p.getBool(key) : p.getBool(*alias);
+}
+
+int DaidalusParameters::getInt(const ParameterData& p, const ParameterKey& key) {
+  const std::string* alias = alias_in(p,key);
+  return alias == NULL ? p.getInt(key) : p.getInt(*alias);
+}
+
+std::string DaidalusParameters::getString(const ParameterData& p, const ParameterKey& key) {
+  const std::string* alias = alias_in(p,key);
+  return alias == NULL ? p.getString(key) : p.getString(*alias);
+}
+
 std::vector<std::string> DaidalusParameters::getListString(const ParameterData& p,const std::string& key) {
   class GetListString : public Function<const std::string&,std::vector<std::string> > {
   private:
@@ -2206,306 +2253,373 @@ void DaidalusParameters::readAlerterList(const std::vector<std::string>& alerter
   }
 }
 
+// Keys read by setParameterData. They are interned once, rather than hashed on every read.
+namespace keys {
+static const ParameterKey lookahead_time("lookahead_time");
+static const ParameterKey left_hdir("left_hdir");
+static const ParameterKey right_hdir("right_hdir");
+static const ParameterKey min_hs("min_hs");
+static const ParameterKey max_hs("max_hs");
+static const ParameterKey min_vs("min_vs");
+static const ParameterKey max_vs("max_vs");
+static const ParameterKey min_alt("min_alt");
+static const ParameterKey max_alt("max_alt");
+static const ParameterKey below_relative_hs("below_relative_hs");
+static const ParameterKey above_relative_hs("above_relative_hs");
+static const ParameterKey below_relative_vs("below_relative_vs");
+static const ParameterKey above_relative_vs("above_relative_vs");
+static const ParameterKey below_relative_alt("below_relative_alt");
+static const ParameterKey above_relative_alt("above_relative_alt");
+static const ParameterKey step_hdir("step_hdir");
+static const ParameterKey step_hs("step_hs");
+static const ParameterKey step_vs("step_vs");
+static const ParameterKey step_alt("step_alt");
+static const ParameterKey horizontal_accel("horizontal_accel");
+static const ParameterKey vertical_accel("vertical_accel");
+static const ParameterKey turn_rate("turn_rate");
+static const ParameterKey bank_angle("bank_angle");
+static const ParameterKey vertical_rate("vertical_rate");
+static const ParameterKey min_horizontal_recovery("min_horizontal_recovery");
+static const ParameterKey min_vertical_recovery("min_vertical_recovery");
+static const ParameterKey recovery_hdir("recovery_hdir");
+static const ParameterKey recovery_hs("recovery_hs");
+static const ParameterKey recovery_vs("recovery_vs");
+static const ParameterKey recovery_alt("recovery_alt");
+static const ParameterKey ca_bands("ca_bands");
+static const ParameterKey ca_factor("ca_factor");
+static const ParameterKey horizontal_nmac("horizontal_nmac");
+static const ParameterKey vertical_nmac("vertical_nmac");
+static const ParameterKey recovery_stability_time("recovery_stability_time");
+static const ParameterKey hysteresis_time("hysteresis_time");
+static const ParameterKey persistence_time("persistence_time");
+static const ParameterKey bands_persistence("bands_persistence");
+static const ParameterKey persistence_preferred_hdir("persistence_preferred_hdir");
+static const ParameterKey persistence_preferred_hs("persistence_preferred_hs");
+static const ParameterKey persistence_preferred_vs("persistence_preferred_vs");
+static const ParameterKey persistence_preferred_alt("persistence_preferred_alt");
+static const ParameterKey alerting_m("alerting_m");
+static const ParameterKey alerting_n("alerting_n");
+static const ParameterKey conflict_crit("conflict_crit");
+static const ParameterKey recovery_crit("recovery_crit");
+static const ParameterKey h_pos_z_score("h_pos_z_score");
+static const ParameterKey h_vel_z_score_min("h_vel_z_score_min");
+static const ParameterKey h_vel_z_score_max("h_vel_z_score_max");
+static const ParameterKey h_vel_z_distance("h_vel_z_distance");
+static const ParameterKey v_pos_z_score("v_pos_z_score");
+static const ParameterKey v_vel_z_score("v_vel_z_score");
+static const ParameterKey contour_thr("contour_thr");
+static const ParameterKey dta_logic("dta_logic");
+static const ParameterKey dta_latitude("dta_latitude");
+static const ParameterKey dta_longitude("dta_longitude");
+static const ParameterKey dta_radius("dta_radius");
+static const ParameterKey dta_height("dta_height");
+static const ParameterKey dta_alerter("dta_alerter");
+static const ParameterKey ownship_centric_alerting("ownship_centric_alerting");
+static const ParameterKey corrective_region("corrective_region");
+static const ParameterKey conflict_level("conflict_level");
+static const ParameterKey alerters("alerters");
+}
+
 bool DaidalusParameters::setParameterData(const ParameterData& p) {
   bool setit = false;
-  if (contains(p,"lookahead_time")) {
-    setLookaheadTime(getValue(p,"lookahead_time"));
-    units_["lookahead_time"] = getUnit(p,"lookahead_time");
+  if (contains(p,keys::lookahead_time)) {
+    setLookaheadTime(getValue(p,keys::lookahead_time));
+    units_["lookahead_time"] = getUnit(p,keys::lookahead_time);
     setit = true;
   }
-  if (contains(p,"left_hdir")) {
-    setLeftHorizontalDirection(getValue(p,"left_hdir"));
-    units_["left_hdir"] = getUnit(p,"left_hdir");
+  if (contains(p,keys::left_hdir)) {
+    setLeftHorizontalDirection(getValue(p,keys::left_hdir));
+    units_["left_hdir"] = getUnit(p,keys::left_hdir);
     setit = true;
   }
-  if (contains(p,"right_hdir")) {
-    setRightHorizontalDirection(getValue(p,"right_hdir"));
-    units_["right_hdir"] = getUnit(p,"right_hdir");
+  if (contains(p,keys::right_hdir)) {
+    setRightHorizontalDirection(getValue(p,keys::right_hdir));
+    units_["right_hdir"] = getUnit(p,keys::right_hdir);
     setit = true;
   }
-  if (contains(p,"min_hs")) {
-    setMinHorizontalSpeed(getValue(p,"min_hs"));
-    units_["min_hs"] = getUnit(p,"min_hs");
+  if (contains(p,keys::min_hs)) {
+    setMinHorizontalSpeed(getValue(p,keys::min_hs));
+    units_["min_hs"] = getUnit(p,keys::min_hs);
     setit = true;
   }
-  if (contains(p,"max_hs")) {
-    setMaxHorizontalSpeed(getValue(p,"max_hs"));
-    units_["max_hs"] = getUnit(p,"max_hs");
+  if (contains(p,keys::max_hs)) {
+    setMaxHorizontalSpeed(getValue(p,keys::max_hs));
+    units_["max_hs"] = getUnit(p,keys::max_hs);
     setit = true;
   }
-  if (contains(p,"min_vs")) {
-    setMinVerticalSpeed(getValue(p,"min_vs"));
-    units_["min_vs"] = getUnit(p,"min_vs");
+  if (contains(p,keys::min_vs)) {
+    setMinVerticalSpeed(getValue(p,keys::min_vs));
+    units_["min_vs"] = getUnit(p,keys::min_vs);
     setit = true;
   }
-  if (contains(p,"max_vs")) {
-    setMaxVerticalSpeed(getValue(p,"max_vs"));
-    units_["max_vs"] = getUnit(p,"max_vs");
+  if (contains(p,keys::max_vs)) {
+    setMaxVerticalSpeed(getValue(p,keys::max_vs));
+    units_["max_vs"] = getUnit(p,keys::max_vs);
     setit = true;
   }
-  if (contains(p,"min_alt")) {
-    setMinAltitude(getValue(p,"min_alt"));
-    units_["min_alt"] = getUnit(p,"min_alt");
+  if (contains(p,keys::min_alt)) {
+    setMinAltitude(getValue(p,keys::min_alt));
+    units_["min_alt"] = getUnit(p,keys::min_alt);
     setit = true;
   }
-  if (contains(p,"max_alt")) {
-    setMaxAltitude(getValue(p,"max_alt"));
-    units_["max_alt"] = getUnit(p,"max_alt");
+  if (contains(p,keys::max_alt)) {
+    setMaxAltitude(getValue(p,keys::max_alt));
+    units_["max_alt"] = getUnit(p,keys::max_alt);
     setit = true;
   }
   // Relative Bands
-  if (contains(p,"below_relative_hs")) {
-    setBelowRelativeHorizontalSpeed(getValue(p,"below_relative_hs"));
-    units_["below_relative_hs"] = getUnit(p,"below_relative_hs");
+  if (contains(p,keys::below_relative_hs)) {
+    setBelowRelativeHorizontalSpeed(getValue(p,keys::below_relative_hs));
+    units_["below_relative_hs"] = getUnit(p,keys::below_relative_hs);
     setit = true;
   }
-  if (contains(p,"above_relative_hs")) {
-    setAboveRelativeHorizontalSpeed(getValue(p,"above_relative_hs"));
-    units_["above_relative_hs"] = getUnit(p,"above_relative_hs");
+  if (contains(p,keys::above_relative_hs)) {
+    setAboveRelativeHorizontalSpeed(getValue(p,keys::above_relative_hs));
+    units_["above_relative_hs"] = getUnit(p,keys::above_relative_hs);
     setit = true;
   }
-  if (contains(p,"below_relative_vs")) {
-    setBelowRelativeVerticalSpeed(getValue(p,"below_relative_vs"));
-    units_["below_relative_vs"] = getUnit(p,"below_relative_vs");
+  if (contains(p,keys::below_relative_vs)) {
+    setBelowRelativeVerticalSpeed(getValue(p,keys::below_relative_vs));
+    units_["below_relative_vs"] = getUnit(p,keys::below_relative_vs);
     setit = true;
   }
-  if (contains(p,"above_relative_vs")) {
-    setAboveRelativeVerticalSpeed(getValue(p,"above_relative_vs"));
-    units_["above_relative_vs"] = getUnit(p,"above_relative_vs");
+  if (contains(p,keys::above_relative_vs)) {
+    setAboveRelativeVerticalSpeed(getValue(p,keys::above_relative_vs));
+    units_["above_relative_vs"] = getUnit(p,keys::above_relative_vs);
     setit = true;
   }
-  if (contains(p,"below_relative_alt")) {
-    setBelowRelativeAltitude(getValue(p,"below_relative_alt"));
-    units_["below_relative_alt"] = getUnit(p,"below_relative_alt");
+  if (contains(p,keys::below_relative_alt)) {
+    setBelowRelativeAltitude(getValue(p,keys::below_relative_alt));
+    units_["below_relative_alt"] = getUnit(p,keys::below_relative_alt);
     setit = true;
   }
-  if (contains(p,"above_relative_alt")) {
-    setAboveRelativeAltitude(getValue(p,"above_relative_alt"));
-    units_["above_relative_alt"] = getUnit(p,"above_relative_alt");
+  if (contains(p,keys::above_relative_alt)) {
+    setAboveRelativeAltitude(getValue(p,keys::above_relative_alt));
+    units_["above_relative_alt"] = getUnit(p,keys::above_relative_alt);
     setit = true;
   }
   // Kinematic bands
-  if (contains(p,"step_hdir")) {
-    setHorizontalDirectionStep(getValue(p,"step_hdir"));
-    units_["step_hdir"] = getUnit(p,"step_hdir");
+  if (contains(p,keys::step_hdir)) {
+    setHorizontalDirectionStep(getValue(p,keys::step_hdir));
+    units_["step_hdir"] = getUnit(p,keys::step_hdir);
     setit = true;
   }
-  if (contains(p,"step_hs")) {
-    setHorizontalSpeedStep(getValue(p,"step_hs"));
-    units_["step_hs"] = getUnit(p,"step_hs");
+  if (contains(p,keys::step_hs)) {
+    setHorizontalSpeedStep(getValue(p,keys::step_hs));
+    units_["step_hs"] = getUnit(p,keys::step_hs);
     setit = true;
   }
-  if (contains(p,"step_vs")) {
-    setVerticalSpeedStep(getValue(p,"step_vs"));
-    units_["step_vs"] = getUnit(p,"step_vs");
+  if (contains(p,keys::step_vs)) {
+    setVerticalSpeedStep(getValue(p,keys::step_vs));
+    units_["step_vs"] = getUnit(p,keys::step_vs);
     setit = true;
   }
-  if (contains(p,"step_alt")) {
-    setAltitudeStep(getValue(p,"step_alt"));
-    units_["step_alt"] = getUnit(p,"step_alt");
+  if (contains(p,keys::step_alt)) {
+    setAltitudeStep(getValue(p,keys::step_alt));
+    units_["step_alt"] = getUnit(p,keys::step_alt);
     setit = true;
   }
-  if (contains(p,"horizontal_accel")) {
-    setHorizontalAcceleration(getValue(p,"horizontal_accel"));
-    units_["horizontal_accel"] = getUnit(p,"horizontal_accel");
+  if (contains(p,keys::horizontal_accel)) {
+    setHorizontalAcceleration(getValue(p,keys::horizontal_accel));
+    units_["horizontal_accel"] = getUnit(p,keys::horizontal_accel);
     setit = true;
   }
-  if (contains(p,"vertical_accel")) {
-    setVerticalAcceleration(getValue(p,"vertical_accel"));
-    units_["vertical_accel"] = getUnit(p,"vertical_accel");
+  if (contains(p,keys::vertical_accel)) {
+    setVerticalAcceleration(getValue(p,keys::vertical_accel));
+    units_["vertical_accel"] = getUnit(p,keys::vertical_accel);
     setit = true;
   }
-  if (contains(p,"turn_rate")) {
-    set_turn_rate(getValue(p,"turn_rate"));
-    units_["turn_rate"] = getUnit(p,"turn_rate");
+  if (contains(p,keys::turn_rate)) {
+    set_turn_rate(getValue(p,keys::turn_rate));
+    units_["turn_rate"] = getUnit(p,keys::turn_rate);
     setit = true;
   }
-  if (contains(p,"bank_angle")) {
-    set_bank_angle(getValue(p,"bank_angle"));
-    units_["bank_angle"] = getUnit(p,"bank_angle");
+  if (contains(p,keys::bank_angle)) {
+    set_bank_angle(getValue(p,keys::bank_angle));
+    units_["bank_angle"] = getUnit(p,keys::bank_angle);
     setit = true;
   }
-  if (contains(p,"vertical_rate")) {
-    setVerticalRate(getValue(p,"vertical_rate"));
-    units_["vertical_rate"] = getUnit(p,"vertical_rate");
+  if (contains(p,keys::vertical_rate)) {
+    setVerticalRate(getValue(p,keys::vertical_rate));
+    units_["vertical_rate"] = getUnit(p,keys::vertical_rate);
     setit = true;
   }
   // Recovery bands
-  if (contains(p,"min_horizontal_recovery")) {
-    setMinHorizontalRecovery(getValue(p,"min_horizontal_recovery"));
-    units_["min_horizontal_recovery"] = getUnit(p,"min_horizontal_recovery");
+  if (contains(p,keys::min_horizontal_recovery)) {
+    setMinHorizontalRecovery(getValue(p,keys::min_horizontal_recovery));
+    units_["min_horizontal_recovery"] = getUnit(p,keys::min_horizontal_recovery);
     setit = true;
   }
-  if (contains(p,"min_vertical_recovery")) {
-    setMinVerticalRecovery(getValue(p,"min_vertical_recovery"));
-    units_["min_vertical_recovery"] = getUnit(p,"min_vertical_recovery");
+  if (contains(p,keys::min_vertical_recovery)) {
+    setMinVerticalRecovery(getValue(p,keys::min_vertical_recovery));
+    units_["min_vertical_recovery"] = getUnit(p,keys::min_vertical_recovery);
     setit = true;
   }
   // Recovery parameters
-  if (contains(p,"recovery_hdir")) {
-    setRecoveryHorizontalDirectionBands(getBool(p,"recovery_hdir"));
+  if (contains(p,keys::recovery_hdir)) {
+    setRecoveryHorizontalDirectionBands(getBool(p,keys::recovery_hdir));
     setit = true;
   }
-  if (contains(p,"recovery_hs")) {
-    setRecoveryHorizontalSpeedBands(getBool(p,"recovery_hs"));
+  if (contains(p,keys::recovery_hs)) {
+    setRecoveryHorizontalSpeedBands(getBool(p,keys::recovery_hs));
     setit = true;
   }
-  if (contains(p,"recovery_vs")) {
-    setRecoveryVerticalSpeedBands(getBool(p,"recovery_vs"));
+  if (contains(p,keys::recovery_vs)) {
+    setRecoveryVerticalSpeedBands(getBool(p,keys::recovery_vs));
     setit = true;
   }
-  if (contains(p,"recovery_alt")) {
-    setRecoveryAltitudeBands(getBool(p,"recovery_alt"));
+  if (contains(p,keys::recovery_alt)) {
+    setRecoveryAltitudeBands(getBool(p,keys::recovery_alt));
     setit = true;
   }
   // Collision avoidance
-  if (contains(p,"ca_bands")) {
-    setCollisionAvoidanceBands(getBool(p,"ca_bands"));
+  if (contains(p,keys::ca_bands)) {
+    setCollisionAvoidanceBands(getBool(p,keys::ca_bands));
     setit = true;
   }
-  if (contains(p,"ca_factor")) {
-    setCollisionAvoidanceBandsFactor(getValue(p,"ca_factor"));
+  if (contains(p,keys::ca_factor)) {
+    setCollisionAvoidanceBandsFactor(getValue(p,keys::ca_factor));
     setit = true;
   }
-  if (contains(p,"horizontal_nmac")) {
-    setHorizontalNMAC(getValue(p,"horizontal_nmac"));
-    units_["horizontal_nmac"] = getUnit(p,"horizontal_nmac");
+  if (contains(p,keys::horizontal_nmac)) {
+    setHorizontalNMAC(getValue(p,keys::horizontal_nmac));
+    units_["horizontal_nmac"] = getUnit(p,keys::horizontal_nmac);
     setit = true;
   }
-  if (contains(p,"vertical_nmac")) {
-    setVerticalNMAC(getValue(p,"vertical_nmac"));
-    units_["vertical_nmac"] = getUnit(p,"vertical_nmac");
+  if (contains(p,keys::vertical_nmac)) {
+    setVerticalNMAC(getValue(p,keys::vertical_nmac));
+    units_["vertical_nmac"] = getUnit(p,keys::vertical_nmac);
     setit = true;
   }
   // Hysteresis and persistence parameters
-  if (contains(p,"recovery_stability_time")) {
-    setRecoveryStabilityTime(getValue(p,"recovery_stability_time"));
-    units_["recovery_stability_time"] = getUnit(p,"recovery_stability_time");
+  if (contains(p,keys::recovery_stability_time)) {
+    setRecoveryStabilityTime(getValue(p,keys::recovery_stability_time));
+    units_["recovery_stability_time"] = getUnit(p,keys::recovery_stability_time);
     setit = true;
   }
-  if (contains(p,"hysteresis_time")) {
-    setHysteresisTime(getValue(p,"hysteresis_time"));
-    units_["hysteresis_time"] = getUnit(p,"hysteresis_time");
+  if (contains(p,keys::hysteresis_time)) {
+    setHysteresisTime(getValue(p,keys::hysteresis_time));
+    units_["hysteresis_time"] = getUnit(p,keys::hysteresis_time);
     setit = true;
   }
-  if (contains(p,"persistence_time")) {
-    setPersistenceTime(getValue(p,"persistence_time"));
-    units_["persistence_time"] = getUnit(p,"persistence_time");
+  if (contains(p,keys::persistence_time)) {
+    setPersistenceTime(getValue(p,keys::persistence_time));
+    units_["persistence_time"] = getUnit(p,keys::persistence_time);
     setit = true;
   }
-  if (contains(p,"bands_persistence")) {
-    setBandsPersistence(getBool(p,"bands_persistence"));
+  if (contains(p,keys::bands_persistence)) {
+    setBandsPersistence(getBool(p,keys::bands_persistence));
     setit = true;
   }
-  if (contains(p,"persistence_preferred_hdir")) {
-    setPersistencePreferredHorizontalDirectionResolution(getValue(p,"persistence_preferred_hdir"));
-    units_["persistence_preferred_hdir"] = getUnit(p,"persistence_preferred_hdir");
+  if (contains(p,keys::persistence_preferred_hdir)) {
+    setPersistencePreferredHorizontalDirectionResolution(getValue(p,keys::persistence_preferred_hdir));
+    units_["persistence_preferred_hdir"] = getUnit(p,keys::persistence_preferred_hdir);
     setit = true;
   }
-  if (contains(p,"persistence_preferred_hs")) {
-    setPersistencePreferredHorizontalSpeedResolution(getValue(p,"persistence_preferred_hs"));
-    units_["persistence_preferred_hs"] = getUnit(p,"persistence_preferred_hs");
+  if (contains(p,keys::persistence_preferred_hs)) {
+    setPersistencePreferredHorizontalSpeedResolution(getValue(p,keys::persistence_preferred_hs));
+    units_["persistence_preferred_hs"] = getUnit(p,keys::persistence_preferred_hs);
     setit = true;
   }
-  if (contains(p,"persistence_preferred_vs")) {
-    setPersistencePreferredVerticalSpeedResolution(getValue(p,"persistence_preferred_vs"));
-    units_["persistence_preferred_vs"] = getUnit(p,"persistence_preferred_vs");
+  if (contains(p,keys::persistence_preferred_vs)) {
+    setPersistencePreferredVerticalSpeedResolution(getValue(p,keys::persistence_preferred_vs));
+    units_["persistence_preferred_vs"] = getUnit(p,keys::persistence_preferred_vs);
     setit = true;
   }
-  if (contains(p,"persistence_preferred_alt")) {
-    setPersistencePreferredAltitudeResolution(getValue(p,"persistence_preferred_alt"));
-    units_["persistence_preferred_alt"] = getUnit(p,"persistence_preferred_alt");
+  if (contains(p,keys::persistence_preferred_alt)) {
+    setPersistencePreferredAltitudeResolution(getValue(p,keys::persistence_preferred_alt));
+    units_["persistence_preferred_alt"] = getUnit(p,keys::persistence_preferred_alt);
     setit = true;
   }
-  if (contains(p,"alerting_m")) {
-    set_alerting_parameterM(getInt(p,"alerting_m"));
+  if (contains(p,keys::alerting_m)) {
+    set_alerting_parameterM(getInt(p,keys::alerting_m));
     setit = true;
   }
-  if (contains(p,"alerting_n")) {
-    set_alerting_parameterN(getInt(p,"alerting_n"));
+  if (contains(p,keys::alerting_n)) {
+    set_alerting_parameterN(getInt(p,keys::alerting_n));
     setit = true;
   }
   // Implicit Coordination
-  if (contains(p,"conflict_crit")) {
-    setConflictCriteria(getBool(p,"conflict_crit"));
+  if (contains(p,keys::conflict_crit)) {
+    setConflictCriteria(getBool(p,keys::conflict_crit));
     setit = true;
   }
-  if (contains(p,"recovery_crit")) {
-    setRecoveryCriteria(getBool(p,"recovery_crit"));
+  if (contains(p,keys::recovery_crit)) {
+    setRecoveryCriteria(getBool(p,keys::recovery_crit));
     setit = true;
   }
   // Sensor Uncertainty Mitigation
-  if (contains(p,"h_pos_z_score")) {
-    setHorizontalPositionZScore(getValue(p,"h_pos_z_score"));
+  if (contains(p,keys::h_pos_z_score)) {
+    setHorizontalPositionZScore(getValue(p,keys::h_pos_z_score));
     setit = true;
   }
-  if (contains(p,"h_vel_z_score_min")) {
-    setHorizontalVelocityZScoreMin(getValue(p,"h_vel_z_score_min"));
+  if (contains(p,keys::h_vel_z_score_min)) {
+    setHorizontalVelocityZScoreMin(getValue(p,keys::h_vel_z_score_min));
     setit = true;
   }
-  if (contains(p,"h_vel_z_score_max")) {
-    setHorizontalVelocityZScoreMax(getValue(p,"h_vel_z_score_max"));
+  if (contains(p,keys::h_vel_z_score_max)) {
+    setHorizontalVelocityZScoreMax(getValue(p,keys::h_vel_z_score_max));
     setit = true;
   }
-  if (contains(p,"h_vel_z_distance")) {
-    setHorizontalVelocityZDistance(getValue(p,"h_vel_z_distance"));
-    units_["h_vel_z_distance"] = getUnit(p,"h_vel_z_distance");
+  if (contains(p,keys::h_vel_z_distance)) {
+    setHorizontalVelocityZDistance(getValue(p,keys::h_vel_z_distance));
+    units_["h_vel_z_distance"] = getUnit(p,keys::h_vel_z_distance);
     setit = true;
   }
-  if (contains(p,"v_pos_z_score")) {
-    setVerticalPositionZScore(getValue(p,"v_pos_z_score"));
+  if (contains(p,keys::v_pos_z_score)) {
+    setVerticalPositionZScore(getValue(p,keys::v_pos_z_score));
     setit = true;
   }
-  if (contains(p,"v_vel_z_score")) {
-    setVerticalSpeedZScore(getValue(p,"v_vel_z_score"));
+  if (contains(p,keys::v_vel_z_score)) {
+    setVerticalSpeedZScore(getValue(p,keys::v_vel_z_score));
     setit = true;
   }
   // Contours
-  if (contains(p,"contour_thr")) {
-    setHorizontalContourThreshold(getValue(p,"contour_thr"));
-    units_["contour_thr"] = getUnit(p,"contour_thr");
+  if (contains(p,keys::contour_thr)) {
+    setHorizontalContourThreshold(getValue(p,keys::contour_thr));
+    units_["contour_thr"] = getUnit(p,keys::contour_thr);
     setit = true;
   }
   // DAA Terminal Area (DTA)
-  if (contains(p,"dta_logic")) {
-    setDTALogic(getInt(p,"dta_logic"));
+  if (contains(p,keys::dta_logic)) {
+    setDTALogic(getInt(p,keys::dta_logic));
     setit = true;
   }
-  if (contains(p,"dta_latitude")) {
-    setDTALatitude(getValue(p,"dta_latitude"));
-    units_["dta_latitude"] = getUnit(p,"dta_latitude");
+  if (contains(p,keys::dta_latitude)) {
+    setDTALatitude(getValue(p,keys::dta_latitude));
+    units_["dta_latitude"] = getUnit(p,keys::dta_latitude);
     setit = true;
   }
-  if (contains(p,"dta_longitude")) {
-    setDTALongitude(getValue(p,"dta_longitude"));
-    units_["dta_longitude"] = getUnit(p,"dta_longitude");
+  if (contains(p,keys::dta_longitude)) {
+    setDTALongitude(getValue(p,keys::dta_longitude));
+    units_["dta_longitude"] = getUnit(p,keys::dta_longitude);
     setit = true;
   }
-  if (contains(p,"dta_radius")) {
-    setDTARadius(getValue(p,"dta_radius"));
-    units_["dta_radius"] = getUnit(p,"dta_radius");
+  if (contains(p,keys::dta_radius)) {
+    setDTARadius(getValue(p,keys::dta_radius));
+    units_["dta_radius"] = getUnit(p,keys::dta_radius);
     setit = true;
   }
-  if (contains(p,"dta_height")) {
-    setDTAHeight(getValue(p,"dta_height"));
-    units_["dta_height"] = getUnit(p,"dta_height");
+  if (contains(p,keys::dta_height)) {
+    setDTAHeight(getValue(p,keys::dta_height));
+    units_["dta_height"] = getUnit(p,keys::dta_height);
     setit = true;
   }
-  if (contains(p,"dta_alerter")) {
-    setDTAAlerter(getInt(p,"dta_alerter"));
+  if (contains(p,keys::dta_alerter)) {
+    setDTAAlerter(getInt(p,keys::dta_alerter));
     setit = true;
   }
   // Alerting logic
-  if (contains(p,"ownship_centric_alerting")) {
-    setAlertingLogic(getBool(p,"ownship_centric_alerting"));
+  if (contains(p,keys::ownship_centric_alerting)) {
+    setAlertingLogic(getBool(p,keys::ownship_centric_alerting));
     setit = true;
   }
   bool daidalus_v1=false;
   // Corrective Region
-  if (contains(p,"corrective_region")) {
-    setCorrectiveRegion(BandsRegion::valueOf(getString(p,"corrective_region")));
+  if (contains(p,keys::corrective_region)) {
+    setCorrectiveRegion(BandsRegion::valueOf(getString(p,keys::corrective_region)));
     setit = true;
-  } else if (contains(p,"conflict_level")) {
+  } else if (contains(p,keys::conflict_level)) {
     daidalus_v1=true;
     setit = true;
   }
@@ -2516,14 +2630,14 @@ bool DaidalusParameters::setParameterData(const ParameterData& p) {
     if (alerter.isValid()) {
       alerters_.clear();
       alerters_.push_back(alerter);
-      int conflict_level=getInt(p,"conflict_level");
+      int conflict_level=getInt(p,keys::conflict_level);
       if (1 <= conflict_level && conflict_level <= alerter.mostSevereAlertLevel()) {
         setCorrectiveRegion(alerter.getLevel(conflict_level).getRegion());
       }
     }
   } else {
-    if (contains(p,"alerters")) {
-      std::vector<std::string> alerter_list = getListString(p,"alerters");
+    if (contains(p,keys::alerters)) {
+      std::vector<std::string> alerter_list = getListString(p,keys::alerters.name());
       readAlerterList(alerter_list,p);
       setit = true;
     }
@@ -6,6 +6,14 @@
 #include "Velocity.h"
 #include "Util.h"
 #include "string_util.h"
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <exception>
 
 using namespace larcfm;
 
@@ -108,10 +116,9 @@ std::string DaidalusProcessor::getOptionsString() {
 	return options_;
 }
 
-void DaidalusProcessor::processFile(const std::string& filename, Daidalus &daa) {
-	DaidalusFileWalker dw = DaidalusFileWalker(filename);
-	double from = from_;
-	double to = to_;
+bool DaidalusProcessor::timeRange(const DaidalusFileWalker& dw, double& from, double& to) const {
+	from = from_;
+	to = to_;
 	if (from < 0) {
 		from = dw.firstTime();
 	}
@@ -124,23 +131,180 @@ void DaidalusProcessor::processFile(const std::string& filename, Daidalus &daa)
 	if (relative_ < 0) {
 		from = to + relative_;
 	}
-	if (dw.goToTime(from) && from <= to) {
+	return from <= to;
+}
+
+bool DaidalusProcessor::selectOwnship(Daidalus& daa, double t) const {
+	if (ownship_ != "") {
+		daa.resetOwnship(ownship_);
+		if (daa.hasError()) {
+			std::cerr << "** Warning: State for ownship aircraft ("<< ownship_ <<
+					") not found at time. Skipping time " << t << " [s]" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+void DaidalusProcessor::processFile(const std::string& filename, Daidalus &daa) {
+	DaidalusFileWalker dw = DaidalusFileWalker(filename);
+	double from;
+	double to;
+	if (timeRange(dw,from,to) && dw.goToTime(from)) {
 		while (!dw.atEnd() && dw.getTime() <= to) {
 			double t = dw.getTime();
 			dw.readState(daa);
-			if (ownship_ != "") {
-				daa.resetOwnship(ownship_);
-				if (daa.hasError()) {
-					std::cerr << "** Warning: State for ownship aircraft ("<< ownship_ <<
-							") not found at time. Skipping time " << t << " [s]" << std::endl;
-					continue;
-				}
+			if (selectOwnship(daa,t)) {
+				processTime(daa,filename);
 			}
-			processTime(daa,filename);
 		}
 	}
 }
 
+void DaidalusProcessor::processFile(const std::string& filename, Daidalus &daa, std::ostream& out) {
+	DaidalusFileWalker dw = DaidalusFileWalker(filename);
+	processFileHeader(daa,filename,out);
+	double from;
+	double to;
+	if (timeRange(dw,from,to) && dw.goToTime(from)) {
+		while (!dw.atEnd() && dw.getTime() <= to) {
+			double t = dw.getTime();
+			dw.readState(daa);
+			if (selectOwnship(daa,t)) {
+				processTimeStep(daa,filename,out);
+			}
+		}
+	}
+}
+
+void DaidalusProcessor::processFileHeader(Daidalus& /*daa*/, const std::string& /*filename*/, std::ostream& /*out*/) {
+}
+
+void DaidalusProcessor::processTimeStep(Daidalus& daa, const std::string& filename, std::ostream& /*out*/) {
+	std::lock_guard<std::mutex> guard(process_time_lock_);
+	processTime(daa,filename);
+}
 
+// Run task(worker,i,out) for i in [0,n) on nthreads threads, where worker is the index of the
+// thread. The output of the tasks is written to out in the order of i, as soon as all the
+// previous tasks are done, so that only the output of the tasks in progress is kept in memory.
+// If a task throws, tasks that have not started are skipped, the output of the tasks before
+// it is written, and the exception is rethrown once all the threads are joined.
+static void runInOrder(int n, int nthreads, const std::function<void(int,int,std::ostream&)>& task, std::ostream& out) {
+	std::vector<std::string> text(n);
+	std::vector<bool> done(n,false);
+	std::mutex lock;
+	std::condition_variable cv;
+	std::atomic<int> next(0);
+	std::exception_ptr error;
+	std::vector<std::thread> workers;
+	for (int w = 0; w < nthreads; ++w) {
+		workers.push_back(std::thread([&,w]() {
+			for (int i = next++; i < n; i = next++) {
+				std::ostringstream os;
+				try {
+					task(w,i,os);
+				} catch (...) {
+					std::lock_guard<std::mutex> guard(lock);
+					if (!error) {
+						error = std::current_exception();
+					}
+					next = n;
+					cv.notify_one();
+					return;
+				}
+				std::lock_guard<std::mutex> guard(lock);
+				text[i] = os.str();
+				done[i] = true;
+				cv.notify_one();
+			}
+		}));
+	}
+	try {
+		for (int i = 0; i < n; ++i) {
+			std::string s;
+			{
+				std::unique_lock<std::mutex> guard(lock);
+				cv.wait(guard,[&]() { return done[i] || error; });
+				if (!done[i]) {
+					break;
+				}
+				s.swap(text[i]);
+			}
+			out << s;
+		}
+	} catch (...) {
+		std::lock_guard<std::mutex> guard(lock);
+		if (!error) {
+			error = std::current_exception();
+		}
+		next = n;
+	}
+	for (int w = 0; w < nthreads; ++w) {
+		workers[w].join();
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
 
+static int numberOfThreads(int nthreads, int ntasks) {
+	if (nthreads <= 0) {
+		nthreads = static_cast<int>(std::thread::hardware_concurrency());
+	}
+	return std::max(1,std::min(nthreads,ntasks));
+}
 
+void DaidalusProcessor::processFiles(const std::vector<std::string>& filenames, const Daidalus& daa, std::ostream& out, int nthreads) {
+	int n = static_cast<int>(filenames.size());
+	nthreads = numberOfThreads(nthreads,n);
+	std::vector<Daidalus> daas(nthreads,daa);
+	// Reading a file sets global accuracy constants, so files are read one at a time
+	std::mutex read_lock;
+	runInOrder(n,nthreads,[&](int w, int i, std::ostream& os) {
+		std::unique_lock<std::mutex> guard(read_lock);
+		DaidalusFileWalker dw(filenames[i]);
+		guard.unlock();
+		Daidalus& d = daas[w];
+		d = daa;
+		processFileHeader(d,filenames[i],os);
+		double from;
+		double to;
+		if (timeRange(dw,from,to) && dw.goToTime(from)) {
+			while (!dw.atEnd() && dw.getTime() <= to) {
+				double t = dw.getTime();
+				dw.readState(d);
+				if (selectOwnship(d,t)) {
+					processTimeStep(d,filenames[i],os);
+				}
+			}
+		}
+	},out);
+}
+
+void DaidalusProcessor::processTimeSteps(const std::string& filename, const Daidalus& daa, std::ostream& out, int nthreads) {
+	DaidalusFileWalker dw(filename);
+	double from;
+	double to;
+	if (!timeRange(dw,from,to) || dw.indexOfTime(from) < 0) {
+		return;
+	}
+	int first = dw.indexOfTime(from);
+	int last = first;
+	while (last < dw.numberOfTimeSteps() && dw.goToTimeStep(last) && dw.getTime() <= to) {
+		++last;
+	}
+	int n = last-first;
+	nthreads = numberOfThreads(nthreads,n);
+	std::vector<Daidalus> daas(nthreads,daa);
+	Daidalus header = daa;
+	processFileHeader(header,filename,out);
+	runInOrder(n,nthreads,[&](int w, int i, std::ostream& os) {
+		Daidalus& d = daas[w];
+		d.clearHysteresis();
+		dw.readStateAt(d,first+i);
+		if (selectOwnship(d,d.getCurrentTime())) {
+			processTimeStep(d,filename,os);
+		}
+	},out);
+}
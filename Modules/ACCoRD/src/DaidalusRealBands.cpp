@@ -225,10 +225,19 @@ void DaidalusRealBands::stale() {
 }
 
 /**
- * clear hysteresis
+ * clear hysteresis and per-intruder integer bands
  */
 void DaidalusRealBands::clear_hysteresis() {
   bands_hysteresis_.reset();
+  // Hysteresis is cleared when parameters are (re)loaded
+  clear_bands_cache();
+}
+
+/**
+ * Clear per-intruder integer bands. Required when parameters or alerters change.
+ */
+void DaidalusRealBands::clear_bands_cache() {
+  bands_cache_acs_.clear();
   stale();
 }
 
@@ -245,6 +254,8 @@ bool DaidalusRealBands::isFresh() const {
 void DaidalusRealBands::refresh(DaidalusCore& core) {
   if (outdated_) {
     if (set_input(core.parameters,core.ownship,core.DTAStatus())) {
+      // Ownship trajectories are the same for all traffic aircraft and alert levels
+      share_ownship_trajectories(true);
       for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
         acs_bands_[conflict_region] = core.acs_conflict_bands(conflict_region);
         if (core.bands_for(conflict_region)) {
@@ -253,6 +264,8 @@ void DaidalusRealBands::refresh(DaidalusCore& core) {
         }
       }
       compute(core);
+      share_ownship_trajectories(false);
+      prune_bands_cache(core);
     }
     outdated_ = false;
   }
@@ -398,7 +411,11 @@ void DaidalusRealBands::compute_none_bands(IntervalSet& none_set_region, const s
         } else {
           saturateNoneIntervalSet(noneset2);
         }
-      } else if (B <= T) {
+      } else if (det == NULL && recovery == NULL) {
+        cached_none_bands(noneset2,detector,alerter_idx,ilt_ptr->level,
+            core.epsilonH(recovery_case,intruder),core.epsilonV(recovery_case,intruder),B,T,
+            core.parameters,core.ownship,intruder);
+      } else {
         none_bands(noneset2,detector,recovery,
             core.epsilonH(recovery_case,intruder),core.epsilonV(recovery_case,intruder),B,T,
             core.parameters,core.ownship,intruder);
@@ -411,6 +428,48 @@ void DaidalusRealBands::compute_none_bands(IntervalSet& none_set_region, const s
   }
 }
 
+/**
+ * None bands of intruder for the core detector of given alerter and alert level, without recovery
+ * detector. The integer bands are reused until the aircraft states or their inputs change.
+ */
+void DaidalusRealBands::cached_none_bands(IntervalSet& noneset, Detection3D* detector, int alerter_idx, int alert_level,
+    int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) {
+  IntegerBandsCacheData& entry = bands_cache_acs_[traffic.getId()];
+  if (!entry.isValidFor(ownship,traffic,alerter_idx)) {
+    entry.reset(ownship,traffic,alerter_idx);
+  }
+  IntegerBandsCacheData::BandsInput input;
+  input.epsh = epsh;
+  input.epsv = epsv;
+  input.B = B;
+  input.T = T;
+  input.tstep = instantaneous_bands(parameters) ?  0.0 : time_step(parameters,ownship);
+  input.maxdown = maxdown(parameters,ownship);
+  input.maxup = maxup(parameters,ownship);
+  input.min_val = min_val_;
+  input.max_val = max_val_;
+  if (!entry.hasIntegerBands(alert_level,input)) {
+    std::vector<Integerval> bands_int;
+    integer_none_bands(bands_int,detector,NULL,epsh,epsv,B,T,parameters,ownship,traffic);
+    entry.setIntegerBands(alert_level,input,bands_int);
+  }
+  toIntervalSet(noneset,entry.getIntegerBands(alert_level),get_step(parameters),integer_bands_origin(ownship));
+}
+
+/**
+ * Remove cached integer bands of aircraft that are no longer in the traffic list
+ */
+void DaidalusRealBands::prune_bands_cache(const DaidalusCore& core) {
+  std::map<std::string,IntegerBandsCacheData>::iterator entry_ptr = bands_cache_acs_.begin();
+  while (entry_ptr != bands_cache_acs_.end()) {
+    if (core.find_traffic_state(entry_ptr->first) >= 0) {
+      ++entry_ptr;
+    } else {
+      bands_cache_acs_.erase(entry_ptr++);
+    }
+  }
+}
+
 /**
  * Compute recovery bands. Class variables recovery_time_, recovery_horizontal_distance_,
  * and recovery_vertical_distance_ are set.
@@ -732,18 +791,33 @@ void DaidalusRealBands::toIntervalSet(IntervalSet& noneset, const std::vector<In
 }
 
 /**
- * The output parameter noneset has a list of non-conflict ranges orderd within [min,max]
- * values (or [0,mod] in the case of circular bands, i.e., when mod == 0).
+ * The output parameter bands_int has a list of non-conflict ranges in steps from integer_bands_origin
  */
-void DaidalusRealBands::none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
+void DaidalusRealBands::integer_none_bands(std::vector<Integerval>& bands_int, const Detection3D* conflict_det, const Detection3D* recovery_det,
     int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
-  std::vector<Integerval> bands_int;
   int mino = maxdown(parameters,ownship);
   int maxo = maxup(parameters,ownship);
   double tstep = instantaneous_bands(parameters) ?  0.0 : time_step(parameters,ownship);
   integer_bands_combine(bands_int,conflict_det,recovery_det,tstep,
       B,T,mino,maxo,parameters,ownship,traffic,epsh,epsv);
-  toIntervalSet(noneset,bands_int,get_step(parameters),own_val(ownship));
+}
+
+/**
+ * Value of step 0 of the integer bands
+ */
+double DaidalusRealBands::integer_bands_origin(const TrafficState& ownship) const {
+  return own_val(ownship);
+}
+
+/**
+ * The output parameter noneset has a list of non-conflict ranges orderd within [min,max]
+ * values (or [0,mod] in the case of circular bands, i.e., when mod == 0).
+ */
+void DaidalusRealBands::none_bands(IntervalSet& noneset, const Detection3D* conflict_det, const Detection3D* recovery_det,
+    int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
+  std::vector<Integerval> bands_int;
+  integer_none_bands(bands_int,conflict_det,recovery_det,epsh,epsv,B,T,parameters,ownship,traffic);
+  toIntervalSet(noneset,bands_int,get_step(parameters),integer_bands_origin(ownship));
 }
 
 bool DaidalusRealBands::any_red(const Detection3D* conflict_det, const Detection3D* recovery_det,
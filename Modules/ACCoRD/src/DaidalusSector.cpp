@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2015-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "DaidalusSector.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace larcfm {
+
+void DaidalusSector::SectorBands::clear() {
+  offset.assign(1,0);
+  interval.clear();
+  region.clear();
+}
+
+void DaidalusSector::SectorBands::add(const std::vector<Interval>& ints, const std::vector<BandsRegion::Region>& regs) {
+  interval.insert(interval.end(),ints.begin(),ints.end());
+  region.insert(region.end(),regs.begin(),regs.end());
+  offset.push_back(static_cast<int>(interval.size()));
+}
+
+int DaidalusSector::SectorBands::length(int row) const {
+  if (row < 0 || row+1 >= static_cast<int>(offset.size())) {
+    return 0;
+  }
+  return offset[row+1]-offset[row];
+}
+
+DaidalusSector::DaidalusSector() : nthreads_(1), time_(0.0) {
+  for (int b = 0; b < 4; ++b) {
+    bands_[b].clear();
+  }
+}
+
+DaidalusSector::DaidalusSector(const Daidalus& daa, int nthreads) : daa_(daa), nthreads_(nthreads), time_(0.0) {
+  for (int b = 0; b < 4; ++b) {
+    bands_[b].clear();
+  }
+}
+
+void DaidalusSector::setDaidalus(const Daidalus& daa) {
+  daa_ = daa;
+  own_.clear();
+}
+
+const Daidalus& DaidalusSector::getDaidalus() const {
+  return daa_;
+}
+
+void DaidalusSector::setNumberOfThreads(int n) {
+  nthreads_ = n;
+}
+
+int DaidalusSector::getNumberOfThreads() const {
+  return nthreads_;
+}
+
+void DaidalusSector::clear() {
+  ids_.clear();
+  pos_.clear();
+  vel_.clear();
+  times_.clear();
+  row_.clear();
+  ownships_.clear();
+  index_.clear();
+  alerts_.clear();
+  for (int b = 0; b < 4; ++b) {
+    bands_[b].clear();
+  }
+}
+
+int DaidalusSector::addAircraft(const std::string& id, const Position& pos, const Velocity& vel, double time, bool isOwnship) {
+  int ac = static_cast<int>(ids_.size());
+  if (!index_.insert(std::make_pair(id,ac)).second) {
+    return -1;
+  }
+  ids_.push_back(id);
+  pos_.push_back(pos);
+  vel_.push_back(vel);
+  times_.push_back(time);
+  if (isOwnship) {
+    row_.push_back(static_cast<int>(ownships_.size()));
+    ownships_.push_back(ac);
+  } else {
+    row_.push_back(-1);
+  }
+  return ac;
+}
+
+int DaidalusSector::addAircraft(const std::string& id, const Position& pos, const Velocity& vel, double time) {
+  return addAircraft(id,pos,vel,time,true);
+}
+
+int DaidalusSector::numberOfAircraft() const {
+  return static_cast<int>(ids_.size());
+}
+
+const std::string& DaidalusSector::getAircraftId(int ac) const {
+  return ids_[ac];
+}
+
+int DaidalusSector::aircraftIndex(const std::string& id) const {
+  std::map<std::string,int>::const_iterator it = index_.find(id);
+  return it == index_.end() ? -1 : it->second;
+}
+
+bool DaidalusSector::isOwnship(int ac) const {
+  return ac >= 0 && ac < static_cast<int>(row_.size()) && row_[ac] >= 0;
+}
+
+double DaidalusSector::getCurrentTime() const {
+  return time_;
+}
+
+// Same sequence of calls as a single Daidalus object processing this ownship
+void DaidalusSector::computeOwnship(int row, Daidalus& daa, OwnshipResult& res) {
+  int own = ownships_[row];
+  int n = static_cast<int>(ids_.size());
+  daa.setOwnshipState(ids_[own],cur_pos_[own],vel_[own],time_);
+  std::vector<int> idx(n,-1);
+  for (int ac = 0; ac < n; ++ac) {
+    if (ac != own) {
+      idx[ac] = daa.addTrafficState(ids_[ac],cur_pos_[ac],vel_[ac],time_);
+    }
+  }
+  int* alerts = &alerts_[row*n];
+  for (int ac = 0; ac < n; ++ac) {
+    alerts[ac] = idx[ac] > 0 ? daa.alertLevel(idx[ac]) : -1;
+  }
+  for (int i = 0; i < daa.horizontalDirectionBandsLength(); ++i) {
+    res.ints[0].push_back(daa.horizontalDirectionIntervalAt(i));
+    res.regs[0].push_back(daa.horizontalDirectionRegionAt(i));
+  }
+  for (int i = 0; i < daa.horizontalSpeedBandsLength(); ++i) {
+    res.ints[1].push_back(daa.horizontalSpeedIntervalAt(i));
+    res.regs[1].push_back(daa.horizontalSpeedRegionAt(i));
+  }
+  for (int i = 0; i < daa.verticalSpeedBandsLength(); ++i) {
+    res.ints[2].push_back(daa.verticalSpeedIntervalAt(i));
+    res.regs[2].push_back(daa.verticalSpeedRegionAt(i));
+  }
+  for (int i = 0; i < daa.altitudeBandsLength(); ++i) {
+    res.ints[3].push_back(daa.altitudeIntervalAt(i));
+    res.regs[3].push_back(daa.altitudeRegionAt(i));
+  }
+}
+
+void DaidalusSector::compute(double time) {
+  time_ = time;
+  int n = static_cast<int>(ids_.size());
+  int nown = static_cast<int>(ownships_.size());
+
+  // Aircraft states are projected to the current time once for all ownships
+  cur_pos_.resize(n);
+  for (int ac = 0; ac < n; ++ac) {
+    double dt = time-times_[ac];
+    cur_pos_[ac] = dt == 0 ? pos_[ac] : pos_[ac].linear(vel_[ac],dt);
+  }
+
+  // Daidalus objects are created before the workers start, and those of aircraft that left are dropped
+  for (std::map<std::string,Daidalus>::iterator it = own_.begin(); it != own_.end();) {
+    if (isOwnship(aircraftIndex(it->first))) {
+      ++it;
+    } else {
+      own_.erase(it++);
+    }
+  }
+  std::vector<Daidalus*> daa(nown);
+  for (int row = 0; row < nown; ++row) {
+    const std::string& id = ids_[ownships_[row]];
+    std::map<std::string,Daidalus>::iterator it = own_.find(id);
+    if (it == own_.end()) {
+      it = own_.insert(std::make_pair(id,daa_)).first;
+    }
+    daa[row] = &it->second;
+  }
+
+  alerts_.assign(nown*n,-1);
+  std::vector<OwnshipResult> res(nown);
+  int nthreads = nthreads_ > 0 ? nthreads_ : static_cast<int>(std::thread::hardware_concurrency());
+  nthreads = std::max(1,std::min(nthreads,nown));
+  if (nthreads == 1) {
+    for (int row = 0; row < nown; ++row) {
+      computeOwnship(row,*daa[row],res[row]);
+    }
+  } else {
+    std::atomic<int> next(0);
+    std::vector<std::thread> workers;
+    for (int w = 0; w < nthreads; ++w) {
+      workers.push_back(std::thread([&]() {
+        for (int row = next++; row < nown; row = next++) {
+          computeOwnship(row,*daa[row],res[row]);
+        }
+      }));
+    }
+    for (int w = 0; w < nthreads; ++w) {
+      workers[w].join();
+    }
+  }
+
+  for (int b = 0; b < 4; ++b) {
+    bands_[b].clear();
+    for (int row = 0; row < nown; ++row) {
+      bands_[b].add(res[row].ints[b],res[row].regs[b]);
+    }
+  }
+}
+
+int DaidalusSector::alertLevel(int own, int ac) const {
+  if (!isOwnship(own) || ac < 0 || ac >= static_cast<int>(ids_.size())) {
+    return -1;
+  }
+  int row = row_[own];
+  int n = static_cast<int>(ids_.size());
+  if ((row+1)*n > static_cast<int>(alerts_.size())) {
+    return -1;
+  }
+  return alerts_[row*n+ac];
+}
+
+int DaidalusSector::horizontalDirectionBandsLength(int own) const {
+  return isOwnship(own) ? bands_[0].length(row_[own]) : 0;
+}
+
+Interval DaidalusSector::horizontalDirectionIntervalAt(int own, int i) const {
+  if (i < 0 || i >= horizontalDirectionBandsLength(own)) {
+    return Interval::EMPTY;
+  }
+  return bands_[0].interval[bands_[0].offset[row_[own]]+i];
+}
+
+BandsRegion::Region DaidalusSector::horizontalDirectionRegionAt(int own, int i) const {
+  if (i < 0 || i >= horizontalDirectionBandsLength(own)) {
+    return BandsRegion::UNKNOWN;
+  }
+  return bands_[0].region[bands_[0].offset[row_[own]]+i];
+}
+
+int DaidalusSector::horizontalSpeedBandsLength(int own) const {
+  return isOwnship(own) ? bands_[1].length(row_[own]) : 0;
+}
+
+Interval DaidalusSector::horizontalSpeedIntervalAt(int own, int i) const {
+  if (i < 0 || i >= horizontalSpeedBandsLength(own)) {
+    return Interval::EMPTY;
+  }
+  return bands_[1].interval[bands_[1].offset[row_[own]]+i];
+}
+
+BandsRegion::Region DaidalusSector::horizontalSpeedRegionAt(int own, int i) const {
+  if (i < 0 || i >= horizontalSpeedBandsLength(own)) {
+    return BandsRegion::UNKNOWN;
+  }
+  return bands_[1].region[bands_[1].offset[row_[own]]+i];
+}
+
+int DaidalusSector::verticalSpeedBandsLength(int own) const {
+  return isOwnship(own) ? bands_[2].length(row_[own]) : 0;
+}
+
+Interval DaidalusSector::verticalSpeedIntervalAt(int own, int i) const {
+  if (i < 0 || i >= verticalSpeedBandsLength(own)) {
+    return Interval::EMPTY;
+  }
+  return bands_[2].interval[bands_[2].offset[row_[own]]+i];
+}
+
+BandsRegion::Region DaidalusSector::verticalSpeedRegionAt(int own, int i) const {
+  if (i < 0 || i >= verticalSpeedBandsLength(own)) {
+    return BandsRegion::UNKNOWN;
+  }
+  return bands_[2].region[bands_[2].offset[row_[own]]+i];
+}
+
+int DaidalusSector::altitudeBandsLength(int own) const {
+  return isOwnship(own) ? bands_[3].length(row_[own]) : 0;
+}
+
+Interval DaidalusSector::altitudeIntervalAt(int own, int i) const {
+  if (i < 0 || i >= altitudeBandsLength(own)) {
+    return Interval::EMPTY;
+  }
+  return bands_[3].interval[bands_[3].offset[row_[own]]+i];
+}
+
+BandsRegion::Region DaidalusSector::altitudeRegionAt(int own, int i) const {
+  if (i < 0 || i >= altitudeBandsLength(own)) {
+    return BandsRegion::UNKNOWN;
+  }
+  return bands_[3].region[bands_[3].offset[row_[own]]+i];
+}
+
+}
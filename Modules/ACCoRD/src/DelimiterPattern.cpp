@@ -0,0 +1,164 @@
+/*
+ * DelimiterPattern
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "DelimiterPattern.h"
+#include <string>
+#include <vector>
+#if defined(_MSC_VER)
+#include <regex>
+#else
+#include <regex.h>
+#endif
+
+namespace larcfm {
+
+#if defined(_MSC_VER)
+class DelimiterPattern::Regex {
+public:
+	explicit Regex(const std::string& rgx) : ok(true) {
+		try {
+			re = std::regex(rgx);
+		} catch (std::regex_error&) {
+			ok = false;
+		}
+	}
+
+	bool search(const std::string& str, std::size_t pos, std::size_t& begin, std::size_t& end) const {
+		std::smatch m;
+		if (!std::regex_search(str.begin()+pos, str.end(), m, re)) {
+			return false;
+		}
+		begin = pos+m.position(0);
+		end = begin+m.length(0);
+		return true;
+	}
+
+	std::regex re;
+	bool ok;
+};
+#else
+class DelimiterPattern::Regex {
+public:
+	explicit Regex(const std::string& rgx) {
+		ok = regcomp(&re, rgx.c_str(), REG_EXTENDED) == 0;
+	}
+
+	~Regex() {
+		if (ok) {
+			regfree(&re);
+		}
+	}
+
+	bool search(const std::string& str, std::size_t pos, std::size_t& begin, std::size_t& end) const {
+		regmatch_t m[1];
+		if (regexec(&re, str.c_str()+pos, 1, m, 0) != 0) {
+			return false;
+		}
+		begin = pos+m[0].rm_so;
+		end = pos+m[0].rm_eo;
+		return true;
+	}
+
+	regex_t re;
+	bool ok;
+
+private:
+	Regex(const Regex&);
+	Regex& operator=(const Regex&);
+};
+#endif
+
+// Characters of a pattern of the form "[...]+", where the brackets only contain plain
+// characters, or the empty string if the pattern has any other form.
+static std::string characterSet(const std::string& rgx) {
+	if (rgx.size() < 4 || rgx[0] != '[' || rgx.compare(rgx.size()-2,2,"]+") != 0) {
+		return "";
+	}
+	std::string set = rgx.substr(1,rgx.size()-3);
+	if (set[0] == '^' || set.find_first_of("[]\\-") != std::string::npos) {
+		return "";
+	}
+	return set;
+}
+
+DelimiterPattern::DelimiterPattern() : valid_(true) {
+}
+
+DelimiterPattern::DelimiterPattern(const std::string& rgx) : rgx_(rgx), charset_(characterSet(rgx)), valid_(true) {
+	if (charset_.empty()) {
+		Regex* re = new Regex(rgx);
+		valid_ = re->ok;
+		regex_ = std::shared_ptr<const Regex>(re);
+	}
+}
+
+bool DelimiterPattern::valid() const {
+	return valid_;
+}
+
+const std::string& DelimiterPattern::pattern() const {
+	return rgx_;
+}
+
+bool DelimiterPattern::find(const std::string& str, std::size_t pos, std::size_t& begin, std::size_t& end) const {
+	if (!charset_.empty()) {
+		begin = str.find_first_of(charset_,pos);
+		if (begin == std::string::npos) {
+			return false;
+		}
+		end = str.find_first_not_of(charset_,begin);
+		if (end == std::string::npos) {
+			end = str.size();
+		}
+		return true;
+	}
+	if (!valid_ || !regex_) {
+		return false;
+	}
+	// An empty match does not separate anything
+	return regex_->search(str,pos,begin,end) && end > begin;
+}
+
+void DelimiterPattern::split(const std::string& str, std::vector<std::string>& fields) const {
+	std::size_t n = 0;
+	std::size_t pos = 0;
+	std::size_t begin;
+	std::size_t end;
+	while (pos < str.size()) {
+		bool found = find(str,pos,begin,end);
+		if (!found) {
+			begin = end = str.size();
+		}
+		if (n < fields.size()) {
+			fields[n].assign(str,pos,begin-pos);
+		} else {
+			fields.push_back(str.substr(pos,begin-pos));
+		}
+		++n;
+		pos = end;
+		if (found && pos == str.size()) {
+			// trailing delimiter, the last field is empty
+			if (n < fields.size()) {
+				fields[n].clear();
+			} else {
+				fields.push_back("");
+			}
+			++n;
+		}
+	}
+	fields.resize(n);
+}
+
+std::vector<std::string> DelimiterPattern::split(const std::string& str) const {
+	std::vector<std::string> fields;
+	split(str,fields);
+	return fields;
+}
+
+}
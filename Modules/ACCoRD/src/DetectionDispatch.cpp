@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2015-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "DetectionDispatch.h"
+#include "WCV_TAUMOD.h"
+#include "WCV_TCPA.h"
+#include "WCV_TAUMOD_SUM.h"
+#include "CDCylinder.h"
+#include "TCAS3D.h"
+#include "CD3D.h"
+#include "LossData.h"
+#include "Util.h"
+#include <typeinfo>
+
+namespace larcfm {
+
+namespace {
+
+// Horizontal methods of the WCV class D, called without virtual dispatch
+template <class D>
+class StaticHorizontal {
+public:
+  explicit StaticHorizontal(const D& det) : det_(det) {}
+  double horizontal_tvar(const Vect2& s, const Vect2& v) const {
+    return det_.D::horizontal_tvar(s,v);
+  }
+  LossData horizontal_WCV_interval(double T, const Vect2& s, const Vect2& v) const {
+    return det_.D::horizontal_WCV_interval(T,s,v);
+  }
+private:
+  const D& det_;
+};
+
+// Interval of loss of separation, as given by conflictDetectionWithTrafficState of each class
+
+LossData loss(const Detection3D& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return det.conflictDetectionWithTrafficState(ownship,intruder,B,T);
+}
+
+LossData loss(const WCV_TAUMOD& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return det.WCV_interval_with(StaticHorizontal<WCV_TAUMOD>(det),ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v(),B,T);
+}
+
+LossData loss(const WCV_TCPA& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return det.WCV_interval_with(StaticHorizontal<WCV_TCPA>(det),ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v(),B,T);
+}
+
+LossData loss(const CDCylinder& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return CD3D::detection(ownship.get_s().Sub(intruder.get_s()),ownship.get_v(),intruder.get_v(),
+      det.getHorizontalSeparation(),det.getVerticalSeparation(),B,T);
+}
+
+LossData loss(const TCAS3D& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return det.TCAS3D::RA3D(ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v(),B,T);
+}
+
+LossData loss(const WCV_TAUMOD_SUM& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  return det.WCV_taumod_uncertain_loss(ownship,intruder,B,T);
+}
+
+}
+
+DetectionDispatch::DetectionDispatch() :
+        det_(NULL), kind_(GENERIC) {}
+
+DetectionDispatch::DetectionDispatch(const Detection3D* det) :
+        det_(det), kind_(GENERIC) {
+  if (det == NULL) {
+    return;
+  }
+  // Exact classes only, a subclass may override any of the methods called by the instantiated code
+  const std::type_info& type = typeid(*det);
+  if (type == typeid(WCV_TAUMOD)) {
+    kind_ = WCV_TAUMOD_KIND;
+  } else if (type == typeid(WCV_TCPA)) {
+    kind_ = WCV_TCPA_KIND;
+  } else if (type == typeid(CDCylinder)) {
+    kind_ = CDCYLINDER_KIND;
+  } else if (type == typeid(TCAS3D)) {
+    kind_ = TCAS3D_KIND;
+  } else if (type == typeid(WCV_TAUMOD_SUM)) {
+    kind_ = WCV_TAUMOD_SUM_KIND;
+  }
+}
+
+const Detection3D* DetectionDispatch::getDetector() const {
+  return det_;
+}
+
+template <class D>
+bool DetectionDispatch::conflict(const D& det, const TrafficState& ownship, const TrafficState& intruder, double B, double T) {
+  if (Util::almost_equals(B,T)) {
+    LossData interval = loss(det,ownship,intruder,B,B+1);
+    return interval.conflict() && Util::almost_equals(interval.getTimeIn(),B);
+  }
+  if (B > T) {
+    return false;
+  }
+  return loss(det,ownship,intruder,B,T).conflict();
+}
+
+bool DetectionDispatch::conflictWithTrafficState(const TrafficState& ownship, const TrafficState& intruder, double B, double T) const {
+  switch (kind_) {
+  case WCV_TAUMOD_KIND:
+    return conflict(static_cast<const WCV_TAUMOD&>(*det_),ownship,intruder,B,T);
+  case WCV_TCPA_KIND:
+    return conflict(static_cast<const WCV_TCPA&>(*det_),ownship,intruder,B,T);
+  case CDCYLINDER_KIND:
+    return conflict(static_cast<const CDCylinder&>(*det_),ownship,intruder,B,T);
+  case TCAS3D_KIND:
+    return conflict(static_cast<const TCAS3D&>(*det_),ownship,intruder,B,T);
+  case WCV_TAUMOD_SUM_KIND:
+    return conflict(static_cast<const WCV_TAUMOD_SUM&>(*det_),ownship,intruder,B,T);
+  default:
+    return conflict(*det_,ownship,intruder,B,T);
+  }
+}
+
+bool DetectionDispatch::violationAtWithTrafficState(const TrafficState& ownship, const TrafficState& intruder, double t) const {
+  return conflictWithTrafficState(ownship,intruder,t,t);
+}
+
+}
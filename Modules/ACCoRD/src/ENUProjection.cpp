@@ -10,6 +10,7 @@
  * Rights Reserved.
  */
 #include "ENUProjection.h"
+#include "ProjectionArrays.h"
 #include "EuclideanProjection.h"
 #include "LatLonAlt.h"
 #include "GreatCircle.h"
@@ -65,25 +66,19 @@ namespace larcfm {
     }
   }
   
-  static Vect3 equator_map(const Vect3& ref, const Vect3& p) {
-    Vect3 xmult = ref.Hat();
-    Vect3 ymult = vect3_orthog_toy(ref).Hat();
-    Vect3 zmult = ref.cross(vect3_orthog_toy(ref)).Hat();
+  static Vect3 equator_map(const Vect3& xmult, const Vect3& ymult, const Vect3& zmult, const Vect3& p) {
     return Vect3(xmult.dot(p), ymult.dot(p), zmult.dot(p));
   }
   
-  static Vect3 equator_map_inv(const Vect3& ref, const Vect3& p) {
-    Vect3 xmult = ref.Hat();
-    Vect3 ymult = vect3_orthog_toy(ref).Hat();
-    Vect3 zmult = ref.cross(vect3_orthog_toy(ref)).Hat();
+  static Vect3 equator_map_inv(const Vect3& xmult, const Vect3& ymult, const Vect3& zmult, const Vect3& p) {
     Vect3 xmultInv = Vect3(xmult.x, ymult.x, zmult.x);
     Vect3 ymultInv = Vect3(xmult.y, ymult.y, zmult.y);
     Vect3 zmultInv = Vect3(xmult.z, ymult.z, zmult.z);
     return  Vect3(xmultInv.dot(p), ymultInv.dot(p), zmultInv.dot(p));
   }
   
-  static Vect2 sphere_to_plane(const Vect3& ref, const Vect3& p) {
-    Vect3 v = equator_map(ref,p);
+  static Vect2 sphere_to_plane(const Vect3& xmult, const Vect3& ymult, const Vect3& zmult, const Vect3& p) {
+    Vect3 v = equator_map(xmult,ymult,zmult,p);
     return Vect2(v.y, -v.z);
   }
   
@@ -100,6 +95,7 @@ namespace larcfm {
     	ref(Vect3()),
     	llaRef(LatLonAlt::ZERO()) {
       projAlt = 0;
+      initRotation();
       //ref = Vect3();
       //llaRef = LatLonAlt::ZERO();
     }
@@ -108,6 +104,7 @@ namespace larcfm {
     	ref(spherical2xyz(lla.lat(),lla.lon())),
     	llaRef(lla) {
         projAlt = lla.alt();
+        initRotation();
         //ref = spherical2xyz(lla.lat(),lla.lon());
         //llaRef = lla;
     }
@@ -116,10 +113,17 @@ namespace larcfm {
     	ref(spherical2xyz(lat,lon)),
     	llaRef(LatLonAlt::mk(lat, lon, alt)) {
         projAlt = alt;
+        initRotation();
         //ref = spherical2xyz(lat,lon);
         //llaRef = LatLonAlt::mk(lat, lon, alt);
     }
     
+    void ENUProjection::initRotation() {
+      xmult = ref.Hat();
+      ymult = vect3_orthog_toy(ref).Hat();
+      zmult = ref.cross(vect3_orthog_toy(ref)).Hat();
+    }
+
     ENUProjection ENUProjection::makeNew(const LatLonAlt& lla) const {
       return ENUProjection(lla);
     }
@@ -150,7 +154,7 @@ namespace larcfm {
 	}
 
     Vect2 ENUProjection::project2(const LatLonAlt& lla) const {
-      return sphere_to_plane(ref, spherical2xyz(lla.lat(),lla.lon()));
+      return sphere_to_plane(xmult, ymult, zmult, spherical2xyz(lla.lat(),lla.lon()));
     }
 
     Vect3 ENUProjection::project(const LatLonAlt& lla) const {
@@ -172,7 +176,7 @@ namespace larcfm {
     }
 
     LatLonAlt ENUProjection::inverse(const Vect2& xy, double alt) const {
-      return xyz2spherical(equator_map_inv(ref, plane_to_sphere(xy)), alt + projAlt);
+      return xyz2spherical(equator_map_inv(xmult, ymult, zmult, plane_to_sphere(xy)), alt + projAlt);
     }
 
     LatLonAlt ENUProjection::inverse(const Vect3& xyz) const {  
@@ -180,12 +184,7 @@ namespace larcfm {
     }
     
   Velocity ENUProjection::projectVelocity(const LatLonAlt& lla, const Velocity& v) const {
-    double timeStep = 10.0;
-    LatLonAlt ll2 = GreatCircle::linear_initial(lla,v,timeStep);
-    Vect3 se = project(lla);
-    Vect3 s2 = project(ll2);
-    Vect3 vn = s2.Sub(se).Scal(1/timeStep);
-    return Velocity::make(vn);
+    return project(lla,v).second;
   }
   
   Velocity ENUProjection::projectVelocity(const Position& ss, const Velocity& v) const {
@@ -211,11 +210,20 @@ namespace larcfm {
   }
 
   std::pair<Vect3,Velocity> ENUProjection::project(const Position& p, const Velocity& v) const {
-   	return std::pair<Vect3,Velocity>(project(p),projectVelocity(p,v));
+    if (p.isLatLon()) {
+      return project(p.lla(),v);
+    }
+    return std::pair<Vect3,Velocity>(p.vect3(),v);
    }
 
+  // Same as project(p) and projectVelocity(p,v), with p projected once
   std::pair<Vect3,Velocity> ENUProjection::project(const LatLonAlt& p, const Velocity& v) const {
-   	return std::pair<Vect3,Velocity>(project(p),projectVelocity(p,v));
+    double timeStep = 10.0;
+    LatLonAlt ll2 = GreatCircle::linear_initial(p,v,timeStep);
+    Vect3 se = project(p);
+    Vect3 s2 = project(ll2);
+    Vect3 vn = s2.Sub(se).Scal(1/timeStep);
+    return std::pair<Vect3,Velocity>(se,Velocity::make(vn));
    }
 
   std::pair<Position,Velocity> ENUProjection::inverse(const Vect3& p, const Velocity& v, bool toLatLon) const {
@@ -226,6 +234,17 @@ namespace larcfm {
     }
    }
 
+  void ENUProjection::project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const {
+    projectAll(*this,lla,out);
+  }
+
+  void ENUProjection::project(const std::vector<Position>& sip, std::vector<Vect3>& out) const {
+    projectAll(*this,sip,out);
+  }
+
+  void ENUProjection::inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const {
+    inverseAll(*this,xyz,out);
+  }
 
 }
 
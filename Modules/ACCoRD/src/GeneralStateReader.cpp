@@ -185,30 +185,30 @@ void GeneralStateReader::loadfile() {
 
 		// the values are in the default units.
 		if (latlon) {
-			ss =  Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], "deg"),
-					input.getColumn(head[LON_SY], "deg"),
-					input.getColumn(head[ALT_SZ], "ft")));
+			ss =  Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], unit::deg),
+					input.getColumn(head[LON_SY], unit::deg),
+					input.getColumn(head[ALT_SZ], unit::ft)));
 		} else {
 			ss =  Position(Point::mk(
-					input.getColumn(head[LAT_SX], "NM"),
-					input.getColumn(head[LON_SY], "NM"),
-					input.getColumn(head[ALT_SZ], "ft")));
+					input.getColumn(head[LAT_SX], unit::NM),
+					input.getColumn(head[LON_SY], unit::NM),
+					input.getColumn(head[ALT_SZ], unit::ft)));
 		}
 
 		if (trkgsvs) {
 			vv = Velocity::mkTrkGsVs(
-					input.getColumn(head[TRK_VX], "deg"),
-					input.getColumn(head[GS_VY], "knot"),
-					input.getColumn(head[VS_VZ], "fpm"));
+					input.getColumn(head[TRK_VX], unit::deg),
+					input.getColumn(head[GS_VY], unit::knot),
+					input.getColumn(head[VS_VZ], unit::fpm));
 		} else {
 			vv = Velocity::mkVxyz(
-					input.getColumn(head[TRK_VX], "knot"),
-					input.getColumn(head[GS_VY],  "knot"),
-					input.getColumn(head[VS_VZ],  "fpm"));
+					input.getColumn(head[TRK_VX], unit::knot),
+					input.getColumn(head[GS_VY],  unit::knot),
+					input.getColumn(head[VS_VZ],  unit::fpm));
 		}
 
 		if (linetype == POLY) {
-			double top = input.getColumn(head[SZ2], "ft");
+			double top = input.getColumn(head[SZ2], unit::ft);
 			SimpleMovingPoly p = states[stateIndex].getPolygon();
 			// replace existing entry if time does not match
 			if (states[stateIndex].getTime() != tm) {
@@ -261,7 +261,7 @@ double GeneralStateReader::parseClockTime(const std::string& s) const {
       if (clock) {
         tm = Util::parse_time(s);
       } else {
-        tm = input.getColumn(head[TM_CLK], "s");
+        tm = input.getColumn(head[TM_CLK], unit::s);
       }
     } catch (std::runtime_error e) {
       error.addError("error parsing time at line "+Fm0(input.lineNumber()));
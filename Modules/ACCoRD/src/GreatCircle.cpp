@@ -14,7 +14,9 @@
 #include "GreatCircle.h"
 #include "Triple.h"
 
+#include <algorithm>
 #include <cmath>
+
 namespace larcfm {
 
 
@@ -60,6 +62,22 @@ double GreatCircle::distance(const LatLonAlt& p1, const LatLonAlt& p2) {
 	return distance_from_angle(angular_distance(p1, p2), 0.0);
 }
 
+// Same arithmetic as angular_distance(), with cos(lat1) computed once
+void GreatCircle::distance(const LatLonAlt& p1, const std::vector<LatLonAlt>& p2, std::vector<double>& dist) {
+	dist.resize(p2.size());
+	double lat1 = p1.lat();
+	double lon1 = p1.lon();
+	double coslat1 = cos(lat1);
+	for (int i = 0; i < (int) p2.size(); i++) {
+		double lat2 = p2[i].lat();
+		double lon2 = p2[i].lon();
+		double ad = asin_safe(sqrt_safe(sq(sin((lat1 - lat2) / 2))
+				+ coslat1 * cos(lat2)
+				* sq(sin((lon1 - lon2) / 2)))) * 2.0;
+		dist[i] = distance_from_angle(ad, 0.0);
+	}
+}
+
 bool GreatCircle::almost_equals(double lat1, double lon1, double lat2, double lon2) {
 	return Constants::almost_equals_radian(angular_distance(lat1, lon1, lat2, lon2));
 }
@@ -117,6 +135,25 @@ double GreatCircle::initial_course(const LatLonAlt& p1, const LatLonAlt& p2) {
 			p2.lat(),p2.lon());
 }
 
+// Same arithmetic as initial_course_impl(), with the trigonometric functions of lat1 computed once
+void GreatCircle::initial_course(const LatLonAlt& p1, const std::vector<LatLonAlt>& p2, std::vector<double>& course) {
+	course.resize(p2.size());
+	double lat1 = p1.lat();
+	double lon1 = p1.lon();
+	double coslat1 = cos(lat1);
+	double sinlat1 = sin(lat1);
+	for (int i = 0; i < (int) p2.size(); i++) {
+		if (coslat1 < EPS) {
+			course[i] = lat1 > 0 ? Pi : 2.0 * Pi;
+			continue;
+		}
+		double lat2 = p2[i].lat();
+		double lon2 = p2[i].lon();
+		double coslat2 = cos(lat2);
+		course[i] = to_2pi(atan2_safe(sin(lon2-lon1)*coslat2, coslat1*sin(lat2)-sinlat1*coslat2*cos(lon2-lon1)));
+	}
+}
+
 
 double GreatCircle::final_course(const LatLonAlt& p1, const LatLonAlt& p2) {
 	return initial_course(p2, p1)+M_PI;
@@ -514,6 +551,22 @@ LatLonAlt GreatCircle::linear_initial(const LatLonAlt& s, double track, double d
 	return linear_initial_impl(s, track, GreatCircle::angle_from_distance(dist), 0.0);
 }
 
+// Same arithmetic as linear_initial_impl(), with the trigonometric functions of s.lat() computed once
+void GreatCircle::linear_initial(const LatLonAlt& s, const std::vector<double>& track, const std::vector<double>& dist, std::vector<LatLonAlt>& out) {
+	int n = (int) std::min(track.size(), dist.size());
+	out.resize(n);
+	double sinlat = sin(s.lat());
+	double coslat = cos(s.lat());
+	for (int i = 0; i < n; i++) {
+		double d = GreatCircle::angle_from_distance(dist[i]);
+		double sind = sin(d);
+		double cosd = cos(d);
+		double lat = asin_safe(sinlat*cosd+coslat*sind*cos(track[i]));
+		double dlon = atan2_safe(sin(track[i])*sind*coslat,cosd-sinlat*sin(lat));
+		out[i] = LatLonAlt::mk(lat, to_pi(s.lon() + dlon), s.alt());
+	}
+}
+
 double GreatCircle::cross_track_distance(const LatLonAlt& p1, const LatLonAlt& p2, const LatLonAlt& offCircle) {
 	double dist_p1oc = angular_distance(p1,offCircle);
 	double trk_p1oc = initial_course_impl(p1,offCircle); //,dist_p1oc);
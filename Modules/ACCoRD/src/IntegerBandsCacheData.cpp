@@ -0,0 +1,112 @@
+/*
+ * Cached integer bands contributed by an intruder aircraft
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "IntegerBandsCacheData.h"
+
+#include "format.h"
+
+namespace larcfm {
+
+bool IntegerBandsCacheData::BandsInput::operator==(const BandsInput& input) const {
+  return epsh == input.epsh && epsv == input.epsv && B == input.B && T == input.T &&
+      tstep == input.tstep && maxdown == input.maxdown && maxup == input.maxup &&
+      min_val == input.min_val && max_val == input.max_val;
+}
+
+/*
+ * Creates an empty object
+ */
+IntegerBandsCacheData::IntegerBandsCacheData() :
+    alerter_idx_(-1) {}
+
+bool IntegerBandsCacheData::samePosition(const Position& p1, const Position& p2) {
+  if (p1.isLatLon() != p2.isLatLon()) {
+    return false;
+  }
+  if (p1.isLatLon()) {
+    return p1.lat() == p2.lat() && p1.lon() == p2.lon() && p1.alt() == p2.alt();
+  }
+  return p1.vect3() == p2.vect3();
+}
+
+/*
+ * Returns true if cached values were computed for the given ownship and intruder states,
+ * including their uncertainties (SUM data), and alerter index. Ownship maneuvers are
+ * computed from its unprojected state, so that state is part of the key as well.
+ */
+bool IntegerBandsCacheData::isValidFor(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx) const {
+  return alerter_idx_ == alerter_idx &&
+      samePosition(own_pos_,ownship.positionXYZ()) && own_vel_ == ownship.velocityXYZ() &&
+      own_s_ == ownship.get_s() && own_v_ == ownship.get_v() &&
+      ac_s_ == intruder.get_s() && ac_v_ == intruder.get_v() &&
+      own_sum_.equals(ownship.sum()) && ac_sum_.equals(intruder.sum());
+}
+
+/*
+ * Clear cached values and set the states and alerter index they depend on
+ */
+void IntegerBandsCacheData::reset(const TrafficState& ownship, const TrafficState& intruder, int alerter_idx) {
+  own_pos_ = ownship.positionXYZ();
+  own_vel_ = ownship.velocityXYZ();
+  own_s_ = ownship.get_s();
+  own_v_ = ownship.get_v();
+  own_sum_ = ownship.sum();
+  ac_s_ = intruder.get_s();
+  ac_v_ = intruder.get_v();
+  ac_sum_ = intruder.sum();
+  alerter_idx_ = alerter_idx;
+  inputs_.clear();
+  bands_.clear();
+  computed_.clear();
+}
+
+/*
+ * Returns true if the integer bands of given alert level are cached for the given input
+ */
+bool IntegerBandsCacheData::hasIntegerBands(int alert_level, const BandsInput& input) const {
+  return 0 < alert_level && alert_level <= static_cast<int>(computed_.size()) &&
+      computed_[alert_level-1] && inputs_[alert_level-1] == input;
+}
+
+/*
+ * Returns cached integer bands of given alert level. Requires hasIntegerBands(alert_level,input)
+ */
+const std::vector<Integerval>& IntegerBandsCacheData::getIntegerBands(int alert_level) const {
+  return bands_[alert_level-1];
+}
+
+void IntegerBandsCacheData::setIntegerBands(int alert_level, const BandsInput& input, const std::vector<Integerval>& bands) {
+  if (alert_level > static_cast<int>(computed_.size())) {
+    inputs_.resize(alert_level);
+    bands_.resize(alert_level);
+    computed_.resize(alert_level,false);
+  }
+  inputs_[alert_level-1] = input;
+  bands_[alert_level-1] = bands;
+  computed_[alert_level-1] = true;
+}
+
+std::string IntegerBandsCacheData::toString() const {
+  std::string s = "<alerter_idx: "+Fmi(alerter_idx_)+", levels: {";
+  bool comma = false;
+  for (int i=0; i < static_cast<int>(computed_.size()); ++i) {
+    if (computed_[i]) {
+      if (comma) {
+        s += ", ";
+      } else {
+        comma = true;
+      }
+      s += Fmi(i+1)+": "+Integerval::FmVector(bands_[i]);
+    }
+  }
+  s += "}>\n";
+  return s;
+}
+
+}
@@ -16,34 +16,83 @@
 #include "ErrorLog.h"
 #include <iostream>
 #include <cstdlib>
-#include <cstring>
+#include <algorithm>
 #include <vector>
 
 using namespace std;
 using namespace larcfm;
 
 IntervalSet::IntervalSet() {
+	r = buf;
 	length = 0;
+	capacity = inline_intervals;
 }
 
 IntervalSet::IntervalSet(const IntervalSet& l) {
+	r = buf;
+	length = 0;
+	capacity = inline_intervals;
+	reserve(l.length);
 	length = l.length;
+	std::copy(l.r,l.r+length,r);
+}
+
+IntervalSet::IntervalSet(IntervalSet&& l) noexcept {
+	r = buf;
+	length = 0;
+	capacity = inline_intervals;
+	*this = std::move(l);
+}
+
+IntervalSet& IntervalSet::operator=(const IntervalSet& l) {
+	if (this != &l) {
+		length = 0;
+		reserve(l.length);
+		length = l.length;
+		std::copy(l.r,l.r+length,r);
+	}
+	return *this;
+}
+
+IntervalSet& IntervalSet::operator=(IntervalSet&& l) noexcept {
+	if (this != &l) {
+		if (r != buf) {
+			delete[] r;
+		}
+		if (l.r == l.buf) {
+			r = buf;
+			capacity = inline_intervals;
+			std::copy(l.r,l.r+l.length,r);
+		} else {
+			// take over the heap storage of l
+			r = l.r;
+			capacity = l.capacity;
+		}
+		length = l.length;
+		l.r = l.buf;
+		l.length = 0;
+		l.capacity = inline_intervals;
+	}
+	return *this;
+}
 
-	memcpy(r,l.r,sizeof(Interval)*length);
+IntervalSet::~IntervalSet() {
+	if (r != buf) {
+		delete[] r;
+	}
 }
 
 IntervalSet::IntervalSet(const std::vector<Interval>& v) {//: error("IntervalSet") {
+	r = buf;
+	length = 0;
+	capacity = inline_intervals;
+	reserve(static_cast<int>(v.size()));
 	length = static_cast<int>(v.size());
-	memcpy(r,&v[0],sizeof(Interval)*length);
+	std::copy(v.begin(),v.end(),r);
 }
 
 std::vector<Interval> IntervalSet::toVector() const {
-	std::vector<Interval> v = std::vector<Interval>();
-	v.reserve(length); // note: reserve() is appropriate because we exclusively use push_back to populate the vector
-	for (int i = 0; i < length; i++) {
-		v.push_back(v[i]);
-	}
-	return v;
+	return std::vector<Interval>(r,r+length);
 }
 
 void IntervalSet::clear() {
@@ -102,9 +151,39 @@ void IntervalSet::unions(const Interval& rn) {
 } // union
 
 void IntervalSet::unions(const IntervalSet& n) {
-	for (int i = 0; i < n.length; i++) {
-		unions(n.r[i]);
+	if (n.length == 0) {
+		return;
+	}
+	if (n.length == 1) {
+		unions(n.r[0]);
+		return;
+	}
+	// Both sets are ordered: merge them in a single pass
+	IntervalSet m;
+	m.reserve(length+n.length);
+	int i = 0;
+	int j = 0;
+	bool started = false;
+	Interval cur;
+	while (i < length || j < n.length) {
+		const Interval& next = (j >= n.length || (i < length && r[i].low <= n.r[j].low)) ? r[i++] : n.r[j++];
+		if (next.isEmpty()) {
+			continue;
+		}
+		if (!started) {
+			cur = next;
+			started = true;
+		} else if (next.low <= cur.up) {
+			cur.up = Util::max(cur.up,next.up);
+		} else {
+			m.append(cur);
+			cur = next;
+		}
+	}
+	if (started) {
+		m.append(cur);
 	}
+	*this = std::move(m);
 }
 
 /**
@@ -135,8 +214,7 @@ void IntervalSet::almost_add(double l, double u) {
  */
 void IntervalSet::almost_add(double l, double u, INT64FM maxUlps) {
 	if (Util::almost_less(l,u,maxUlps)) {
-		IntervalSet m = IntervalSet(*this);
-		clear();
+		IntervalSet m = std::move(*this);
 		bool go = false;
 		for (int i=0; i < m.size(); ++i) {
 			Interval ii = m.getInterval(i);
@@ -173,8 +251,7 @@ void IntervalSet::almost_intersect(const IntervalSet& n) {
  * unmodified. This method uses "almost" inequalities to compute the intersection.
  */
 void IntervalSet::almost_intersect(const IntervalSet& n, INT64FM maxUlps) {
-	IntervalSet m = IntervalSet(*this);
-	clear();
+	IntervalSet m = std::move(*this);
 	if (!m.isEmpty() && !n.isEmpty()) {
 		int i=0;
 		int j=0;
@@ -248,9 +325,42 @@ void IntervalSet::diff(const Interval& rn) {
 } // diff
 
 void IntervalSet::diff(const IntervalSet& n) {
-	for (int i = 0; i < n.length; i++) {
-		diff(n.r[i]);
+	if (n.length == 0 || length == 0) {
+		return;
+	}
+	if (n.length == 1) {
+		diff(n.r[0]);
+		return;
+	}
+	// Sweep both ordered sets once. Each closed interval of this set is cut by the
+	// open intervals of n that overlap it, leaving the same end-points as diff(rn).
+	IntervalSet m;
+	m.reserve(length+n.length);
+	int j = 0;
+	for (int i = 0; i < length; i++) {
+		const Interval& a = r[i];
+		while (j < n.length && (n.r[j].isEmpty() || n.r[j].isSingle() || n.r[j].up <= a.low)) {
+			j++;
+		}
+		double low = a.low;
+		for (int k = j; k < n.length && n.r[k].low < a.up; k++) {
+			const Interval& b = n.r[k];
+			if (b.isEmpty() || b.isSingle()) {
+				continue;
+			}
+			if (b.low >= low) {
+				m.append(Interval(low,b.low));
+			}
+			low = b.up;
+			if (low > a.up) {
+				break;
+			}
+		}
+		if (low <= a.up) {
+			m.append(Interval(low,a.up));
+		}
 	}
+	*this = std::move(m);
 }
 
 void IntervalSet::removeSingle(double x, double width) {
@@ -309,55 +419,57 @@ void IntervalSet::insert(int i, const Interval& region) {
 		i = length;
 	}
 
-	if (i == length && length < max_intervals) {
-		r[length] = region;
-		length++;
-	} else {
-		length++;
-		int c = length;
-
-		if (length >= max_intervals) {
-			std::cout << "ERROR: IntervalSet is full, fixing this requires a recompile" << endl;
-			exit(1);
-		}
-
-		while (i < c) {
-			r[c] = r[c-1];
-			c--;
-		}
-
-		r[i] = region;
-	}
+	reserve(length+1);
+	std::move_backward(r+i,r+length,r+length+1);
+	r[i] = region;
+	length++;
 } // insert
 
 /* 
  * Remove Interval i and return it
  */
 void IntervalSet::remove(int i) {
-	if (i < 0 || i >= length ) {
-		return;
-		//return Interval();
-	}
-
-	//	Interval t = r[i];
-
-	while (i + 1 < length) {
-		r[i] = r[i+1];
-		i++;
-	}
-
-	length--;
-
-	//return t;
+	remove(i,1);
 }
 
 /* 
  * Remove the len number of intervals starting at i.
  */
 void IntervalSet::remove(int i, int len) {
-	for( int j = 0; j < len; j++) {
-		remove(i);
+	if (i < 0 || i >= length || len <= 0) {
+		return;
+	}
+	if (len > length-i) {
+		len = length-i;
 	}
+	std::move(r+i+len,r+length,r+i);
+	length -= len;
+}
+
+/*
+ * Make room for at least n intervals. Storage grows geometrically.
+ */
+void IntervalSet::reserve(int n) {
+	if (n <= capacity) {
+		return;
+	}
+	int c = Util::max(n,2*capacity);
+	Interval* t = new Interval[c];
+	std::copy(r,r+length,t);
+	if (r != buf) {
+		delete[] r;
+	}
+	r = t;
+	capacity = c;
+}
+
+/*
+ * Add an interval after the last one. The caller guarantees the order.
+ */
+void IntervalSet::append(const Interval& region) {
+	reserve(length+1);
+	r[length] = region;
+	length++;
 }
 
 /* 
@@ -368,17 +480,21 @@ void IntervalSet::remove(int i, int len) {
  *
  */
 int IntervalSet::order(double x) const {
-	for (int i = 0; i < length; i++) {
-		if (r[i].in(x)) {
-			return i;
-		}
-		if (x < r[i].low) {
-			return -i-1;
+	// first interval whose upper bound is not below x
+	int lo = 0;
+	int hi = length;
+	while (lo < hi) {
+		int mid = (lo+hi)/2;
+		if (r[mid].up < x) {
+			lo = mid+1;
+		} else {
+			hi = mid;
 		}
-
 	}
-
-	return -length-1;
+	if (lo < length && r[lo].in(x)) {
+		return lo;
+	}
+	return -lo-1;
 }
 
 /** Print the contents of this IntervalSet */
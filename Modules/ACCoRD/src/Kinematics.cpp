@@ -28,6 +28,7 @@
 #include "format.h"
 #include <cmath>
 #include <float.h>
+#include <algorithm>
 
 
 namespace larcfm {
@@ -189,6 +190,38 @@ std::pair<Vect3,Velocity> Kinematics::turnOmega(const Vect3& s0, const Velocity&
 	return std::pair<Vect3,Velocity>(ns,nv);
 }
 
+void Kinematics::turnOmega(const Vect3& s0, const Velocity& v0, double t0, double dt, int n, double omega,
+		std::vector<Vect3>& pos, std::vector<Velocity>& vel) {
+	n = std::max(n,0);
+	pos.resize(n);
+	vel.resize(n);
+	if (Util::almost_equals(omega,0)) {
+		for (int i = 0; i < n; i++) {
+			pos[i] = s0.linear(v0,t0+i*dt);
+			vel[i] = v0;
+		}
+		return;
+	}
+	// Sample k+j is the velocity at the start of block k rotated by omega*j*dt
+	int m = std::max(1,(int) std::ceil(std::sqrt((double) n)));
+	std::vector<double> bsin(m);
+	std::vector<double> bcos(m);
+	for (int j = 0; j < m; j++) {
+		bsin[j] = std::sin(omega*j*dt);
+		bcos[j] = std::cos(omega*j*dt);
+	}
+	for (int k = 0; k < n; k += m) {
+		Velocity vk = v0.mkAddTrk(omega*(t0+k*dt));
+		int len = std::min(m,n-k);
+		for (int j = 0; j < len; j++) {
+			double vx = vk.x*bcos[j]+vk.y*bsin[j];
+			double vy = -vk.x*bsin[j]+vk.y*bcos[j];
+			vel[k+j] = Velocity::mkVxyz(vx,vy,v0.z);
+			pos[k+j] = Vect3(s0.x + (v0.y-vy)/omega, s0.y + (-v0.x+vx)/omega, s0.z + v0.z*(t0+(k+j)*dt));
+		}
+	}
+}
+
 Vect2 Kinematics::center(const Vect3& s0, const Velocity& v0, double omega) {
 	double v = v0.gs();
 	double theta = v0.trk();
@@ -567,6 +600,21 @@ std::pair<Vect3,Velocity> Kinematics::gsAccel(const Vect3& so, const Velocity& v
 	return std::pair<Vect3,Velocity>(gsAccelPos(so,vo,t,a),nvo);
 }
 
+void Kinematics::gsAccel(const Vect3& so3, const Velocity& vo3, double t0, double dt, int n, double a,
+		std::vector<Vect3>& pos, std::vector<Velocity>& vel) {
+	n = std::max(n,0);
+	pos.resize(n);
+	vel.resize(n);
+	Vect2 hat = vo3.vect2().Hat();
+	double gs0 = vo3.gs();
+	for (int i = 0; i < n; i++) {
+		double t = t0+i*dt;
+		double dist = gs0*t+0.5*a*t*t;
+		pos[i] = Vect3(so3.x+hat.x*dist, so3.y+hat.y*dist, so3.z+vo3.z*t);
+		vel[i] = vo3.mkGs(gs0+a*t);
+	}
+}
+
 
 double Kinematics::gsAccelTime(double gs0,double goalGs, double gsAccel) {
 	if (gsAccel < 0) std::cout << " gsAccelTime: gsAccel MUST BE Non-negative!!!! " << std::endl;
@@ -823,6 +871,18 @@ std::pair<Vect3,Velocity> Kinematics::vsAccel(const std::pair<Vect3,Velocity>& s
 	  return vsAccel(sv0.first, sv0.second,t,a);
 }
 
+void Kinematics::vsAccel(const Vect3& so3, const Velocity& vo3, double t0, double dt, int n, double a,
+		std::vector<Vect3>& pos, std::vector<Velocity>& vel) {
+	n = std::max(n,0);
+	pos.resize(n);
+	vel.resize(n);
+	for (int i = 0; i < n; i++) {
+		double t = t0+i*dt;
+		pos[i] = Vect3(so3.x + t*vo3.x, so3.y + t*vo3.y, so3.z + vo3.z*t + 0.5*a*t*t);
+		vel[i] = Velocity::mkVxyz(vo3.x, vo3.y, vo3.z+a*t);
+	}
+}
+
 
 double Kinematics::vsAccelTime(const Velocity& vo,double goalVs, double vsAccel) {
 	return vsAccelTime(vo.vs(),goalVs, vsAccel);;
@@ -13,8 +13,6 @@
 #include "Util.h"
 #include "format.h"
 
-#include <vector>
-
 namespace larcfm {
 
 /*
@@ -46,16 +44,18 @@ MofN::MofN() {
  * Creates a copy of M of N object
  */
 MofN::MofN(const MofN& mofn) : m_(mofn.m_), n_(mofn.n_), max_(mofn.max_),
-    queue_(mofn.queue_) {}
+    queue_(mofn.queue_), head_(mofn.head_) {}
 
 /*
  * Reset M of N object with a given initial value
  */
 void MofN::reset(int val) {
-  queue_.clear();
+  // Same size as before when n doesn't change, so that resetting doesn't allocate
+  queue_.assign(Util::max(n_,0),-1);
+  head_ = 0;
   max_ = val;
-  for (int i=0;i<n_;++i) {
-    queue_.push_back(i < m_ ? val : -1);
+  for (int i=0;i<m_ && i<n_;++i) {
+    queue_[i] = val;
   }
 }
 
@@ -66,6 +66,11 @@ bool MofN::isValid() const {
   return !queue_.empty() && m_ > 0 && m_ <= n_;
 }
 
+int MofN::at(int k) const {
+  int i = head_+k;
+  return queue_[i < n_ ? i : i-n_];
+}
+
 /*
  * Return M of N value for a given value.
  * Counts maximum occurrences of value assuming that that value represents all the
@@ -79,19 +84,21 @@ int MofN::m_of_n(int value) {
   if (value > max_) {
     max_ = value;
   }
-  queue_.pop_front();
-  queue_.push_back(value);
+  // The newest value replaces the oldest one
+  queue_[head_] = value;
+  head_ = head_+1 < n_ ? head_+1 : 0;
   if (max_ < 0) {
     return max_;
   }
-  std::vector<int> count(max_+1,0);
-  for (std::deque<int>::const_iterator val_ptr = queue_.begin(); val_ptr != queue_.end(); ++val_ptr) {
-    for (int i=*val_ptr;i >= 0;--i) {
-      count[i]++;
-    }
-  }
+  // A value v counts for all the values 0 <= i <= v
   for (int i=max_; i >= 0; --i) {
-    if (count[i] >= m_) {
+    int count = 0;
+    for (int k=0; k < n_; ++k) {
+      if (queue_[k] >= i) {
+        ++count;
+      }
+    }
+    if (count >= m_) {
       return i;
     }
   }
@@ -102,28 +109,22 @@ bool MofN::sameAs(const MofN& mofn) const {
   if (max_ != mofn.max_  && queue_.size() != mofn.queue_.size()) {
       return false;
   }
-  std::deque<int>::const_iterator it1_ptr = queue_.begin();
-  std::deque<int>::const_iterator it2_ptr = mofn.queue_.begin();
-  while (it1_ptr != queue_.end() && it2_ptr != mofn.queue_.end()) {
-      if (*it1_ptr != *it2_ptr) {
+  int n = Util::min(static_cast<int>(queue_.size()),static_cast<int>(mofn.queue_.size()));
+  for (int k=0; k < n; ++k) {
+      if (at(k) != mofn.at(k)) {
           return false;
       }
-      ++it1_ptr;
-      ++it2_ptr;
   }
   return true;
 }
 
 std::string MofN::toString() const {
   std::string s=Fmi(m_)+" of "+Fmi(n_)+": [";
-  bool comma = false;
-  for (std::deque<int>::const_iterator val_ptr = queue_.begin(); val_ptr != queue_.end(); ++val_ptr) {
-    if (comma) {
+  for (int k=0; k < static_cast<int>(queue_.size()); ++k) {
+    if (k > 0) {
       s+=",";
-    } else {
-      comma = true;
     }
-    s += Fmi(*val_ptr);
+    s += Fmi(at(k));
   }
   s+="]";
   return s;
@@ -10,6 +10,7 @@
  * Rights Reserved.
  */
 #include "OrthographicProjection.h"
+#include "ProjectionArrays.h"
 #include "LatLonAlt.h"
 #include "GreatCircle.h"
 #include "Util.h"
@@ -165,6 +166,17 @@ std::pair<Position,Velocity> OrthographicProjection::inverse(const Vect3& p, con
 	}
 }
 
+  void OrthographicProjection::project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const {
+    projectAll(*this,lla,out);
+  }
+
+  void OrthographicProjection::project(const std::vector<Position>& sip, std::vector<Vect3>& out) const {
+    projectAll(*this,sip,out);
+  }
+
+  void OrthographicProjection::inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const {
+    inverseAll(*this,xyz,out);
+  }
 
 }
 
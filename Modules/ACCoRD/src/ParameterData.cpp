@@ -50,33 +50,44 @@ ParameterData ParameterData::copyWithPrefix(const std::string& prefix) const {
 	return p;
 }
 
+// Case insensitive test of key starting with prefix
+static bool hasPrefix(const std::string& key, const std::string& prefix) {
+	if (key.size() < prefix.size()) {
+		return false;
+	}
+	for (std::string::size_type i = 0; i < prefix.size(); ++i) {
+		char a = key[i];
+		char b = prefix[i];
+		if (a >= 'A' && a <= 'Z') a = static_cast<char>(a-'A'+'a');
+		if (b >= 'A' && b <= 'Z') b = static_cast<char>(b-'A'+'a');
+		if (a != b) {
+			return false;
+		}
+	}
+	return true;
+}
+
 ParameterData ParameterData::extractPrefix(const std::string& prefix) const {
-	std::string prefixlc = toLowerCase(prefix);
 	ParameterData p;
 	p.preserveUnits = preserveUnits;
 	p.unitCompatibility = unitCompatibility;
 	p.listPatternStr = listPatternStr;
 	for (paramtype::const_iterator pos = parameters.begin(); pos != parameters.end(); ++pos) {
-		std::string key = pos->first;
-		std::string keylc = toLowerCase(key);
-		if (keylc.find(prefixlc) == 0) {
-			p.parameters[key.substr(prefix.length())] = pos->second;
+		if (hasPrefix(pos->first,prefix)) {
+			p.parameters[pos->first.substr(prefix.length())] = pos->second;
 		}
 	}
 	return p;
 }
 
 ParameterData ParameterData::removeKeysWithPrefix(const std::string& prefix) const {
-	std::string prefixlc = toLowerCase(prefix);
 	ParameterData p;
 	p.preserveUnits = preserveUnits;
 	p.unitCompatibility = unitCompatibility;
 	p.listPatternStr = listPatternStr;
 	for (paramtype::const_iterator pos = parameters.begin(); pos != parameters.end(); ++pos) {
-		std::string key = pos->first;
-		std::string keylc = toLowerCase(key);
-		if (keylc.find(prefixlc) != 0) {
-			p.parameters[key] = pos->second;
+		if (!hasPrefix(pos->first,prefix)) {
+			p.parameters[pos->first] = pos->second;
 		}
 	}
 	return p;
@@ -220,6 +231,50 @@ long ParameterData::getLong(const std::string& key) const {
 	return (long) getValue(key);
 }
 
+bool ParameterData::contains(const ParameterKey& key) const {
+	return parameters.find(key) != parameters.end();
+}
+
+std::string ParameterData::getString(const ParameterKey& key) const {
+	paramtype::const_iterator q = parameters.find(key);
+	if (q == parameters.end()) {
+		return "";
+	} else {
+		return q->second.sval;
+	}
+}
+
+double ParameterData::getValue(const ParameterKey& key) const {
+	paramtype::const_iterator q = parameters.find(key);
+	if (q == parameters.end()) {
+		return 0.0;
+	} else {
+		return q->second.dval;
+	}
+}
+
+std::string ParameterData::getUnit(const ParameterKey& key) const {
+	paramtype::const_iterator q = parameters.find(key);
+	if (q == parameters.end()) {
+		return "unspecified";
+	} else {
+		return q->second.units;
+	}
+}
+
+bool ParameterData::getBool(const ParameterKey& key) const {
+	paramtype::const_iterator q = parameters.find(key);
+	if (q == parameters.end()) {
+		return false;
+	} else {
+		return q->second.bval;
+	}
+}
+
+int ParameterData::getInt(const ParameterKey& key) const {
+	return (int) getValue(key);
+}
+
 bool ParameterData::parse_parameter_string(const std::string& str) {
 	int loc = static_cast<int>(str.find('='));
 	if (loc > 0) {
@@ -247,8 +302,9 @@ bool ParameterData::putParam(const std::string& ikey, bool perform_conversion, P
 	std::string key(ikey);
 
 	bool compatible = true;
-	if (contains(key)) {
-		ParameterEntry oldEntry = parameters[key];
+	paramtype::iterator pos = parameters.find(key);
+	if (pos != parameters.end()) {
+		const ParameterEntry& oldEntry = pos->second;
 		newEntry.order = oldEntry.order; // preserve ordering
 		if ( ! Units::isCompatible(newEntry.units,oldEntry.units)) {
 			compatible = false;
@@ -270,7 +326,11 @@ bool ParameterData::putParam(const std::string& ikey, bool perform_conversion, P
 		}
 	}
 	if (compatible || ! unitCompatibility) {
-		parameters[key] = newEntry;
+		if (pos != parameters.end()) {
+			pos->second = newEntry;
+		} else {
+			parameters[key] = newEntry;
+		}
 		return true;
 	} else {
 		return false;
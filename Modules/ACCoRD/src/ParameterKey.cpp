@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2014-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "ParameterKey.h"
+#include "string_util.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace larcfm {
+
+namespace {
+
+inline unsigned char lower(char c) {
+	return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c-'A'+'a') : static_cast<unsigned char>(c);
+}
+
+struct CaseInsensitiveHash {
+	std::size_t operator()(const std::string& key) const {
+		return ParameterKey::hashOf(key);
+	}
+};
+
+struct CaseInsensitiveEqual {
+	bool operator()(const std::string& s1, const std::string& s2) const {
+		return ParameterKey::equals(s1,s2);
+	}
+};
+
+// Interned keys. Names are kept in a deque, so that pointers to them remain valid
+// while new keys are added. Built on first use to avoid static initialization order
+// problems with static ParameterKey objects in other translation units.
+struct KeyRegistry {
+	std::mutex lock;
+	std::unordered_map<std::string,int,CaseInsensitiveHash,CaseInsensitiveEqual> ids;
+	std::deque<std::string> names;
+};
+
+KeyRegistry& registry() {
+	static KeyRegistry* reg = new KeyRegistry();
+	return *reg;
+}
+
+int intern_key(const std::string& key, const std::string** name) {
+	KeyRegistry& reg = registry();
+	std::lock_guard<std::mutex> guard(reg.lock);
+	std::unordered_map<std::string,int,CaseInsensitiveHash,CaseInsensitiveEqual>::const_iterator pos = reg.ids.find(key);
+	int id;
+	if (pos != reg.ids.end()) {
+		id = pos->second;
+	} else {
+		id = static_cast<int>(reg.names.size());
+		reg.names.push_back(toLowerCase(key));
+		reg.ids[reg.names.back()] = id;
+	}
+	*name = &reg.names[id];
+	return id;
+}
+
+}
+
+ParameterKey::ParameterKey(const std::string& key) {
+	id_ = intern_key(key,&name_);
+	hash_ = hashOf(key);
+}
+
+int ParameterKey::id() const {
+	return id_;
+}
+
+std::size_t ParameterKey::hash() const {
+	return hash_;
+}
+
+const std::string& ParameterKey::name() const {
+	return *name_;
+}
+
+bool ParameterKey::operator==(const ParameterKey& k) const {
+	return id_ == k.id_;
+}
+
+bool ParameterKey::operator!=(const ParameterKey& k) const {
+	return id_ != k.id_;
+}
+
+std::size_t ParameterKey::hashOf(const std::string& key) {
+	// FNV-1a on the lowercase characters
+	std::size_t h = 2166136261u;
+	for (std::string::size_type i = 0; i < key.size(); ++i) {
+		h ^= lower(key[i]);
+		h *= 16777619u;
+	}
+	return h;
+}
+
+bool ParameterKey::equals(const std::string& s1, const std::string& s2) {
+	if (s1.size() != s2.size()) {
+		return false;
+	}
+	for (std::string::size_type i = 0; i < s1.size(); ++i) {
+		if (lower(s1[i]) != lower(s2[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int ParameterKey::count() {
+	KeyRegistry& reg = registry();
+	std::lock_guard<std::mutex> guard(reg.lock);
+	return static_cast<int>(reg.names.size());
+}
+
+} /* namespace larcfm */
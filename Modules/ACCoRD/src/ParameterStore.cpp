@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2014-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "ParameterStore.h"
+
+namespace larcfm {
+
+ParameterStore::ParameterStore() {
+}
+
+ParameterStore::iterator ParameterStore::begin() {
+	return entries_.begin();
+}
+
+ParameterStore::iterator ParameterStore::end() {
+	return entries_.end();
+}
+
+ParameterStore::const_iterator ParameterStore::begin() const {
+	return entries_.begin();
+}
+
+ParameterStore::const_iterator ParameterStore::end() const {
+	return entries_.end();
+}
+
+std::size_t ParameterStore::size() const {
+	return entries_.size();
+}
+
+void ParameterStore::clear() {
+	entries_.clear();
+	hashes_.clear();
+	slots_.clear();
+}
+
+int ParameterStore::index(const std::string& key, std::size_t hash) const {
+	if (slots_.empty()) {
+		return -1;
+	}
+	std::size_t mask = slots_.size()-1;
+	for (std::size_t s = hash & mask; slots_[s] >= 0; s = (s+1) & mask) {
+		int i = slots_[s];
+		if (hashes_[i] == hash && ParameterKey::equals(entries_[i].first,key)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+ParameterStore::iterator ParameterStore::find(const std::string& key) {
+	int i = index(key,ParameterKey::hashOf(key));
+	return i < 0 ? entries_.end() : entries_.begin()+i;
+}
+
+ParameterStore::const_iterator ParameterStore::find(const std::string& key) const {
+	int i = index(key,ParameterKey::hashOf(key));
+	return i < 0 ? entries_.end() : entries_.begin()+i;
+}
+
+ParameterStore::iterator ParameterStore::find(const ParameterKey& key) {
+	int i = index(key.name(),key.hash());
+	return i < 0 ? entries_.end() : entries_.begin()+i;
+}
+
+ParameterStore::const_iterator ParameterStore::find(const ParameterKey& key) const {
+	int i = index(key.name(),key.hash());
+	return i < 0 ? entries_.end() : entries_.begin()+i;
+}
+
+ParameterEntry& ParameterStore::operator[](const std::string& key) {
+	std::size_t hash = ParameterKey::hashOf(key);
+	int i = index(key,hash);
+	if (i >= 0) {
+		return entries_[i].second;
+	}
+	i = static_cast<int>(entries_.size());
+	entries_.push_back(value_type(key,ParameterEntry()));
+	hashes_.push_back(hash);
+	// keep the load factor of the hash table below 1/2
+	if (2*entries_.size() > slots_.size()) {
+		rehash(slots_.empty() ? 64 : 2*slots_.size());
+	} else {
+		insert_slot(i);
+	}
+	return entries_[i].second;
+}
+
+void ParameterStore::erase(iterator pos) {
+	int i = static_cast<int>(pos-entries_.begin());
+	int last = static_cast<int>(entries_.size())-1;
+	remove_slot(slot_of(i));
+	if (i != last) {
+		// move the last entry into the erased position
+		slots_[slot_of(last)] = i;
+		entries_[i] = entries_[last];
+		hashes_[i] = hashes_[last];
+	}
+	entries_.pop_back();
+	hashes_.pop_back();
+}
+
+// Slot of the hash table that holds entry i
+std::size_t ParameterStore::slot_of(int i) const {
+	std::size_t mask = slots_.size()-1;
+	std::size_t s = hashes_[i] & mask;
+	while (slots_[s] != i) {
+		s = (s+1) & mask;
+	}
+	return s;
+}
+
+void ParameterStore::insert_slot(int i) {
+	std::size_t mask = slots_.size()-1;
+	std::size_t s = hashes_[i] & mask;
+	while (slots_[s] >= 0) {
+		s = (s+1) & mask;
+	}
+	slots_[s] = i;
+}
+
+// Empty slot s and shift back the entries that follow it in its cluster, so that no
+// entry is separated from its home slot by an empty slot
+void ParameterStore::remove_slot(std::size_t s) {
+	std::size_t mask = slots_.size()-1;
+	slots_[s] = -1;
+	for (std::size_t j = (s+1) & mask; slots_[j] >= 0; j = (j+1) & mask) {
+		std::size_t home = hashes_[slots_[j]] & mask;
+		// entry at j can move to s if its home is not cyclically in (s,j]
+		bool stays = (s < j) ? (s < home && home <= j) : (s < home || home <= j);
+		if (!stays) {
+			slots_[s] = slots_[j];
+			slots_[j] = -1;
+			s = j;
+		}
+	}
+}
+
+void ParameterStore::rehash(std::size_t capacity) {
+	slots_.assign(capacity,-1);
+	for (int i = 0; i < static_cast<int>(entries_.size()); ++i) {
+		insert_slot(i);
+	}
+}
+
+} /* namespace larcfm */
@@ -313,29 +313,29 @@ void PlanReader::loadfile() {
 		Position pos;
 		if (latlon) {
 			pos = Position::makeLatLonAlt(
-					input.getColumn(head[LAT_SX], "deg"), "rad", // getColumn(_deg, head[LAT_SX]),
-					input.getColumn(head[LON_SY], "deg"), "rad", // getColumn(_deg, head[LON_SY]),
-					input.getColumn(head[SZ],      "ft"), "m" // getColumn(_ft, head[SZ]),
+					input.getColumn(head[LAT_SX], unit::deg), "rad", // getColumn(_deg, head[LAT_SX]),
+					input.getColumn(head[LON_SY], unit::deg), "rad", // getColumn(_deg, head[LON_SY]),
+					input.getColumn(head[SZ],      unit::ft), "m" // getColumn(_ft, head[SZ]),
 			);
 		} else {
 			pos = Position::makeXYZ(
-					input.getColumn(head[LAT_SX], "nmi"), "m", // getColumn(_deg, head[LAT_SX]),
-					input.getColumn(head[LON_SY], "nmi"), "m", // getColumn(_deg, head[LON_SY]),
-					input.getColumn(head[SZ],      "ft"), "m"  // getColumn(_ft, head[SZ]),
+					input.getColumn(head[LAT_SX], unit::NM), "m", // getColumn(_deg, head[LAT_SX]),
+					input.getColumn(head[LON_SY], unit::NM), "m", // getColumn(_deg, head[LON_SY]),
+					input.getColumn(head[SZ],      unit::ft), "m"  // getColumn(_ft, head[SZ]),
 			);
 		}
 		if (linetype == POLY) {
-			double top = input.getColumn(head[SZ2], "ft");
-			double bottom = input.getColumn(head[SZ], "ft");
+			double top = input.getColumn(head[SZ2], unit::ft);
+			double bottom = input.getColumn(head[SZ], unit::ft);
 
 			if (containmentLine) {
 				containment[containmentIndex].addVertex(pos,bottom,top,myTime);
 
 				if ((pathmode == PolyPath::USER_VEL || pathmode == PolyPath::USER_VEL_FINITE || pathmode == PolyPath::USER_VEL_EVER)
 				    && input.columnHasValue(head[TRK]) && input.columnHasValue(head[GS]) && input.columnHasValue(head[VS])) {
-					Velocity vi = Velocity::makeTrkGsVs(input.getColumn(head[TRK], "deg"), "rad",
-							input.getColumn(head[GS], "knot"), "m/s",
-							input.getColumn(head[VS], "fpm"), "m/s");
+					Velocity vi = Velocity::makeTrkGsVs(input.getColumn(head[TRK], unit::deg), "rad",
+							input.getColumn(head[GS], unit::knot), "m/s",
+							input.getColumn(head[VS], unit::fpm), "m/s");
 					containment[containmentIndex].setVelocity(containment[containmentIndex].getSegment(myTime), vi);
 				}
 
@@ -355,9 +355,9 @@ void PlanReader::loadfile() {
 
 				if ((pathmode == PolyPath::USER_VEL || pathmode == PolyPath::USER_VEL_FINITE || pathmode == PolyPath::USER_VEL_EVER)
 						&& input.columnHasValue(head[TRK]) && input.columnHasValue(head[GS]) && input.columnHasValue(head[VS])) {
-					Velocity vi = Velocity::makeTrkGsVs(input.getColumn(head[TRK], "deg"), "rad",
-							input.getColumn(head[GS], "knot"), "m/s",
-							input.getColumn(head[VS], "fpm"), "m/s");
+					Velocity vi = Velocity::makeTrkGsVs(input.getColumn(head[TRK], unit::deg), "rad",
+							input.getColumn(head[GS], unit::knot), "m/s",
+							input.getColumn(head[VS], unit::fpm), "m/s");
 					paths[pathIndex].setVelocity(paths[pathIndex].getSegment(myTime), vi);
 				}
 
@@ -399,7 +399,7 @@ void PlanReader::loadfile() {
 			}
 
 			if (input.columnHasValue(head[RADIUS])) {
-				double rad = input.getColumn(head[RADIUS], "nmi");
+				double rad = input.getColumn(head[RADIUS], unit::NM);
 				n = n.setRadiusSigned(rad);
 			}
 
@@ -407,15 +407,15 @@ void PlanReader::loadfile() {
 			if (input.columnHasValue(head[CENTER_LAT_SX])) {
 				if (latlon) {
 					turnCenter = Position::makeLatLonAlt(
-							input.getColumn(head[CENTER_LAT_SX], "deg"), "rad", 
-							input.getColumn(head[CENTER_LON_SY], "deg"), "rad", 
-							input.getColumn(head[CENTER_ALT],     "ft"), "m" 
+							input.getColumn(head[CENTER_LAT_SX], unit::deg), "rad", 
+							input.getColumn(head[CENTER_LON_SY], unit::deg), "rad", 
+							input.getColumn(head[CENTER_ALT],     unit::ft), "m" 
 							);
 				} else {
 					turnCenter = Position::makeXYZ(
-							input.getColumn(head[CENTER_LAT_SX], "NM"), "m", 
-							input.getColumn(head[CENTER_LON_SY], "NM"), "m", 
-							input.getColumn(head[CENTER_ALT],    "ft"), "m"  
+							input.getColumn(head[CENTER_LAT_SX], unit::NM), "m", 
+							input.getColumn(head[CENTER_LON_SY], unit::NM), "m", 
+							input.getColumn(head[CENTER_ALT],    unit::ft), "m"  
 							);
 				}
 				n = n.setTurnCenter(turnCenter);
@@ -434,15 +434,15 @@ void PlanReader::loadfile() {
 				if (input.columnHasValue(head[TRK])) {
 					if (trkgsvs) {
 						vel = Velocity::makeTrkGsVs(
-								input.getColumn(head[TRK], "deg"), "rad", // getColumn(_deg, head[LAT_SX]),
-								input.getColumn(head[GS],  "kts"), "m/s", // getColumn(_deg, head[LON_SY]),
-								input.getColumn(head[VS],  "fpm"), "m/s" // getColumn(_ft, head[SZ]),
+								input.getColumn(head[TRK], unit::deg), "rad", // getColumn(_deg, head[LAT_SX]),
+								input.getColumn(head[GS],  unit::knot), "m/s", // getColumn(_deg, head[LON_SY]),
+								input.getColumn(head[VS],  unit::fpm), "m/s" // getColumn(_ft, head[SZ]),
 						);
 					} else {
 						vel = Velocity::makeVxyz(
-								input.getColumn(head[TRK], "kts"), // getColumn(_deg, head[LAT_SX]),
-								input.getColumn(head[GS],  "kts"), "m/s", // getColumn(_deg, head[LON_SY]),
-								input.getColumn(head[VS],  "fpm"), "m/s"  // getColumn(_ft, head[SZ]),
+								input.getColumn(head[TRK], unit::knot), // getColumn(_deg, head[LAT_SX]),
+								input.getColumn(head[GS],  unit::knot), "m/s", // getColumn(_deg, head[LON_SY]),
+								input.getColumn(head[VS],  unit::fpm), "m/s"  // getColumn(_ft, head[SZ]),
 						);
 					}
 				}
@@ -450,7 +450,7 @@ void PlanReader::loadfile() {
 
 				double sRadius = n.getRadiusSigned();
 				if (Util::almost_equals(sRadius,0.0) && input.columnHasValue(head[ACC_TRK])) {
-					double acctrk = input.getColumn(head[ACC_TRK], "deg/s");
+					double acctrk = input.getColumn(head[ACC_TRK], unit::degree_per_second);
 					sRadius = vel.gs()/acctrk;
 				}
 
@@ -466,7 +466,7 @@ void PlanReader::loadfile() {
 				default: break;// no change
 				}
 				TcpData::GsTcpType tcpgs = TcpData::valueOfGsType(input.getColumnString(head[TCP_GS]));
-				double accgs = input.getColumn(head[ACC_GS], "m/s^2");
+				double accgs = input.getColumn(head[ACC_GS], unit::meter_per_second2);
 
 				switch (tcpgs) {
 				case TcpData::BGS: n = n.setBGS(accgs); break;
@@ -476,7 +476,7 @@ void PlanReader::loadfile() {
 				default: break;// no change
 				}
 				TcpData::VsTcpType tcpvs = TcpData::valueOfVsType(input.getColumnString(head[TCP_VS]));
-				double accvs = input.getColumn(head[ACC_VS], "m/s^2");
+				double accvs = input.getColumn(head[ACC_VS], unit::meter_per_second2);
 				switch (tcpvs) {
 				case TcpData::BVS: n = n.setBVS(accvs); break;
 				case TcpData::EVS: n = n.setEVS( ); break;
@@ -634,7 +634,7 @@ double PlanReader::getClock(const string& s) const {
       vector<string> fields2 = split(s, patternStr);
       tm = Util::parse_double(fields2[2]) + 60 * Util::parse_double(fields2[1]) + 3600 * Util::parse_double(fields2[0]);
     } else {
-      tm = input.getColumn(head[TIME],"s");
+      tm = input.getColumn(head[TIME],unit::s);
     }
   } catch (std::runtime_error e) {
     error.addError("error parsing time at line "+Fm0(input.lineNumber()));
@@ -0,0 +1,245 @@
+/*
+ * PreparedPolygon - a polygon prepared for repeated Polycarp containment queries
+ *
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+#include "PreparedPolygon.h"
+#include "PolycarpContain.h"
+#include "Polycarp3D.h"
+#include "PolycarpQuadMinmax.h"
+#include "Util.h"
+#include "format.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace larcfm {
+
+PreparedPolygon::PreparedPolygon() :
+		buff(0), checked(false), nice(false), convex(false) {
+}
+
+PreparedPolygon::PreparedPolygon(const Poly3D& p, double b, bool checkNice) :
+		poly(p), buff(b) {
+	prepare(checkNice);
+}
+
+PreparedPolygon::PreparedPolygon(const SimplePoly& p, const EuclideanProjection& proj, double b, bool checkNice) :
+		poly(p.poly3D(proj)), buff(b) {
+	prepare(checkNice);
+}
+
+void PreparedPolygon::prepare(bool checkNice) {
+	vertices = poly.getVerticesRef();
+	checked = checkNice;
+	nice = !vertices.empty();
+	if (checkNice && !PolycarpContain::nice_polygon_2D(vertices, buff)) {
+		std::reverse(vertices.begin(), vertices.end());
+		if (!PolycarpContain::nice_polygon_2D(vertices, buff)) {
+			fpln("WARNING: PreparedPolygon: NOT A NICE POLYGON!");
+			nice = false;
+		}
+	}
+	int n = (int) vertices.size();
+	edges.reserve(n);
+	sqlen.reserve(n);
+	double area2 = 0.0;
+	for (int i = 0; i < n; i++) {
+		const Vect2& next = i < n-1 ? vertices[i+1] : vertices[0];
+		edges.push_back(next.Sub(vertices[i]));
+		sqlen.push_back(edges[i].sqv());
+		area2 += vertices[i].det(next);
+		rect.add(vertices[i]);
+	}
+	// the right perpendicular points out of a counterclockwise polygon
+	normals.reserve(n);
+	for (int i = 0; i < n; i++) {
+		normals.push_back(area2 >= 0 ? edges[i].PerpR().Hat() : edges[i].PerpL().Hat());
+	}
+	double turn = 0.0;
+	convex = n >= 3;
+	for (int i = 0; i < n && convex; i++) {
+		double t = edges[i].det(edges[i < n-1 ? i+1 : 0]);
+		if (t == 0.0) continue; // collinear edges
+		convex = turn == 0.0 || (t > 0) == (turn > 0);
+		turn = t;
+	}
+	center = n > 0 ? poly.poly2D().centroid() : Vect2::ZERO();
+}
+
+bool PreparedPolygon::isNice() const {
+	return nice;
+}
+
+double PreparedPolygon::getBuff() const {
+	return buff;
+}
+
+double PreparedPolygon::getBottom() const {
+	return poly.getBottom();
+}
+
+double PreparedPolygon::getTop() const {
+	return poly.getTop();
+}
+
+const Poly3D& PreparedPolygon::poly3D() const {
+	return poly;
+}
+
+const std::vector<Vect2>& PreparedPolygon::getVertices() const {
+	return vertices;
+}
+
+int PreparedPolygon::size() const {
+	return (int) vertices.size();
+}
+
+const Vect2& PreparedPolygon::edge(int i) const {
+	return edges[i];
+}
+
+const Vect2& PreparedPolygon::edgeNormal(int i) const {
+	return normals[i];
+}
+
+const BoundingRectangle& PreparedPolygon::getBoundingRectangle() const {
+	return rect;
+}
+
+bool PreparedPolygon::isConvex() const {
+	return convex;
+}
+
+const Vect2& PreparedPolygon::centroid() const {
+	return center;
+}
+
+// Every edge end point is more than 2*BUFF away in x, on the same side, so near_edge() is false for all edges,
+// no vertex is moved by fix_polygon(), no edge is crossed by the upshot and the winding number is 0.
+bool PreparedPolygon::farAway(const Vect2& s, double BUFF) const {
+	return s.x < rect.getMinX()-3*BUFF || s.x > rect.getMaxX()+3*BUFF;
+}
+
+bool PreparedPolygon::needsFix(const Vect2& s, double BUFF) const {
+	for (int i = 0; i < (int) vertices.size(); i++) {
+		if (vertices[i].y>=s.y-BUFF && std::abs(vertices[i].x-s.x)<BUFF) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Same arithmetic as PolycarpEdgeProximity::near_edge(), with the edge vector and its length precomputed
+bool PreparedPolygon::nearAnyEdge(const Vect2& s, double BUFF) const {
+	double sqbuff = Util::sq(BUFF);
+	int n = (int) vertices.size();
+	for (int i = 0; i < n; i++) {
+		const Vect2& segstart = vertices[i];
+		const Vect2& segend = i < n-1 ? vertices[i+1] : vertices[0];
+		if (std::abs(s.x-segstart.x)>2*BUFF && std::abs(s.x-segend.x)>2*BUFF && Util::sign(s.x-segend.x)==Util::sign(s.x-segstart.x)) {
+			continue;
+		} else if (std::abs(s.y-segstart.y)>2*BUFF && std::abs(s.y-segend.y)>2*BUFF && Util::sign(s.y-segend.y)==Util::sign(s.y-segstart.y)) {
+			continue;
+		}
+		Vect2 ds = segstart.Sub(s);
+		if (ds.sqv()<sqbuff || segend.Sub(s).sqv()<sqbuff) {
+			return true;
+		}
+		if (sqlen[i]>0 && PolycarpQuadMinmax::quad_min_le_D_int(sqlen[i],2*(ds.dot(edges[i])),ds.sqv(),0,1,sqbuff)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// PolycarpContain::definitely_inside(), without copying the polygon when fix_polygon() would not change it
+bool PreparedPolygon::inside2D(const Vect2& s, double BUFF) const {
+	if (farAway(s,BUFF) || nearAnyEdge(s,BUFF)) {
+		return false;
+	}
+	if (!needsFix(s,BUFF)) {
+		return PolycarpContain::winding_number(vertices,s) == 1 && PolycarpContain::definitely_inside_prelim(vertices,s,BUFF);
+	}
+	std::vector<Vect2> fixp = PolycarpContain::fix_polygon(vertices,s,BUFF);
+	return !PolycarpContain::near_any_edge(fixp,s,BUFF) && PolycarpContain::winding_number(vertices,s) == 1
+			&& PolycarpContain::definitely_inside_prelim(fixp,s,BUFF);
+}
+
+// PolycarpContain::definitely_outside(), without copying the polygon when fix_polygon() would not change it
+bool PreparedPolygon::outside2D(const Vect2& s, double BUFF) const {
+	if (farAway(s,BUFF)) {
+		return true;
+	}
+	if (nearAnyEdge(s,BUFF)) {
+		return false;
+	}
+	if (!needsFix(s,BUFF)) {
+		return PolycarpContain::winding_number(vertices,s) == 0 && PolycarpContain::definitely_outside_prelim(vertices,s,BUFF);
+	}
+	std::vector<Vect2> fixp = PolycarpContain::fix_polygon(vertices,s,BUFF);
+	return !PolycarpContain::near_any_edge(fixp,s,BUFF) && PolycarpContain::winding_number(vertices,s) == 0
+			&& PolycarpContain::definitely_outside_prelim(fixp,s,BUFF);
+}
+
+bool PreparedPolygon::definitelyInside(const Vect3& so) const {
+	if (so.z < poly.getBottom()+buff || so.z > poly.getTop()-buff) {
+		return false;
+	}
+	return nice && inside2D(so.vect2(),buff);
+}
+
+bool PreparedPolygon::definitelyOutside(const Vect3& so) const {
+	if (so.z < poly.getBottom()-buff || so.z > poly.getTop()+buff) {
+		return true;
+	}
+	return nice && outside2D(so.vect2(),buff);
+}
+
+bool PreparedPolygon::nearEdge(const Vect3& so, double v) const {
+	return nearEdge(so, buff, v);
+}
+
+bool PreparedPolygon::nearEdge(const Vect3& so, double h, double v) const {
+	if (so.z < poly.getBottom()-v || so.z > poly.getTop()+v) {
+		return false;
+	}
+	if (checked && h != buff) {
+		return Polycarp3D::nearEdge(so, poly, h, v, true);
+	}
+	Vect2 s = so.vect2();
+	if (!nice || farAway(s,h)) {
+		return false;
+	}
+	if (nearAnyEdge(s,h)) {
+		return true;
+	}
+	return (so.z < poly.getBottom()+v || so.z > poly.getTop()-v) && inside2D(s,h);
+}
+
+void PreparedPolygon::definitelyInside(const std::vector<Vect3>& so, std::vector<bool>& ans) const {
+	ans.resize(so.size());
+	for (int i = 0; i < (int) so.size(); i++) {
+		ans[i] = definitelyInside(so[i]);
+	}
+}
+
+void PreparedPolygon::definitelyOutside(const std::vector<Vect3>& so, std::vector<bool>& ans) const {
+	ans.resize(so.size());
+	for (int i = 0; i < (int) so.size(); i++) {
+		ans[i] = definitelyOutside(so[i]);
+	}
+}
+
+void PreparedPolygon::nearEdge(const std::vector<Vect3>& so, double v, std::vector<bool>& ans) const {
+	ans.resize(so.size());
+	for (int i = 0; i < (int) so.size(); i++) {
+		ans[i] = nearEdge(so[i], v);
+	}
+}
+
+}
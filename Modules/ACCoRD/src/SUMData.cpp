@@ -215,6 +215,12 @@ bool SUMData::is_SUM() const {
     return s_err_ != 0.0 || sz_std_ != 0.0 || v_err_ != 0.0 || vz_std_ != 0.0;
 }
 
+bool SUMData::equals(const SUMData& sum) const {
+    return s_EW_std_ == sum.s_EW_std_ && s_NS_std_ == sum.s_NS_std_ && s_EN_std_ == sum.s_EN_std_ &&
+        sz_std_ == sum.sz_std_ && v_EW_std_ == sum.v_EW_std_ && v_NS_std_ == sum.v_NS_std_ &&
+        v_EN_std_ == sum.v_EN_std_ && vz_std_ == sum.vz_std_;
+}
+
 
 
 }
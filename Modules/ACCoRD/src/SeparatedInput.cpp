@@ -46,6 +46,7 @@ SeparatedInput::SeparatedInput() :
 	caseSensitive = true;
 	parameters = ParameterData();
 	patternStr = Constants::wsPatternBase;
+	pattern = DelimiterPattern(patternStr);
 	reader = 0;
 	linenum = 0;
 	fixed_width = false;
@@ -67,6 +68,7 @@ SeparatedInput::SeparatedInput(std::istream* ins) :
 	line_str.reserve(10);
 	linenum = 0;
 	patternStr = Constants::wsPatternBase;
+	pattern = DelimiterPattern(patternStr);
 	fixed_width = false;
 	parameters = ParameterData();
 	quoteCharDefined = false;
@@ -89,6 +91,7 @@ SeparatedInput::SeparatedInput(const SeparatedInput& x) :
 	line_str = x.line_str;
 	linenum = x.linenum;
 	patternStr = x.patternStr;
+	pattern = x.pattern;
 	parameters = x.parameters;
 	fixed_width = x.fixed_width;
 	quoteCharDefined = x.quoteCharDefined;
@@ -113,6 +116,7 @@ SeparatedInput& SeparatedInput::operator=(const SeparatedInput& x) {
 	line_str = x.line_str;
 	linenum = x.linenum;
 	patternStr = x.patternStr;
+	pattern = x.pattern;
 	parameters = x.parameters;
 	fixed_width = x.fixed_width;
 	quoteCharDefined = x.quoteCharDefined;
@@ -126,7 +130,13 @@ SeparatedInput& SeparatedInput::operator=(const SeparatedInput& x) {
 
 
 void SeparatedInput::setColumnDelimiters(const std::string& delim) {
+	DelimiterPattern p(delim);
+	if (!p.valid()) {
+		error.addError("setColumnDelimiters: invalid regular expression "+delim);
+		return;
+	}
 	patternStr = delim;
+	pattern = p;
 }
 
 std::string SeparatedInput::getColumnDelimiters() const {
@@ -266,7 +276,7 @@ bool SeparatedInput::getCaseSensitive() const {
 
 double SeparatedInput::getUnitFactor(int i) const {
 	if (!bunits || i < 0 || (unsigned int) i >= units_str.size()) {
-		return Units::getFactor("unspecified");
+		return Units::unspecified;
 	}
 	return units_factor[i];
 }
@@ -292,15 +302,7 @@ double SeparatedInput::getColumn(int i, double defaultValue, bool verbose) const
 		if (verbose) error.addWarning("getColumn index " + Fm0(i) + ", line " + Fm0(linenum) + " out of bounds");
 		return defaultValue;
 	}
-	double rtn = defaultValue;
-	try {
-		rtn = Units::from(getUnitFactor(i), Util::parse_double(line_str[i]));
-	}
-	catch (std::runtime_error e) {
-		if (verbose) error.addWarning("could not parse double (" + Fm0(i) + "), line " + Fm0(linenum) + ": " + line_str[i]);
-		rtn = defaultValue;  // arbitrary value
-	}
-	return rtn;
+	return Units::from(getUnitFactor(i), Util::parse_double(line_str[i]));
 }
 
 double SeparatedInput::getColumn(int i) const {
@@ -309,38 +311,38 @@ double SeparatedInput::getColumn(int i) const {
 
 
 double SeparatedInput::getColumn(int i, const std::string& default_unit) const {
-	if (getUnit(i) == "unspecified") {
+	if (!unitSpecified(i)) {
 		return Units::from(default_unit, getColumn(i, 0.0, true));
 	}
 
 	return getColumn(i, 0.0, true);
 }
 
+bool SeparatedInput::unitSpecified(int i) const {
+	return bunits && i >= 0 && (unsigned int) i < units_str.size() && units_str[i] != "unspecified";
+}
+
 
 
 
 
 
 bool SeparatedInput::readLine() {
-	//char* linestr = new char[maxLineSize];
-	string str;
-	str.reserve(maxLineSize);
+	string& str = line_buf;
 	str.clear();
 	try {
 		while( ! reader->eof()) {
-//		while ( ! reader->eof()) {
-//			//reader->getline(linestr, maxLineSize);
-//			getline(*reader, str);
-//			++linenum;
-
-			str = readFullLine(reader);
+			readFullLine(reader, str);
 
-			string lineRead = str + "\n";
+			string lineRead;
+			if (!header) {
+				lineRead = str + "\n";
+			}
 
 			// Remove comments from line
 			size_t comment_num = str.find('#');
 			if (comment_num != string::npos) {   //if (comment_num >= 0) {
-				str = str.substr(0,comment_num);
+				str.erase(comment_num);
 			}
 			trim(str);
 			// Skip empty lines
@@ -387,16 +389,10 @@ bool SeparatedInput::readLine() {
 }
 
 
-string SeparatedInput::readFullLine(std::istream* reader) {
-//		while ( ! reader->eof()) {
-//			//reader->getline(linestr, maxLineSize);
-//			getline(*reader, str);
-//			++linenum;
-
-	string t1;
+void SeparatedInput::readFullLine(std::istream* reader, string& t1) {
 	getline(*reader, t1);
 	++linenum;
-	if (reader->eof()) return t1;
+	if (reader->eof()) return;
 	if (quoteCharDefined) {
 		do {
 			int count = 0;
@@ -411,7 +407,6 @@ string SeparatedInput::readFullLine(std::istream* reader) {
 			t1 = t1 + "\n" + t2;
 		} while (true);
 	}
-	return t1;
 }
 
 int SeparatedInput::lineNumber() const {
@@ -443,8 +438,7 @@ bool SeparatedInput::process_preamble(string str) {
 		parameters.set(id,"");
 		return false;
 	} else {
-		//fields = split(str, patternStr);
-		fields = split_regex(str, patternStr);
+		pattern.split(str, fields);
 		if ( ! caseSensitive) {
 			for (unsigned int i = 0; i < fields.size(); i++) {
 				fields[i] = toLowerCase(fields[i]);
@@ -457,8 +451,7 @@ bool SeparatedInput::process_preamble(string str) {
 }
 
 bool SeparatedInput::process_units(const string& str) {
-	//vector<string> fields = split(str, patternStr);
-	vector<string> fields = split_regex(str, patternStr);
+	vector<string> fields = pattern.split(str);
 
 	// if units are optional, we need to determine if any were read in...
 	// a unit line is considered true if AT LEASE HALF of the fields read in are interpreted as valid units
@@ -490,11 +483,10 @@ bool SeparatedInput::process_units(const string& str) {
 }
 
 void SeparatedInput::process_line(const string& str) {
-	//vector<string> fields = split(str, patternStr);
-	vector<string> fields;
+	vector<string>& fields = line_str;
 	if (fixed_width) {
 		unsigned int idx = 0;
-		fields = vector<string>(width_int.size());
+		fields.resize(width_int.size());
 		for (unsigned int i = 0; i < width_int.size(); i++) {
 			unsigned int end = idx+width_int[i];
 			if (idx < str.length() && end <= str.length()) {
@@ -508,14 +500,12 @@ void SeparatedInput::process_line(const string& str) {
 			idx = idx + width_int[i];
 		}
 	} else {
-		std::string str2 = str;
 		if (quoteCharDefined) {
 			fields = processQuotes(str);
 		} else {
-			fields = split_regex(str2, patternStr);
+			pattern.split(str, fields);
 		}
 	}
-	line_str = fields;
 }
 
 vector<string> SeparatedInput::processQuotes(const string& str) const {
@@ -544,7 +534,7 @@ vector<string> SeparatedInput::processQuotes(const string& str) const {
 						//fpln("  ZZ"+str_j+"ZZ");
 						temp = temp + str_j;
 					} else {
-						vector<string> fields_k = split_regex(str_j,patternStr);
+						vector<string> fields_k = pattern.split(str_j);
 						for (unsigned long k=0; k<fields_k.size(); k++) {
 							string str_k = fields_k[k];
 							temp = temp + str_k;
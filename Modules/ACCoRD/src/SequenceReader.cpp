@@ -193,11 +193,7 @@ void SequenceReader::loadfile() {
 			tm = parseClockTime(input.getColumnString(head[TM_CLK]));
 		}
 
-		SequenceEntry sequenceEntry;
-
-		if (sequenceTable.find(tm) != sequenceTable.end()) {
-			sequenceEntry = sequenceTable[tm];
-		}
+		SequenceEntry& sequenceEntry = sequenceTable[tm];
 
 		if (input.hasError()) {
 			error.addError(input.getMessage());
@@ -206,32 +202,31 @@ void SequenceReader::loadfile() {
 		}
 
 		if (latlon) {
-			ss = Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], "deg"),
-					input.getColumn(head[LON_SY], "deg"),
-					input.getColumn(head[ALT_SZ], "ft")));
+			ss = Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], unit::deg),
+					input.getColumn(head[LON_SY], unit::deg),
+					input.getColumn(head[ALT_SZ], unit::ft)));
 		} else {
 			ss = Position(Vect3(
-					input.getColumn(head[LAT_SX], "nmi"),
-					input.getColumn(head[LON_SY], "nmi"),
-					input.getColumn(head[ALT_SZ], "ft")));
+					input.getColumn(head[LAT_SX], unit::NM),
+					input.getColumn(head[LON_SY], unit::NM),
+					input.getColumn(head[ALT_SZ], unit::ft)));
 		}
 
 		if (trkgsvs) {
 			vv = Velocity::mkTrkGsVs(
-					input.getColumn(head[TRK_VX], "deg"),
-					input.getColumn(head[GS_VY], "knot"),
-					input.getColumn(head[VS_VZ], "fpm"));
+					input.getColumn(head[TRK_VX], unit::deg),
+					input.getColumn(head[GS_VY], unit::knot),
+					input.getColumn(head[VS_VZ], unit::fpm));
 		} else {
 			vv = Velocity::mkVxyz(
-					input.getColumn(head[TRK_VX], "knot"),
-					input.getColumn(head[GS_VY], "knot"),
-					input.getColumn(head[VS_VZ], "fpm"));
+					input.getColumn(head[TRK_VX], unit::knot),
+					input.getColumn(head[GS_VY], unit::knot),
+					input.getColumn(head[VS_VZ], unit::fpm));
 		}
 
 		//fpln("$#%%# "+thisName+"  "+ss.toString()+"  "+vv.toString()+"  "+Fm4(tm));
 
 		sequenceEntry[thisName] = pair<Position,Velocity>(ss,vv);
-		sequenceTable[tm] = sequenceEntry;
 		//lastTime = tm;
 
 		// handle extra columns
@@ -306,14 +301,15 @@ void SequenceReader::buildActive(double tm) {
 		string name = nameIndex[i];
 		for (int j = 0; j < (signed int)times.size(); j++) { // for each name, work through the times in the window
 			double time = times[j];
-			SequenceEntry sequenceEntry = sequenceTable[time];
-			if (sequenceEntry.find(name) != sequenceEntry.end()) {	// name has an entry at this time
+			const SequenceEntry& sequenceEntry = sequenceTable[time];
+			SequenceEntry::const_iterator entry = sequenceEntry.find(name);
+			if (entry != sequenceEntry.end()) {	// name has an entry at this time
 				if (included.find(name) == included.end()) {  // name has not been added to the states list yet
 					// build a new AircraftState
 					included[name]=true;				// note name has been used
 					states.push_back(AircraftState(name)); 	// add new
 				}
-				pair<Position,Velocity> p = sequenceEntry[name];	// get entry info
+				const pair<Position,Velocity>& p = entry->second;	// get entry info
 				states[states.size()-1].add(p.first, p.second, time); // we always work with the last added states entry, because they're ordered by name
 				//fpln(p.first.toString()+" "+p.second.toString()+Fm4(time));
 			}
@@ -323,9 +319,9 @@ void SequenceReader::buildActive(double tm) {
 				std::pair<int,int> key2 = std::pair<int,int>(i, colnum);
 				extracolumnValues.erase(key2); // only keep the most recent entry
 				Triple<double,std::string,int> key3 = Triple<double,std::string,int>(time, name, colnum);
-				if (allExtracolumnValues.find(key3) != allExtracolumnValues.end()) {
-					Triple<double,bool,std::string> entry = allExtracolumnValues[key3];
-					extracolumnValues[key2] = entry;
+				allExtraTblType::const_iterator value = allExtracolumnValues.find(key3);
+				if (value != allExtracolumnValues.end()) {
+					extracolumnValues[key2] = value->second;
 				}
 			}
 
@@ -383,17 +379,13 @@ vector<double> SequenceReader::sequenceKeys() {
 /** a list of n > 0 sequence keys, stopping at the given time (inclusive) */
 vector<double> SequenceReader::sequenceKeysUpTo(int n, double tm) {
 	vector<double> arl;
-	SequenceEntryMap::iterator pos;
-	for (pos = sequenceTable.begin(); pos != sequenceTable.end(); ++pos) {
-		if (pos->first <= tm) {
-			arl.push_back(pos->first);
-		}
-	}
-	sort(arl.begin(),arl.end());
-	// limit to window size
-	while ((signed int)arl.size() > n) {
-		arl.erase(arl.begin());
+	// the table is ordered by time, walk back from the first key after tm
+	SequenceEntryMap::const_iterator pos = sequenceTable.upper_bound(tm);
+	while (pos != sequenceTable.begin() && (signed int)arl.size() < n) {
+		--pos;
+		arl.push_back(pos->first);
 	}
+	std::reverse(arl.begin(),arl.end());
 	return arl;
 }
 
@@ -412,6 +404,24 @@ Position SequenceReader::getSequencePosition(const string& name, double time) {
 	}
 }
 
+void SequenceReader::getSequenceEntry(double time, std::vector<std::string>& acNames, std::vector<Position>& positions, std::vector<Velocity>& velocities) const {
+	acNames.clear();
+	positions.clear();
+	velocities.clear();
+	SequenceEntryMap::const_iterator seq = sequenceTable.find(time);
+	if (seq == sequenceTable.end()) {
+		return;
+	}
+	for (int i = 0; i < (signed int)nameIndex.size(); i++) {
+		SequenceEntry::const_iterator entry = seq->second.find(nameIndex[i]);
+		if (entry != seq->second.end()) {
+			acNames.push_back(entry->first);
+			positions.push_back(entry->second.first);
+			velocities.push_back(entry->second.second);
+		}
+	}
+}
+
 /** Returns the Velocity entry for a given name and time.  If no entry for this name and time, returns a zero velocity and sets a warning. */
 Velocity SequenceReader::getSequenceVelocity(const string& name, double time) {
 	if (hasEntry(name,time)) {
@@ -11,6 +11,7 @@
  */
 
 #include "SimpleNoPolarProjection.h"
+#include "ProjectionArrays.h"
 #include "SimpleProjection.h"
 #include "LatLonAlt.h"
 #include "GreatCircle.h"
@@ -185,6 +186,17 @@ namespace larcfm {
     }
    }
 
+  void SimpleNoPolarProjection::project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const {
+    projectAll(*this,lla,out);
+  }
+
+  void SimpleNoPolarProjection::project(const std::vector<Position>& sip, std::vector<Vect3>& out) const {
+    projectAll(*this,sip,out);
+  }
+
+  void SimpleNoPolarProjection::inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const {
+    inverseAll(*this,xyz,out);
+  }
 
 }
 
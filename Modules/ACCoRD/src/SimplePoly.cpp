@@ -154,9 +154,10 @@ Poly3D SimplePoly::poly3D(const EuclideanProjection& proj) const {
 	Poly3D p3;
 	if (isLatLon()) {
 		//		p3 = Poly3D();
-		for (int i = 0; i < (int) points.size(); i++) {
-			Position p = points[i];
-			p3.add(proj.project(p).vect2());
+		std::vector<Vect3> xyz;
+		proj.project(points, xyz);
+		for (int i = 0; i < (int) xyz.size(); i++) {
+			p3.add(xyz[i].vect2());
 		}
 	} else {
 		//		p3 = Poly3D();
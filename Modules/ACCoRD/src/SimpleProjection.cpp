@@ -11,6 +11,7 @@
  */
 
 #include "SimpleProjection.h"
+#include "ProjectionArrays.h"
 #include "LatLonAlt.h"
 #include "GreatCircle.h"
 //#include "UnitSymbols.h"
@@ -267,8 +268,17 @@ namespace larcfm {
   	return SimpleProjection::polar_inverse(v, alt, north);
   }
 
+  void SimpleProjection::project(const std::vector<LatLonAlt>& lla, std::vector<Vect3>& out) const {
+    projectAll(*this,lla,out);
+  }
 
+  void SimpleProjection::project(const std::vector<Position>& sip, std::vector<Vect3>& out) const {
+    projectAll(*this,sip,out);
+  }
 
+  void SimpleProjection::inverse(const std::vector<Vect3>& xyz, std::vector<LatLonAlt>& out) const {
+    inverseAll(*this,xyz,out);
+  }
 
 }
 
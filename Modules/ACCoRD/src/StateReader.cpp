@@ -231,26 +231,26 @@ namespace larcfm {
       }
       
       if (latlon) {
-        ss = Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], "deg"),
-        		input.getColumn(head[LON_SY], "deg"),
-        		input.getColumn(head[ALT_SZ], "ft")));
+        ss = Position(LatLonAlt::mk(input.getColumn(head[LAT_SX], unit::deg),
+        		input.getColumn(head[LON_SY], unit::deg),
+        		input.getColumn(head[ALT_SZ], unit::ft)));
       } else {
         ss = Position(Vect3(
-        		input.getColumn(head[LAT_SX], "nmi"),
-        		input.getColumn(head[LON_SY], "nmi"),
-        		input.getColumn(head[ALT_SZ], "ft")));
+        		input.getColumn(head[LAT_SX], unit::NM),
+        		input.getColumn(head[LON_SY], unit::NM),
+        		input.getColumn(head[ALT_SZ], unit::ft)));
       }
       
       if (trkgsvs) {
         vv = Velocity::mkTrkGsVs(
-        		input.getColumn(head[TRK_VX], "deg"),
-        		input.getColumn(head[GS_VY], "knot"),
-        		input.getColumn(head[VS_VZ], "fpm"));
+        		input.getColumn(head[TRK_VX], unit::deg),
+        		input.getColumn(head[GS_VY], unit::knot),
+        		input.getColumn(head[VS_VZ], unit::fpm));
       } else {
         vv = Velocity::mkVxyz(
-        		input.getColumn(head[TRK_VX], "knot"),
-        		input.getColumn(head[GS_VY], "knot"),
-        		input.getColumn(head[VS_VZ], "fpm"));
+        		input.getColumn(head[TRK_VX], unit::knot),
+        		input.getColumn(head[GS_VY], unit::knot),
+        		input.getColumn(head[VS_VZ], unit::fpm));
       }
       states[stateIndex].add(ss, vv, tm);
       
@@ -314,7 +314,7 @@ namespace larcfm {
 //        tm = getd(fields2[2]) + 60 * getd(fields2[1]) + 3600 * getd(fields2[0]);
         tm = Util::parse_time(s);
       } else {
-        tm = input.getColumn(head[TM_CLK], "s");
+        tm = input.getColumn(head[TM_CLK], unit::s);
       }
     } catch (std::runtime_error e) {
       error.addError("error parsing time at line "+Fm0(input.lineNumber()));
@@ -36,47 +36,21 @@ Vect2 TangentLine::Q(const Vect2& s, const double D, const int eps) {
     return Vect2();
 }
 
-double InitTangentLineX (const Vect2& s, const double D, const int eps) {
-  double x;
-//  double y;
+// Both coordinates of the tangent line, with Q computed once
+static Vect2 InitTangentLine(const Vect2& s, const double D, const int eps) {
   double sq_s  = s.sqv();
   double sq_D  = sq(D);
   if (Util::almost_equals(sq_s,sq_D))  {
-    x = eps*s.y;
-//    y = -eps*s.x;
-  } else {
-    Vect2 q = TangentLine::Q(s,D,eps);
-    x = q.x;
-//    y = q.y;
-    if (!q.isZero()) {
-      x -= s.x;
-//      y -= s.y;
-    }
+    return Vect2(eps*s.y,-eps*s.x);
   }
-  return x;
-}
-
-double InitTangentLineY (const Vect2& s, const double D, const int eps) {
-//  double x;
-  double y;
-  double sq_s  = s.sqv();
-  double sq_D  = sq(D);
-  if (Util::almost_equals(sq_s,sq_D))  {
-//    x = eps*s.y;
-    y = -eps*s.x;
-  } else {
-    Vect2 q = TangentLine::Q(s,D,eps);
-//    x = q.x;
-    y = q.y;
-    if (!q.isZero()) {
-//      x -= s.x;
-      y -= s.y;
-    }
+  Vect2 q = TangentLine::Q(s,D,eps);
+  if (!q.isZero()) {
+    return Vect2(q.x-s.x,q.y-s.y);
   }
-  return y;
+  return q;
 }
 
-TangentLine::TangentLine(const Vect2& s, const double D, const int eps) : Vect2(InitTangentLineX(s, D, eps), InitTangentLineY(s, D, eps) ) {
+TangentLine::TangentLine(const Vect2& s, const double D, const int eps) : Vect2(InitTangentLine(s, D, eps)) {
   this->eps = eps;
 }
 
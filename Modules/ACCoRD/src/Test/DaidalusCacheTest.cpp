@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2011-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+// Uses the Google unit test framework.
+
+// Daidalus keeps per-intruder conflict, contour, and integer bands caches across cycles.
+// A Daidalus object that is updated in place must compute the same alerts, bands, contours, and
+// hazard zones as an object that is given the same inputs, but whose caches are cleared (reset)
+// every cycle.
+// Both objects see the same history, so hysteresis state is the same.
+
+#include "Daidalus.h"
+#include "ParameterData.h"
+#include "Position.h"
+#include "Velocity.h"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace larcfm;
+
+class DaidalusCacheTest : public ::testing::Test {
+
+public:
+  Daidalus warm;
+  Daidalus cold;
+  int alerter_idx;
+  bool sum;
+
+protected:
+  virtual void SetUp() {
+    warm.set_DO_365A(true,true);
+    cold.set_DO_365A(true,true);
+    alerter_idx = 1;
+    sum = false;
+  }
+
+  // Aircraft states at time t. Ownship flies north, ac1 is head-on, ac2 is crossing from the right,
+  // and ac3 stays clear.
+  void setStates(Daidalus& daa, double t) {
+    Position own = Position::makeLatLonAlt(33.95,"deg",-96.70,"deg",8700.0,"ft");
+    Velocity vo = Velocity::makeTrkGsVs(0.0,"deg",210.0,"kn",0.0,"fpm");
+    daa.setOwnshipState("ownship",own.linear(vo,t),vo,t);
+    Position ac1 = Position::makeLatLonAlt(34.03,"deg",-96.70,"deg",8800.0,"ft");
+    Velocity v1 = Velocity::makeTrkGsVs(180.0,"deg",200.0,"kn",0.0,"fpm");
+    daa.addTrafficState("ac1",ac1.linear(v1,t),v1,t);
+    Position ac2 = Position::makeLatLonAlt(34.008,"deg",-96.64,"deg",8900.0,"ft");
+    Velocity v2 = Velocity::makeTrkGsVs(270.0,"deg",180.0,"kn",0.0,"fpm");
+    daa.addTrafficState("ac2",ac2.linear(v2,t),v2,t);
+    Position ac3 = Position::makeLatLonAlt(33.99,"deg",-96.82,"deg",8700.0,"ft");
+    Velocity v3 = Velocity::makeTrkGsVs(100.0,"deg",220.0,"kn",0.0,"fpm");
+    daa.addTrafficState("ac3",ac3.linear(v3,t),v3,t);
+    daa.setAlerterIndex(2,alerter_idx);
+    if (sum) {
+      daa.setHorizontalPositionUncertainty(1,150.0,150.0,0.0,"m");
+      daa.setVerticalPositionUncertainty(1,20.0,"m");
+      daa.setHorizontalVelocityUncertainty(1,2.0,2.0,0.0,"m/s");
+      daa.setVerticalSpeedUncertainty(1,1.0,"m/s");
+    }
+  }
+
+  void setLookaheadTime(double t) {
+    warm.setLookaheadTime(t,"s");
+    cold.setLookaheadTime(t,"s");
+  }
+
+  // Sets horizontal threshold of all detectors of alerter 1 through setParameterData, which
+  // clears hysteresis, but doesn't reset the object
+  void setDTHR(double dthr) {
+    ParameterData p = warm.getParameterData();
+    p.set("DWC_Phase_I_SUM_det_1_WCV_DTHR",dthr,"nmi");
+    p.set("DWC_Phase_I_SUM_det_2_WCV_DTHR",dthr,"nmi");
+    p.set("DWC_Phase_I_SUM_det_3_WCV_DTHR",dthr,"nmi");
+    warm.setParameterData(p);
+    cold.setParameterData(p);
+  }
+
+  // Updates both objects in place, clears caches of cold object, and compares their outputs
+  void checkAt(double t) {
+    setStates(warm,t);
+    setStates(cold,t);
+    cold.reset();
+    expectSameOutput(t);
+  }
+
+  void setHorizontalContourThreshold(double thr) {
+    warm.setHorizontalContourThreshold(thr,"deg");
+    cold.setHorizontalContourThreshold(thr,"deg");
+  }
+
+  // Updates both objects in place, clears caches of cold object, and compares their contours and
+  // hazard zones for all alert levels. When nthreads > 0, those of the warm object are computed in
+  // advance with that many threads.
+  void checkContoursAt(double t, int nthreads) {
+    setStates(warm,t);
+    setStates(cold,t);
+    cold.reset();
+    if (nthreads > 0) {
+      warm.computeHorizontalContours(-1,nthreads);
+      for (int i = 0; i < 4; ++i) {
+        warm.computeHorizontalHazardZones(i/2 == 1,i%2 == 1,-1,nthreads);
+      }
+    }
+    expectSameContours(t);
+  }
+
+  void expectSamePositions(const std::vector<Position>& cold_ps, const std::vector<Position>& warm_ps) {
+    ASSERT_EQ(cold_ps.size(),warm_ps.size());
+    for (int k = 0; k < static_cast<int>(cold_ps.size()); ++k) {
+      EXPECT_EQ(cold_ps[k].lat(),warm_ps[k].lat());
+      EXPECT_EQ(cold_ps[k].lon(),warm_ps[k].lon());
+      EXPECT_EQ(cold_ps[k].alt(),warm_ps[k].alt());
+    }
+  }
+
+  void expectSameContours(double t) {
+    SCOPED_TRACE("time "+std::to_string(t));
+    ASSERT_EQ(cold.lastTrafficIndex(),warm.lastTrafficIndex());
+    for (int ac = 1; ac <= cold.lastTrafficIndex(); ++ac) {
+      ASSERT_EQ(cold.mostSevereAlertLevel(ac),warm.mostSevereAlertLevel(ac));
+      for (int level = 1; level <= cold.mostSevereAlertLevel(ac); ++level) {
+        SCOPED_TRACE("aircraft "+std::to_string(ac)+", level "+std::to_string(level));
+        std::vector<std::vector<Position> > cold_blobs;
+        std::vector<std::vector<Position> > warm_blobs;
+        cold.horizontalContours(cold_blobs,ac,level);
+        warm.horizontalContours(warm_blobs,ac,level);
+        ASSERT_EQ(cold_blobs.size(),warm_blobs.size());
+        for (int b = 0; b < static_cast<int>(cold_blobs.size()); ++b) {
+          expectSamePositions(cold_blobs[b],warm_blobs[b]);
+        }
+        for (int i = 0; i < 4; ++i) {
+          bool loss = i/2 == 1;
+          bool from_ownship = i%2 == 1;
+          std::vector<Position> cold_haz;
+          std::vector<Position> warm_haz;
+          cold.horizontalHazardZone(cold_haz,ac,loss,from_ownship,level);
+          warm.horizontalHazardZone(warm_haz,ac,loss,from_ownship,level);
+          expectSamePositions(cold_haz,warm_haz);
+        }
+      }
+    }
+  }
+
+  void expectSameOutput(double t) {
+    SCOPED_TRACE("time "+std::to_string(t));
+    ASSERT_EQ(cold.lastTrafficIndex(),warm.lastTrafficIndex());
+    for (int ac = 1; ac <= cold.lastTrafficIndex(); ++ac) {
+      EXPECT_EQ(cold.alertLevel(ac),warm.alertLevel(ac));
+    }
+    ASSERT_EQ(cold.horizontalDirectionBandsLength(),warm.horizontalDirectionBandsLength());
+    for (int i = 0; i < cold.horizontalDirectionBandsLength(); ++i) {
+      EXPECT_EQ(cold.horizontalDirectionIntervalAt(i).low,warm.horizontalDirectionIntervalAt(i).low);
+      EXPECT_EQ(cold.horizontalDirectionIntervalAt(i).up,warm.horizontalDirectionIntervalAt(i).up);
+      EXPECT_EQ(cold.horizontalDirectionRegionAt(i),warm.horizontalDirectionRegionAt(i));
+    }
+    ASSERT_EQ(cold.horizontalSpeedBandsLength(),warm.horizontalSpeedBandsLength());
+    for (int i = 0; i < cold.horizontalSpeedBandsLength(); ++i) {
+      EXPECT_EQ(cold.horizontalSpeedIntervalAt(i).low,warm.horizontalSpeedIntervalAt(i).low);
+      EXPECT_EQ(cold.horizontalSpeedIntervalAt(i).up,warm.horizontalSpeedIntervalAt(i).up);
+      EXPECT_EQ(cold.horizontalSpeedRegionAt(i),warm.horizontalSpeedRegionAt(i));
+    }
+    ASSERT_EQ(cold.verticalSpeedBandsLength(),warm.verticalSpeedBandsLength());
+    for (int i = 0; i < cold.verticalSpeedBandsLength(); ++i) {
+      EXPECT_EQ(cold.verticalSpeedIntervalAt(i).low,warm.verticalSpeedIntervalAt(i).low);
+      EXPECT_EQ(cold.verticalSpeedIntervalAt(i).up,warm.verticalSpeedIntervalAt(i).up);
+      EXPECT_EQ(cold.verticalSpeedRegionAt(i),warm.verticalSpeedRegionAt(i));
+    }
+    ASSERT_EQ(cold.altitudeBandsLength(),warm.altitudeBandsLength());
+    for (int i = 0; i < cold.altitudeBandsLength(); ++i) {
+      EXPECT_EQ(cold.altitudeIntervalAt(i).low,warm.altitudeIntervalAt(i).low);
+      EXPECT_EQ(cold.altitudeIntervalAt(i).up,warm.altitudeIntervalAt(i).up);
+      EXPECT_EQ(cold.altitudeRegionAt(i),warm.altitudeRegionAt(i));
+    }
+  }
+};
+
+TEST_F(DaidalusCacheTest, testStatesChange) {
+  for (double t = 0.0; t <= 60.0; t += 5.0) {
+    checkAt(t);
+  }
+}
+
+TEST_F(DaidalusCacheTest, testSameStatesRepeated) {
+  checkAt(20.0);
+  checkAt(20.0);
+  checkAt(20.0);
+}
+
+TEST_F(DaidalusCacheTest, testSUMChange) {
+  checkAt(10.0);
+  sum = true;
+  checkAt(10.0);
+  checkAt(15.0);
+  sum = false;
+  warm.resetUncertainty(1);
+  cold.resetUncertainty(1);
+  checkAt(15.0);
+}
+
+TEST_F(DaidalusCacheTest, testAlerterChange) {
+  checkAt(10.0);
+  alerter_idx = 2;
+  checkAt(10.0);
+  checkAt(15.0);
+  alerter_idx = 1;
+  checkAt(15.0);
+}
+
+TEST_F(DaidalusCacheTest, testParametersChange) {
+  checkAt(10.0);
+  setLookaheadTime(90.0);
+  checkAt(10.0);
+  checkAt(15.0);
+  setLookaheadTime(180.0);
+  checkAt(15.0);
+}
+
+// Integer bands are only cached when there is no recovery, i.e., before the encounter
+TEST_F(DaidalusCacheTest, testThresholdChange) {
+  checkAt(-30.0);
+  setDTHR(1.2);
+  checkAt(-30.0);
+  checkAt(-25.0);
+  setDTHR(0.66);
+  checkAt(-25.0);
+  checkAt(-20.0);
+}
+
+// Time steps are shorter than the hysteresis time, so that the states are updated in place
+TEST_F(DaidalusCacheTest, testContoursStatesChange) {
+  for (double t = 0.0; t <= 10.0; t += 1.0) {
+    checkContoursAt(t,0);
+    checkContoursAt(t,0);
+  }
+}
+
+TEST_F(DaidalusCacheTest, testContourThresholdChange) {
+  setHorizontalContourThreshold(60.0);
+  checkContoursAt(10.0,0);
+  setHorizontalContourThreshold(180.0);
+  checkContoursAt(10.0,0);
+  setHorizontalContourThreshold(0.0);
+  checkContoursAt(10.0,0);
+  checkContoursAt(11.0,0);
+}
+
+TEST_F(DaidalusCacheTest, testContoursMultithreaded) {
+  checkContoursAt(0.0,4);
+  checkContoursAt(0.0,4);
+  checkContoursAt(1.0,4);
+  setHorizontalContourThreshold(60.0);
+  checkContoursAt(1.0,2);
+  setLookaheadTime(90.0);
+  checkContoursAt(1.0,3);
+  checkContoursAt(2.0,0);
+  checkContoursAt(3.0,4);
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2015-2020 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+
+// Uses the Google unit test framework.
+
+// A DaidalusSector must compute, for every ownship, the same alert levels and bands as a
+// plain Daidalus object that is fed the same states, one cycle after the other.
+
+#include "DaidalusSector.h"
+#include "Daidalus.h"
+#include "Position.h"
+#include "Velocity.h"
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace larcfm;
+
+class DaidalusSectorTest : public ::testing::Test {
+
+public:
+  Daidalus config;
+  std::vector<std::string> ids;
+  std::vector<Position> pos;
+  std::vector<Velocity> vel;
+  std::vector<bool> ownship;
+  std::map<std::string,Daidalus> plain; // Reference Daidalus object of each ownship
+
+protected:
+  virtual void SetUp() {
+    config.set_DO_365A(true,false);
+    add("AC1",33.95,-96.70,8700.0,0.0,210.0,0.0,true);
+    add("AC2",34.03,-96.70,8800.0,180.0,200.0,0.0,true);
+    add("AC3",34.008,-96.64,8900.0,270.0,180.0,0.0,false);
+    add("AC4",33.99,-96.82,8700.0,100.0,220.0,0.0,true);
+    add("AC5",34.20,-96.90,9500.0,150.0,250.0,-500.0,false);
+  }
+
+  void add(const std::string& id, double lat, double lon, double alt, double trk, double gs, double vs, bool own) {
+    ids.push_back(id);
+    pos.push_back(Position::makeLatLonAlt(lat,"deg",lon,"deg",alt,"ft"));
+    vel.push_back(Velocity::makeTrkGsVs(trk,"deg",gs,"kn",vs,"fpm"));
+    ownship.push_back(own);
+  }
+
+  // Position of aircraft ac time stamped at ts, projected to time t
+  Position at(int ac, double t, double ts) const {
+    Position p = pos[ac].linear(vel[ac],ts);
+    return t == ts ? p : p.linear(vel[ac],t-ts);
+  }
+
+  // Adds the states at time t, time stamped at time ts, and computes the sector at time t
+  void cycle(DaidalusSector& sector, double t, double ts) {
+    sector.clear();
+    for (int ac = 0; ac < (int) ids.size(); ++ac) {
+      sector.addAircraft(ids[ac],pos[ac].linear(vel[ac],ts),vel[ac],ts,ownship[ac]);
+    }
+    sector.compute(t);
+    for (int own = 0; own < (int) ids.size(); ++own) {
+      if (!ownship[own]) {
+        EXPECT_FALSE(sector.isOwnship(own));
+        EXPECT_EQ(0,sector.horizontalDirectionBandsLength(own));
+        continue;
+      }
+      if (plain.find(ids[own]) == plain.end()) {
+        plain.insert(std::make_pair(ids[own],config));
+      }
+      Daidalus& daa = plain.find(ids[own])->second;
+      daa.setOwnshipState(ids[own],at(own,t,ts),vel[own],t);
+      std::vector<int> idx(ids.size(),-1);
+      for (int ac = 0; ac < (int) ids.size(); ++ac) {
+        if (ac != own) {
+          idx[ac] = daa.addTrafficState(ids[ac],at(ac,t,ts),vel[ac],t);
+        }
+      }
+      for (int ac = 0; ac < (int) ids.size(); ++ac) {
+        if (ac != own) {
+          EXPECT_EQ(daa.alertLevel(idx[ac]),sector.alertLevel(own,ac));
+        }
+      }
+      EXPECT_EQ(-1,sector.alertLevel(own,own));
+      expectSameBands(daa,sector,own);
+    }
+  }
+
+  void expectSameBands(Daidalus& daa, const DaidalusSector& sector, int own) {
+    SCOPED_TRACE(ids[own]);
+    ASSERT_EQ(daa.horizontalDirectionBandsLength(),sector.horizontalDirectionBandsLength(own));
+    for (int i = 0; i < daa.horizontalDirectionBandsLength(); ++i) {
+      EXPECT_EQ(daa.horizontalDirectionIntervalAt(i).low,sector.horizontalDirectionIntervalAt(own,i).low);
+      EXPECT_EQ(daa.horizontalDirectionIntervalAt(i).up,sector.horizontalDirectionIntervalAt(own,i).up);
+      EXPECT_EQ(daa.horizontalDirectionRegionAt(i),sector.horizontalDirectionRegionAt(own,i));
+    }
+    ASSERT_EQ(daa.horizontalSpeedBandsLength(),sector.horizontalSpeedBandsLength(own));
+    for (int i = 0; i < daa.horizontalSpeedBandsLength(); ++i) {
+      EXPECT_EQ(daa.horizontalSpeedIntervalAt(i).low,sector.horizontalSpeedIntervalAt(own,i).low);
+      EXPECT_EQ(daa.horizontalSpeedIntervalAt(i).up,sector.horizontalSpeedIntervalAt(own,i).up);
+      EXPECT_EQ(daa.horizontalSpeedRegionAt(i),sector.horizontalSpeedRegionAt(own,i));
+    }
+    ASSERT_EQ(daa.verticalSpeedBandsLength(),sector.verticalSpeedBandsLength(own));
+    for (int i = 0; i < daa.verticalSpeedBandsLength(); ++i) {
+      EXPECT_EQ(daa.verticalSpeedIntervalAt(i).low,sector.verticalSpeedIntervalAt(own,i).low);
+      EXPECT_EQ(daa.verticalSpeedIntervalAt(i).up,sector.verticalSpeedIntervalAt(own,i).up);
+      EXPECT_EQ(daa.verticalSpeedRegionAt(i),sector.verticalSpeedRegionAt(own,i));
+    }
+    ASSERT_EQ(daa.altitudeBandsLength(),sector.altitudeBandsLength(own));
+    for (int i = 0; i < daa.altitudeBandsLength(); ++i) {
+      EXPECT_EQ(daa.altitudeIntervalAt(i).low,sector.altitudeIntervalAt(own,i).low);
+      EXPECT_EQ(daa.altitudeIntervalAt(i).up,sector.altitudeIntervalAt(own,i).up);
+      EXPECT_EQ(daa.altitudeRegionAt(i),sector.altitudeRegionAt(own,i));
+    }
+  }
+};
+
+TEST_F(DaidalusSectorTest, testDefaultThreads) {
+  DaidalusSector sector(config);
+  EXPECT_EQ(1,sector.getNumberOfThreads());
+  for (double t = 0.0; t <= 60.0; t += 5.0) {
+    cycle(sector,t,t);
+  }
+}
+
+TEST_F(DaidalusSectorTest, testWorkerThreads) {
+  DaidalusSector sector(config,3);
+  for (double t = 0.0; t <= 60.0; t += 5.0) {
+    cycle(sector,t,t);
+  }
+}
+
+TEST_F(DaidalusSectorTest, testProjectedStates) {
+  DaidalusSector sector(config,2);
+  for (double t = 0.0; t <= 60.0; t += 5.0) {
+    cycle(sector,t,t-2.0);
+  }
+}
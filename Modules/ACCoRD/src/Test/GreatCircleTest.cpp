@@ -13,6 +13,7 @@
 #include "GreatCircle.h"
 #include "SimpleProjection.h"
 #include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 
 using namespace larcfm;
@@ -1256,3 +1257,77 @@ TEST_F(GreatCircleTest, testSphericalTransform) {
 		
 	}
 
+// Points around the globe, including the poles and both sides of the date line
+static std::vector<LatLonAlt> arrayTestPoints() {
+	std::vector<LatLonAlt> pts;
+	pts.push_back(LatLonAlt::make(33.9425, -118.4081, 0.0));
+	pts.push_back(LatLonAlt::make(40.6397, -73.7789, 1000.0));
+	pts.push_back(LatLonAlt::make(-33.9461, 151.1772, 0.0));
+	pts.push_back(LatLonAlt::make(89.9, 179.9, 0.0));
+	pts.push_back(LatLonAlt::make(90.0, 0.0, 0.0));
+	pts.push_back(LatLonAlt::make(-90.0, 0.0, 0.0));
+	pts.push_back(LatLonAlt::make(0.0, 180.0, 0.0));
+	pts.push_back(LatLonAlt::make(0.0, -179.999, 0.0));
+	pts.push_back(LatLonAlt::make(33.9425, -118.4081, 0.0));
+	return pts;
+}
+
+TEST_F(GreatCircleTest, testDistanceArray) {
+	std::vector<LatLonAlt> pts = arrayTestPoints();
+	std::vector<double> dist;
+	GreatCircle::distance(pts[0], std::vector<LatLonAlt>(), dist);
+	EXPECT_TRUE(dist.empty());
+	for (int i = 0; i < (int) pts.size(); i++) {
+		GreatCircle::distance(pts[i], pts, dist);
+		ASSERT_EQ(pts.size(), dist.size());
+		for (int j = 0; j < (int) pts.size(); j++) {
+			EXPECT_EQ(GreatCircle::distance(pts[i], pts[j]), dist[j]) << i << " " << j;
+		}
+	}
+}
+
+TEST_F(GreatCircleTest, testInitialCourseArray) {
+	// Start points include both poles, where all courses are the same
+	std::vector<LatLonAlt> pts = arrayTestPoints();
+	std::vector<double> course;
+	GreatCircle::initial_course(pts[4], std::vector<LatLonAlt>(), course);
+	EXPECT_TRUE(course.empty());
+	for (int i = 0; i < (int) pts.size(); i++) {
+		GreatCircle::initial_course(pts[i], pts, course);
+		ASSERT_EQ(pts.size(), course.size());
+		for (int j = 0; j < (int) pts.size(); j++) {
+			EXPECT_EQ(GreatCircle::initial_course(pts[i], pts[j]), course[j]) << i << " " << j;
+		}
+	}
+	GreatCircle::initial_course(pts[4], pts, course);
+	EXPECT_EQ(M_PI, course[0]);
+	GreatCircle::initial_course(pts[5], pts, course);
+	EXPECT_EQ(2.0*M_PI, course[0]);
+}
+
+TEST_F(GreatCircleTest, testLinearInitialArray) {
+	std::vector<LatLonAlt> pts = arrayTestPoints();
+	std::vector<double> track;
+	std::vector<double> dist;
+	for (int k = 0; k < 12; k++) {
+		track.push_back(Units::from("deg", 30.0*k - 45.0));
+		dist.push_back(Units::from("NM", 1.0 + 450.0*k));
+	}
+	std::vector<LatLonAlt> out;
+	for (int i = 0; i < (int) pts.size(); i++) {
+		GreatCircle::linear_initial(pts[i], track, dist, out);
+		ASSERT_EQ(track.size(), out.size());
+		for (int j = 0; j < (int) track.size(); j++) {
+			LatLonAlt p = GreatCircle::linear_initial(pts[i], track[j], dist[j]);
+			EXPECT_EQ(p.lat(), out[j].lat()) << i << " " << j;
+			EXPECT_EQ(p.lon(), out[j].lon()) << i << " " << j;
+			EXPECT_EQ(p.alt(), out[j].alt()) << i << " " << j;
+		}
+	}
+	// Only as many points as the shorter of track and dist
+	dist.resize(5);
+	GreatCircle::linear_initial(pts[0], track, dist, out);
+	EXPECT_EQ(5u, out.size());
+	GreatCircle::linear_initial(pts[0], std::vector<double>(), dist, out);
+	EXPECT_TRUE(out.empty());
+}
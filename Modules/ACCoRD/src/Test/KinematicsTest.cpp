@@ -12,6 +12,8 @@
 #include "format.h"
 
 #include <cmath>
+#include <limits>
+#include <vector>
 #include <gtest/gtest.h>
 
 using namespace larcfm;
@@ -25,6 +27,55 @@ protected:
 	virtual void SetUp() {
 		PI = M_PI;
 	}
+
+	// Sample counts of the batched kernels: empty, single sample, perfect square, and non-square counts
+	static std::vector<int> sampleCounts() {
+		int ns[] = {0, 1, 2, 16, 17, 50, 257};
+		return std::vector<int>(ns, ns+7);
+	}
+
+	// Equal doubles, including NaN values of invalid velocities
+	static bool same(double a, double b) {
+		return a == b || (ISNAN(a) && ISNAN(b));
+	}
+
+	// Batched acceleration kernels compute each sample with the same operations as the scalar calls
+	static void expectSameSamples(const std::vector<Vect3>& pos, const std::vector<Velocity>& vel, int i,
+			const std::pair<Vect3,Velocity>& sv) {
+		EXPECT_TRUE(same(sv.first.x,pos[i].x) && same(sv.first.y,pos[i].y) && same(sv.first.z,pos[i].z))
+			<< "sample " << i << ": " << sv.first.toString() << " " << pos[i].toString();
+		EXPECT_TRUE(same(sv.second.x,vel[i].x) && same(sv.second.y,vel[i].y) && same(sv.second.z,vel[i].z))
+			<< "sample " << i << ": " << sv.second.toString() << " " << vel[i].toString();
+	}
+
+	// Batched turn against the scalar turn. The track change omega*t of a sample is composed of two
+	// rotations, so the results agree up to the rounding of that angle: velocities to a few ulps of
+	// gs*(1+|omega*t|) and positions, which divide by omega, to a few ulps of |s0|+gs/|omega|*(1+|omega*t|).
+	static void checkTurnOmega(const Vect3& s0, const Velocity& v0, double t0, double dt, double omega) {
+		double eps = std::numeric_limits<double>::epsilon();
+		std::vector<int> ns = sampleCounts();
+		for (int k = 0; k < (int)ns.size(); ++k) {
+			int n = ns[k];
+			std::vector<Vect3> pos;
+			std::vector<Velocity> vel;
+			Kinematics::turnOmega(s0,v0,t0,dt,n,omega,pos,vel);
+			ASSERT_EQ((unsigned long)n,pos.size());
+			ASSERT_EQ((unsigned long)n,vel.size());
+			for (int i = 0; i < n; ++i) {
+				double t = t0+i*dt;
+				std::pair<Vect3,Velocity> sv = Kinematics::turnOmega(s0,v0,t,omega);
+				double angle = 1.0+std::abs(omega*t);
+				double vtol = 4*eps*v0.gs()*angle;
+				double ptol = 4*eps*(s0.norm()+(omega == 0.0 ? 0.0 : v0.gs()/std::abs(omega))*angle);
+				EXPECT_NEAR(sv.second.x,vel[i].x,vtol) << "n " << n << " sample " << i << " omega " << omega;
+				EXPECT_NEAR(sv.second.y,vel[i].y,vtol) << "n " << n << " sample " << i << " omega " << omega;
+				EXPECT_EQ(sv.second.z,vel[i].z);
+				EXPECT_NEAR(sv.first.x,pos[i].x,ptol) << "n " << n << " sample " << i << " omega " << omega;
+				EXPECT_NEAR(sv.first.y,pos[i].y,ptol) << "n " << n << " sample " << i << " omega " << omega;
+				EXPECT_EQ(sv.first.z,pos[i].z);
+			}
+		}
+	}
 };
 
 TEST_F(KinematicsTest, turnRadius) {
@@ -1158,10 +1209,56 @@ TEST_F(KinematicsTest, testDirectToAcuteHughGsOut) {
 	EXPECT_NEAR(Units::from("kn",17977.7),speedOutOfEOT,0.1);        // AGH ... huge ground speed !!!
 }
 
+TEST_F(KinematicsTest, turnOmegaBatch) {
+	Vect3 s0(1.0e4,-2.0e4,3000.0);
+	Velocity v0 = Velocity::mkTrkGsVs(Units::from("deg",40.0),Units::from("kn",250.0),Units::from("fpm",500.0));
+	checkTurnOmega(s0,v0,0.0,1.0,0.05);
+	checkTurnOmega(s0,v0,2.0,0.5,-0.05);
+	checkTurnOmega(s0,v0,-3.0,0.25,0.3);
+	checkTurnOmega(s0,v0,2.0,0.5,-1.2);
+	// Slow turns, where positions lose precision in the scalar and batched kernels alike
+	checkTurnOmega(s0,v0,2.0,0.5,1.0e-6);
+	checkTurnOmega(s0,v0,2.0,0.5,-1.0e-9);
+	// omega almost zero is a straight line
+	checkTurnOmega(s0,v0,2.0,0.5,1.0e-15);
+	checkTurnOmega(s0,v0,2.0,0.5,0.0);
+	checkTurnOmega(s0,Velocity::ZEROV(),0.0,1.0,0.1);
+}
 
+TEST_F(KinematicsTest, gsAccelBatch) {
+	Vect3 s0(1.0e4,-2.0e4,3000.0);
+	Velocity v0 = Velocity::mkTrkGsVs(Units::from("deg",300.0),Units::from("kn",150.0),Units::from("fpm",-300.0));
+	double as[] = {0.0, 2.0, -3.0}; // -3.0 goes through zero ground speed, after which velocities are invalid
+	std::vector<int> ns = sampleCounts();
+	for (int ia = 0; ia < 3; ++ia) {
+		for (int k = 0; k < (int)ns.size(); ++k) {
+			std::vector<Vect3> pos;
+			std::vector<Velocity> vel;
+			Kinematics::gsAccel(s0,v0,-1.0,0.5,ns[k],as[ia],pos,vel);
+			ASSERT_EQ((unsigned long)ns[k],pos.size());
+			ASSERT_EQ((unsigned long)ns[k],vel.size());
+			for (int i = 0; i < ns[k]; ++i) {
+				expectSameSamples(pos,vel,i,Kinematics::gsAccel(s0,v0,-1.0+i*0.5,as[ia]));
+			}
+		}
+	}
+}
 
-
-
-
-
-
+TEST_F(KinematicsTest, vsAccelBatch) {
+	Vect3 s0(1.0e4,-2.0e4,3000.0);
+	Velocity v0 = Velocity::mkTrkGsVs(Units::from("deg",120.0),Units::from("kn",200.0),Units::from("fpm",1000.0));
+	double as[] = {0.0, 1.5, -2.5};
+	std::vector<int> ns = sampleCounts();
+	for (int ia = 0; ia < 3; ++ia) {
+		for (int k = 0; k < (int)ns.size(); ++k) {
+			std::vector<Vect3> pos;
+			std::vector<Velocity> vel;
+			Kinematics::vsAccel(s0,v0,-1.0,0.5,ns[k],as[ia],pos,vel);
+			ASSERT_EQ((unsigned long)ns[k],pos.size());
+			ASSERT_EQ((unsigned long)ns[k],vel.size());
+			for (int i = 0; i < ns[k]; ++i) {
+				expectSameSamples(pos,vel,i,Kinematics::vsAccel(s0,v0,-1.0+i*0.5,as[ia]));
+			}
+		}
+	}
+}
@@ -9,7 +9,11 @@
 // Uses the Google unit test framework.
 #include "Units.h"
 #include "ParameterData.h"
+#include "ParameterKey.h"
+#include "format.h"
 #include <cmath>
+#include <map>
+#include <random>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -28,6 +32,19 @@ protected:
 	void setUp() {
 		//pd = new ParameterData();    // not needed in C++
 	}
+
+	// Returns n keys whose hash is home modulo the initial size (64) of the hash table of
+	// parameters, so that they all collide in that table
+	static std::vector<std::string> collidingKeys(std::size_t home, int n) {
+		std::vector<std::string> keys;
+		for (int i = 0; (int)keys.size() < n; ++i) {
+			std::string key = "key"+Fm0(i);
+			if ((ParameterKey::hashOf(key) & 63) == home) {
+				keys.push_back(key);
+			}
+		}
+		return keys;
+	}
 };
 
 
@@ -625,5 +642,126 @@ TEST_F(ParameterDataTest, testEntryOrder) {
 
 }
 
+TEST_F(ParameterDataTest, testRemoveCollidingKeys) {
+	// Cluster at the end of the hash table, that wraps around to its beginning: the first
+	// key goes in the last slot, followed by keys whose home is the first slot, and then by
+	// keys displaced from the last slot
+	std::vector<std::string> keys63 = collidingKeys(63,6);
+	std::vector<std::string> keys0 = collidingKeys(0,3);
+	std::vector<std::string> keys(1,keys63[0]);
+	keys.insert(keys.end(),keys0.begin(),keys0.end());
+	keys.insert(keys.end(),keys63.begin()+1,keys63.end());
+	for (int i = 0; i < (int)keys.size(); ++i) {
+		pd.setInt(keys[i],i);
+	}
+	EXPECT_EQ((int)keys.size(),pd.size());
+	std::vector<bool> removed(keys.size(),false);
+	int order[] = {0,7,3,6,1};
+	for (int k = 0; k < 5; ++k) {
+		pd.remove(keys[order[k]]);
+		removed[order[k]] = true;
+		for (int i = 0; i < (int)keys.size(); ++i) {
+			EXPECT_EQ(!removed[i],pd.contains(keys[i])) << keys[i];
+			if (!removed[i]) {
+				EXPECT_EQ(i,pd.getInt(keys[i])) << keys[i];
+			}
+		}
+	}
+	EXPECT_EQ((int)keys.size()-5,pd.size());
+	// Removed keys can be set again
+	for (int k = 0; k < 5; ++k) {
+		pd.setInt(keys[order[k]],100+order[k]);
+	}
+	EXPECT_EQ((int)keys.size(),pd.size());
+	for (int i = 0; i < (int)keys.size(); ++i) {
+		EXPECT_EQ(removed[i] ? 100+i : i,pd.getInt(keys[i])) << keys[i];
+	}
+}
 
+TEST_F(ParameterDataTest, testSetRemoveInterleaved) {
+	// Pool of keys with many collisions, large enough to grow the hash table
+	std::vector<std::string> pool = collidingKeys(5,10);
+	std::vector<std::string> more = collidingKeys(6,10);
+	pool.insert(pool.end(),more.begin(),more.end());
+	for (int i = 0; i < 30; ++i) {
+		pool.push_back("param"+Fm0(i));
+	}
+	std::map<std::string,int> expected;
+	std::mt19937 rnd(2020);
+	for (int step = 0; step < 2000; ++step) {
+		const std::string& key = pool[rnd() % pool.size()];
+		if (rnd() % 3 == 0) {
+			pd.remove(key);
+			expected.erase(key);
+		} else {
+			pd.setInt(key,step);
+			expected[key] = step;
+		}
+		ASSERT_EQ((int)expected.size(),pd.size());
+		for (int i = 0; i < (int)pool.size(); ++i) {
+			std::map<std::string,int>::const_iterator pos = expected.find(pool[i]);
+			ASSERT_EQ(pos != expected.end(),pd.contains(pool[i])) << "step " << step << " " << pool[i];
+			if (pos != expected.end()) {
+				ASSERT_EQ(pos->second,pd.getInt(pool[i])) << "step " << step << " " << pool[i];
+			}
+		}
+	}
+}
+
+TEST_F(ParameterDataTest, testParameterKeyCaseInsensitive) {
+	EXPECT_TRUE(pd.set("Lookahead_Time = 20 [s]"));
+	EXPECT_TRUE(pd.set("alerter = DWC"));
+	ParameterKey lookahead("LOOKAHEAD_time");
+	ParameterKey alerter("Alerter");
+	ParameterKey missing("lookahead");
+	EXPECT_EQ(ParameterKey::hashOf("lookahead_time"),lookahead.hash());
+	EXPECT_TRUE(pd.contains(lookahead));
+	EXPECT_TRUE(pd.contains(alerter));
+	EXPECT_FALSE(pd.contains(missing));
+	EXPECT_NEAR(20.0,pd.getValue(lookahead),0.0);
+	EXPECT_EQ("s",pd.getUnit(lookahead));
+	EXPECT_EQ("DWC",pd.getString(alerter));
+	// Capitalization of the first assignment is kept
+	EXPECT_TRUE(pd.set("LOOKAHEAD_TIME = 30 [s]"));
+	EXPECT_EQ(2,pd.size());
+	EXPECT_EQ("Lookahead_Time",pd.getKeyListEntryOrder()[0]);
+	EXPECT_NEAR(30.0,pd.getValue(lookahead),0.0);
+	pd.remove("lookahead_TIME");
+	EXPECT_FALSE(pd.contains(lookahead));
+	EXPECT_FALSE(pd.contains("Lookahead_Time"));
+	EXPECT_TRUE(pd.contains(alerter));
+	EXPECT_EQ(1,pd.size());
+}
 
+TEST_F(ParameterDataTest, testEntryOrderAfterRemove) {
+	pd.set("a = 1");
+	pd.set("b = 2");
+	pd.set("c = 3");
+	pd.set("d = 4");
+	pd.set("e = 5");
+	pd.remove("b");
+	std::vector<std::string> keys = pd.getKeyListEntryOrder();
+	ASSERT_EQ((unsigned long)4,keys.size());
+	EXPECT_EQ("a",keys[0]);
+	EXPECT_EQ("c",keys[1]);
+	EXPECT_EQ("d",keys[2]);
+	EXPECT_EQ("e",keys[3]);
+
+	pd.set("f = 6");
+	pd.set("b = 7");
+	pd.remove("a");
+	keys = pd.getKeyListEntryOrder();
+	ASSERT_EQ((unsigned long)5,keys.size());
+	EXPECT_EQ("c",keys[0]);
+	EXPECT_EQ("d",keys[1]);
+	EXPECT_EQ("e",keys[2]);
+	EXPECT_EQ("f",keys[3]);
+	EXPECT_EQ("b",keys[4]);
+	EXPECT_EQ(7,pd.getInt("b"));
+
+	// Lexical order is not affected by removals
+	keys = pd.getKeyList();
+	ASSERT_EQ((unsigned long)5,keys.size());
+	EXPECT_EQ("b",keys[0]);
+	EXPECT_EQ("f",keys[4]);
+}
@@ -13,11 +13,15 @@
 #include "Projection.h"
 #include "format.h"
 
+#include "AziEquiProjection.h"
 #include "ENUProjection.h"
 #include "OrthographicProjection.h"
+#include "SimpleNoPolarProjection.h"
+#include "SimpleProjection.h"
 #include "VectFuns.h"
 #include <stdlib.h>
 #include <time.h>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -31,6 +35,46 @@ public:
 protected:
   virtual void SetUp() {
   }
+
+  // Array project and inverse of proj are bit-identical to the per-point calls
+  template <typename Proj>
+  static void checkArrays(const Proj& proj) {
+    std::vector<LatLonAlt> lla;
+    std::vector<Position> pos;
+    for (int i = 0; i < 7; i++) {
+      for (int j = 0; j < 5; j++) {
+        lla.push_back(LatLonAlt::make(36.5 + 0.25*i, -123.0 + 0.3*j, 1000.0*j));
+      }
+    }
+    for (int i = 0; i < (int) lla.size(); i++) {
+      pos.push_back(Position(lla[i]));
+    }
+    std::vector<Vect3> xyz;
+    proj.project(std::vector<LatLonAlt>(), xyz);
+    EXPECT_TRUE(xyz.empty());
+    proj.project(lla, xyz);
+    ASSERT_EQ(lla.size(), xyz.size());
+    for (int i = 0; i < (int) lla.size(); i++) {
+      Vect3 p = proj.project(lla[i]);
+      EXPECT_TRUE(p.x == xyz[i].x && p.y == xyz[i].y && p.z == xyz[i].z) << i;
+    }
+    std::vector<Vect3> xyzp;
+    proj.project(pos, xyzp);
+    ASSERT_EQ(pos.size(), xyzp.size());
+    for (int i = 0; i < (int) pos.size(); i++) {
+      Vect3 p = proj.project(pos[i]);
+      EXPECT_TRUE(p.x == xyzp[i].x && p.y == xyzp[i].y && p.z == xyzp[i].z) << i;
+    }
+    std::vector<LatLonAlt> inv;
+    proj.inverse(std::vector<Vect3>(), inv);
+    EXPECT_TRUE(inv.empty());
+    proj.inverse(xyz, inv);
+    ASSERT_EQ(xyz.size(), inv.size());
+    for (int i = 0; i < (int) xyz.size(); i++) {
+      LatLonAlt p = proj.inverse(xyz[i]);
+      EXPECT_TRUE(p.lat() == inv[i].lat() && p.lon() == inv[i].lon() && p.alt() == inv[i].alt()) << i;
+    }
+  }
 };
 
 
@@ -142,6 +186,15 @@ TEST_F(ProjectionTest, testXyz) {
 //	std::cout << "worst angle deg:" << Units::to("deg", worstang1) << " lat:" << worstlatang1 << std::endl;
 //}
 
+TEST_F(ProjectionTest, testArrays) {
+  LatLonAlt ref = LatLonAlt::make(37.5, -122.4, 0.0);
+  checkArrays(ENUProjection(ref.lat(), ref.lon(), ref.alt()));
+  checkArrays(SimpleProjection(ref));
+  checkArrays(SimpleNoPolarProjection(ref));
+  checkArrays(AziEquiProjection(ref));
+  checkArrays(OrthographicProjection(ref));
+}
+
 //
 //#ifdef _MSC_VER
 //int main(int argc, char** argv)
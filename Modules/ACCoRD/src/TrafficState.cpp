@@ -13,6 +13,7 @@
 #include "TrafficState.h"
 
 #include <string>
+#include <cstring>
 
 
 namespace larcfm {
@@ -84,10 +85,10 @@ void TrafficState::setPosition(const Position& new_pos) {
  */
 void TrafficState::applyEuclideanProjection() {
   if (pos_.isLatLon()) {
-    sxyz_ = eprj_.project(pos_);
-    Velocity v = eprj_.projectVelocity(pos_, avel_);
+    std::pair<Vect3,Velocity> sv = eprj_.project(pos_, avel_);
+    sxyz_ = sv.first;
     posxyz_ = Position(sxyz_);
-    velxyz_ = Velocity::make(v);
+    velxyz_ = Velocity::make(sv.second);
   } else {
     posxyz_ = pos_;
     sxyz_ = pos_.vect3();
@@ -125,6 +126,57 @@ TrafficState TrafficState::makeIntruder(const std::string& id, const Position& p
   return TrafficState(id, pos, vel, eprj_, 1);
 }
 
+// True if a and b are the same double, including the sign of zero
+static bool same_bits(double a, double b) {
+  return std::memcmp(&a,&b,sizeof(double)) == 0;
+}
+
+void TrafficState::updateState(const Position& pos, const Velocity& vel, const Velocity& wind_vector, bool same_frame) {
+  Velocity avel = Velocity(vel.Sub(wind_vector));
+  bool same_pos = same_frame && pos.isLatLon() == pos_.isLatLon() &&
+      same_bits(pos.x(),pos_.x()) && same_bits(pos.y(),pos_.y()) && same_bits(pos.z(),pos_.z());
+  bool same_vel = same_pos && same_bits(avel.x,avel_.x) && same_bits(avel.y,avel_.y) && same_bits(avel.z,avel_.z);
+  pos_ = pos;
+  gvel_ = vel;
+  avel_ = avel;
+  alerter_ = 1;
+  sum_ = SUMData::EMPTY();
+  if (!same_pos || !pos_.isLatLon()) {
+    applyEuclideanProjection();
+  } else if (!same_vel) {
+    // Position is unchanged, only velocity needs to be projected again
+    velxyz_ = Velocity::make(eprj_.projectVelocity(pos_, avel_));
+  }
+}
+
+bool TrafficState::updateOwnship(const Position& pos, const Velocity& vel, const Velocity& wind_vector) {
+  bool new_frame = false;
+  if (pos.isLatLon()) {
+    LatLonAlt ref = eprj_.getProjectionPoint();
+    new_frame = ref.lat() != pos.lat() || ref.lon() != pos.lon() || ref.alt() != 0.0;
+    if (new_frame) {
+      eprj_ = Projection::createProjection(pos.lla().zeroAlt());
+    }
+  }
+  updateState(pos,vel,wind_vector,!new_frame);
+  return new_frame;
+}
+
+bool TrafficState::updateIntruder(const TrafficState& ownship, const Position& pos, const Velocity& vel, const Velocity& wind_vector) {
+  if (ownship.isLatLon() != pos.isLatLon() || pos.isInvalid() || vel.isInvalid()) {
+    return false;
+  }
+  // Intruders use the ownship's projection
+  LatLonAlt ref = eprj_.getProjectionPoint();
+  LatLonAlt own_ref = ownship.eprj_.getProjectionPoint();
+  bool same_frame = ref.lat() == own_ref.lat() && ref.lon() == own_ref.lon() && ref.alt() == own_ref.alt();
+  if (!same_frame) {
+    eprj_ = ownship.eprj_;
+  }
+  updateState(pos,vel,wind_vector,same_frame);
+  return true;
+}
+
 void TrafficState::setAlerterIndex(int alerter) {
   alerter_ = std::max(0, alerter);
 }
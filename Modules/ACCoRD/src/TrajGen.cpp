@@ -188,6 +188,131 @@ Plan TrajGen::makeKinematicPlan(const Plan& fp, double bankAngleIn, double gsAcc
 		return TrajGen::makeKinematicPlan(fp, bankAngleIn, gsAccelIn, vsAccelIn, repairTurn, repairGs, repairVs);
 }
 
+// true if point i of the two (linear, marked) plans agrees up to a shift in time and altitude of the points from i on
+static bool sameRelativePoint(const Plan& p1, const Plan& p2, int i) {
+	NavPoint np1 = p1.point(i);
+	NavPoint np2 = p2.point(i);
+	if (!np1.position().almostEquals2D(np2.position(), 1E-6) || np1.name() != np2.name()) return false;
+	TcpData tcp1 = p1.getTcpData(i);
+	TcpData tcp2 = p2.getTcpData(i);
+	if (tcp1.isAltPreserve() != tcp2.isAltPreserve() || tcp1.getRadiusSigned() != tcp2.getRadiusSigned()
+			|| tcp1.getGsAccel() != tcp2.getGsAccel() || tcp1.getVsAccel() != tcp2.getVsAccel()
+			|| tcp1.getInformation() != tcp2.getInformation()) return false;
+	if (i == 0) {
+		return Util::almost_equals(np1.time(), np2.time()) && Util::almost_equals(np1.alt(), np2.alt());
+	}
+	return Util::almost_equals(np1.time() - p1.time(i-1), np2.time() - p2.time(i-1))
+			&& Util::almost_equals(np1.alt() - p1.point(i-1).alt(), np2.alt() - p2.point(i-1).alt());
+}
+
+bool TrajGen::unacceleratedTimeAt(const Plan& kpc, const Position& pos, double& t) {
+	int found = -1;
+	for (int k = 0; k+1 < kpc.size(); k++) {
+		Position p1 = kpc.point(k).position();
+		Position p2 = kpc.point(k+1).position();
+		double d1 = p1.distanceH(pos);
+		double d2 = pos.distanceH(p2);
+		if (d1 > 0 && d2 > 0 && std::abs(d1 + d2 - p1.distanceH(p2)) < 1E-4) {
+			if (found >= 0) return false;
+			found = k;
+		}
+	}
+	if (found < 0 || kpc.inTrkChange(kpc.time(found)) || kpc.inGsChange(kpc.time(found))) return false;
+	double dist = kpc.point(found).position().distanceH(pos);
+	t = kpc.time(found) + dist/kpc.gsOut(found);
+	return ! kpc.inTrkChange(t) && ! kpc.inGsChange(t) && ! kpc.inVsChange(t)
+			&& t - kpc.time(found) > Plan::minDt && kpc.time(found+1) - t > Plan::minDt;
+}
+
+bool TrajGen::updateKinematicPlan(Plan& kpc, const Plan& oldLpc, const Plan& lpc, double bankAngle, double gsAccel, double vsAccel,
+		bool repairTurn, bool repairGs, bool repairVs) {
+	Plan prev = oldLpc;
+	Plan next = lpc;
+	prev.mergeClosePoints(Plan::minDt);
+	next.mergeClosePoints(Plan::minDt);
+	bool comparable = kpc.size() >= 2 && !kpc.hasError() && prev.size() >= 2 && prev.size() == next.size()
+			&& prev.isLinear() && next.isLinear();
+	if (comparable) {
+		prev = markVsChanges(repairPlan(prev, repairTurn, repairVs, bankAngle, vsAccel));
+		next = markVsChanges(repairPlan(next, repairTurn, repairVs, bankAngle, vsAccel));
+		comparable = prev.size() == next.size();
+	}
+	int n = next.size();
+	int first = n;
+	int last = -1;
+	for (int i = 0; comparable && i < n; i++) {
+		if (!sameRelativePoint(prev, next, i)) {
+			if (first == n) first = i;
+			last = i;
+		}
+	}
+	if (comparable && last < 0) return true;  // nothing to regenerate
+
+	// The window is cut in the middle of the leg (a,a+1) before the first edited point, and the middle of the leg
+	// (b,b+1) after the last one, where the old trajectory is straight and unaccelerated.  a = -1 (b = n-1) when the
+	// window extends to the beginning (end) of the plan.
+	int a = std::max(first-2, -1);
+	double tL = 0.0;
+	for ( ; comparable && a >= 0; a--) {
+		if (unacceleratedTimeAt(kpc, next.position((next.time(a)+next.time(a+1))/2.0, true), tL)) break;
+	}
+	int b = std::min(last+1, n-1);
+	double tR = 0.0;
+	for ( ; comparable && b < n-1; b++) {
+		if (unacceleratedTimeAt(kpc, prev.position((prev.time(b)+prev.time(b+1))/2.0, true), tR)) break;
+	}
+	if (comparable && (a >= 0 || b < n-1)) {
+		Plan win(next.getID());
+		if (a >= 0) {
+			double t = (next.time(a)+next.time(a+1))/2.0;
+			win.add(NavPoint(kpc.position(tL), t), TcpData().setAltPreserve());
+		}
+		for (int i = a+1; i <= b; i++) {
+			win.add(next.get(i));
+		}
+		double altShift = 0.0;
+		if (b < n-1) {
+			double t = (next.time(b)+next.time(b+1))/2.0;
+			altShift = next.position(t, true).alt() - prev.position((prev.time(b)+prev.time(b+1))/2.0, true).alt();
+			win.add(NavPoint(kpc.position(tR).mkAlt(kpc.position(tR).alt() + altShift), t), TcpData().setAltPreserve());
+		}
+		Plan kwin = generateTurnTCPs(win, bankAngle);
+		if (!kwin.hasError()) kwin = generateGsTCPs(kwin, gsAccel, repairGs);
+		if (!kwin.hasError()) kwin = makeMarkedVsConstant(kwin);
+		if (!kwin.hasError()) kwin = generateVsTCPs(kwin, vsAccel, false, false);
+		if (!kwin.hasError() && kwin.getFirstTime() == win.getFirstTime()
+				&& kwin.point(0).almostEqualsPosition(win.point(0)) && kwin.point(kwin.size()-1).almostEqualsPosition(win.point(win.size()-1))) {
+			double dtL = a >= 0 ? tL - win.getFirstTime() : 0.0;
+			double dtR = b < n-1 ? kwin.getLastTime() + dtL - tR : 0.0;
+			Plan ret(kpc.getID(), kpc.getNote());
+			if (a >= 0) {
+				for (int k = 0; k < kpc.size() && kpc.time(k) < tL; k++) {
+					ret.add(kpc.get(k));
+				}
+			}
+			int k0 = a >= 0 ? 1 : 0;
+			int k1 = b < n-1 ? kwin.size()-2 : kwin.size()-1;
+			for (int k = k0; k <= k1; k++) {
+				ret.add(kwin.point(k).makeTime(kwin.time(k) + dtL), kwin.getTcpData(k));
+			}
+			if (b < n-1) {
+				for (int k = 0; k < kpc.size(); k++) {
+					if (kpc.time(k) <= tR) continue;
+					NavPoint np = kpc.point(k);
+					ret.add(np.makeTime(np.time() + dtR).mkAlt(np.alt() + altShift), kpc.getTcpData(k));
+				}
+			}
+			if (!ret.hasError()) {
+				ret.cleanPlan();
+				kpc = ret;
+				return true;
+			}
+		}
+	}
+	kpc = makeKinematicPlan(lpc, bankAngle, gsAccel, vsAccel, repairTurn, repairGs, repairVs);
+	return false;
+}
+
 Plan TrajGen::makeVsKinematicPlan(const Plan& p, double vsAccel) {
 	Plan ret;
 	Plan kpc = makeMarkedVsConstant(p);
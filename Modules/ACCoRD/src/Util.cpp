@@ -16,6 +16,9 @@
 #include "Constants.h"
 #include <cmath>
 #include <limits>
+#include <cstdlib>
+#include <cerrno>
+#include <cctype>
 #include <string.h>
 #include "format.h"
 #include "string_util.h"
@@ -465,11 +468,21 @@ bool Util::is_double(const string& str) {
 #endif
 
 double Util::parse_double(const string& str) {
-	std::istringstream stream;
-	stream.str(str);
-	double d;
-	stream >> d;
-	if (stream.fail()) {
+	// strtod, rather than a string stream, as this is called for every field of every line read
+	// from a file. Only decimal numbers are accepted, as by a stream.
+	const char* s = str.c_str();
+	while (isspace(static_cast<unsigned char>(*s))) ++s;
+	const char* digits = (*s == '+' || *s == '-') ? s+1 : s;
+	if (!isdigit(static_cast<unsigned char>(*digits)) && *digits != '.') {
+		return 0.0;
+	}
+	if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+		return 0.0;
+	}
+	char* end;
+	errno = 0;
+	double d = strtod(s, &end);
+	if (end == s || (errno == ERANGE && std::abs(d) == HUGE_VAL)) {
 		return 0.0;
 	}
 	return d;
@@ -265,8 +265,12 @@ double WCV_TAUMOD_SUM::horizontal_wcv_taumod_uncertain_exit(const Vect2& s, cons
 
 LossData WCV_TAUMOD_SUM::horizontal_wcv_taumod_uncertain_interval(const Vect2& s, const Vect2& v,double s_err, double v_err, double T) const {
   double entrytime = horizontal_wcv_taumod_uncertain_entry(s,v,s_err,v_err,T);
+  if (entrytime > T) {
+    // The exit time is not needed
+    return LossData();
+  }
   double exittime = horizontal_wcv_taumod_uncertain_exit(s,v,s_err,v_err,T);
-  if (entrytime > T || exittime < 0 || entrytime > exittime) {
+  if (exittime < 0 || entrytime > exittime) {
     return LossData();
   }
   return LossData(Util::max(0.0,entrytime),Util::min(T,exittime));
@@ -394,6 +398,43 @@ ConflictData WCV_TAUMOD_SUM::conflictDetectionWithTrafficState(const TrafficStat
   return ConflictData(ld,t_tca,dist_tca,s,v);
 }
 
+// Same interval as WCV_taumod_uncertain_interval with the errors of conflictDetectionWithTrafficState. The horizontal
+// speed error, which depends on the range, is only computed when the vertical interval is not empty.
+LossData WCV_TAUMOD_SUM::WCV_taumod_uncertain_loss(const TrafficState& ownship, const TrafficState& intruder,
+    double B, double T) const {
+  double s_err = relativeHorizontalPositionError(ownship,intruder);
+  double sz_err = relativeVerticalPositionError(ownship,intruder);
+  double vz_err = relativeVerticalSpeedError(ownship,intruder);
+  bool v_err_done = false;
+  double v_err = 0.0;
+
+  if (s_err == 0.0 && sz_err == 0.0 && vz_err == 0.0) {
+    v_err = relativeHorizontalSpeedError(ownship,intruder,s_err);
+    if (v_err == 0.0) {
+      return WCV_interval(ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v(),B,T);
+    }
+    v_err_done = true;
+  }
+
+  Vect3 s = ownship.get_s().Sub(intruder.get_s());
+  Vect3 v = ownship.get_v().Sub(intruder.get_v());
+  LossData vint = vertical_WCV_uncertain_interval(B,T,s.z,v.z,Util::max(sz_err,MinError),Util::max(vz_err,MinError));
+  if (vint.getTimeIn() > vint.getTimeOut()) {
+    return vint; // Empty interval
+  }
+  if (!v_err_done) {
+    v_err = relativeHorizontalSpeedError(ownship,intruder,s_err);
+  }
+  LossData hint = horizontal_wcv_taumod_uncertain_interval(s.vect2(),v.vect2(),Util::max(s_err,MinError),Util::max(v_err,MinError),T);
+  if (hint.getTimeIn() > hint.getTimeOut()) {
+    return hint; // Empty interval
+  }
+  if (hint.getTimeOut() < B) {
+    return LossData();
+  }
+  return  LossData(Util::max(vint.getTimeIn(),hint.getTimeIn()),Util::min(vint.getTimeOut(),hint.getTimeOut()));
+}
+
 Detection3D* WCV_TAUMOD_SUM::make() const {
   return new WCV_TAUMOD_SUM();
 }
@@ -104,12 +104,7 @@ void WCV_tvar::setTCOA(double val, const std::string& u) {
 }
 
 bool WCV_tvar::horizontal_WCV(const Vect2& s, const Vect2& v) const {
-  if (s.norm() <= table.getDTHR()) return true;
-  if (Horizontal::dcpa(s,v) <= table.getDTHR()) {
-    double tvar = horizontal_tvar(s,v);
-    return 0  <= tvar && tvar <= table.getTTHR();
-  }
-  return false;
+  return horizontal_WCV_with(*this,s,v);
 }
 
 ConflictData WCV_tvar::conflictDetection(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T) const {
@@ -125,35 +120,7 @@ LossData WCV_tvar::WCV3D(const Vect3& so, const Velocity& vo, const Vect3& si, c
 
 // Assumes 0 <= B < T
 LossData WCV_tvar::WCV_interval(const Vect3& so, const Velocity& vo, const Vect3& si, const Velocity& vi, double B, double T) const {
-  double time_in = T;
-  double time_out = B;
-
-  Vect2 so2 = so.vect2();
-  Vect2 si2 = si.vect2();
-  Vect2 s2 = so2.Sub(si2);
-  Vect2 vo2 = vo.vect2();
-  Vect2 vi2 = vi.vect2();
-  Vect2 v2 = vo2.Sub(vi2);
-  double sz = so.z-si.z;
-  double vz = vo.z-vi.z;
-
-  Interval ii = wcv_vertical->vertical_WCV_interval(table.getZTHR(),table.getTCOA(),B,T,sz,vz);
-
-  if (ii.low > ii.up) {
-    return LossData(time_in,time_out);
-  }
-  Vect2 step = v2.ScalAdd(ii.low,s2);
-  if (Util::almost_equals(ii.low,ii.up)) { // [CAM] Changed from == to almost_equals to mitigate numerical problems
-    if (horizontal_WCV(step,v2)) {
-      time_in = ii.low;
-      time_out = ii.up;
-    }
-    return LossData(time_in,time_out);
-  }
-  LossData ld = horizontal_WCV_interval(ii.up-ii.low,step,v2);
-  time_in = ld.getTimeIn() + ii.low;
-  time_out = ld.getTimeOut() + ii.low;
-  return LossData(time_in,time_out);
+  return WCV_interval_with(*this,so,vo,si,vi,B,T);
 }
 
 bool WCV_tvar::containsTable(WCV_tvar* wcv) const {
@@ -12,6 +12,7 @@
 
 #include "string_util.h"
 #include "format.h"
+#include "DelimiterPattern.h"
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -131,64 +132,11 @@ bool matches(const string& s, const string& rgx_str) {
 
 #else
 	vector<string> split_regex(const std::string& s, const std::string& rgx_str) {
-		std::vector<std::string> elems;
-
-		int reti;
-		regex_t rgx;
-		reti = regcomp(&rgx, rgx_str.c_str(), REG_EXTENDED);
-		if (reti != 0) {
+		DelimiterPattern rgx(rgx_str);
+		if (!rgx.valid()) {
 			fdln("Could not compile regex\n");
 		}
-
-		/* Execute regular expression */
-		char between[100];
-		int numchars;
-		regmatch_t matchptr[1];
-		int count = 0;
-		const int length = s.size();
-		const char* cstr = s.c_str();
-		//fpln("regex str="+rgx_str);
-		//fpln("split_regex s.size()="+Fm2(length));
-		while (count < length) {
-			string m2(cstr+count);
-			//fpln("str = "+m2);
-			//fpln("count = "+Fm2(count));
-			reti = regexec(&rgx, cstr+count, 1, matchptr, 0);
-			if (!reti) {
-				numchars = matchptr[0].rm_so;
-				//fpln("l2 numchars="+Fm2(numchars));
-				strncpy(between,cstr+count,numchars);
-				between[numchars] = '\0';
-				string m1(between);
-				elems.push_back(m1);
-				//fpln("match1="+m1);
-
-				count = count + matchptr[0].rm_eo;
-
-				if (count == length) {
-					elems.push_back("");
-				}
-			} else if (reti == REG_NOMATCH) {
-				numchars = length - count;
-				strncpy(between,cstr+count,numchars);
-				between[numchars] = '\0';
-				string m1(between);
-				elems.push_back(m1);
-				//fpln("match2="+m1);
-
-				count = s.size();
-			} else {
-				regerror(reti, &rgx, between, sizeof(between));
-				string m1(between);
-				//fdln("Regex match failed: "+m1);
-			}
-
-		}
-
-		//fpln("split_regex done!");
-		regfree(&rgx);
-		return elems;
-
+		return rgx.split(s);
 	}
 
 	bool matches(const string& s, const string& rgx_str) {
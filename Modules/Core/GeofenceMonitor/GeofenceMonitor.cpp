@@ -63,10 +63,11 @@ bool GeofenceMonitor::CheckViolation(double position[],double trk,double gs,doub
 
         EuclideanProjection *proj = gf->GetProjection();
         Vect3 currentPosR3 = proj->project(currentPosLLA);
+        PreparedPolygon *poly = gf->GetPreparedPoly3D();
 
 
         if (gf->GetType() == KEEP_IN) {
-            if (geoPolyCarp.nearEdge(currentPosR3, *(gf->GetPoly3D()), hthreshold, vthreshold)) {
+            if (poly->nearEdge(currentPosR3, hthreshold, vthreshold)) {
                 conflict = true;
                 //printf("Conflict keep in fence\n");
             } else {
@@ -78,7 +79,7 @@ bool GeofenceMonitor::CheckViolation(double position[],double trk,double gs,doub
                 conflict = conflict | CollisionDetection(gf, &currentPosLLA, &vel, 0, lookahead);
             }
 
-            if (geoPolyCarp.definitelyInside(currentPosR3, *(gf->GetPoly3D()))) {
+            if (poly->definitelyInside(currentPosR3)) {
                 violation = false;
             } else {
                 violation = true;
@@ -119,7 +120,7 @@ bool GeofenceMonitor::CheckViolation(double position[],double trk,double gs,doub
                 conflict = false;
             }
 
-            if (geoPolyCarp.definitelyInside(currentPosR3, *(gf->GetPoly3D()))) {
+            if (poly->definitelyInside(currentPosR3)) {
                 violation = true;
                 //printf("violation keep out fence\n");
             } else {
@@ -235,6 +236,7 @@ void GeofenceMonitor::InputGeofenceData(int type,int index, int totalVertices, d
     for(int i=0;i<totalVertices;++i) {
         newfence.AddVertex(i, pos[i][0], pos[i][1], ResolBUFF);
     }
+    newfence.PreparePoly3D(geoPolyCarp);
     if(fenceList.size() > index){
         fenceList.clear();
         for(int i=geoPolyPath.size()-1;i>=0;i--){
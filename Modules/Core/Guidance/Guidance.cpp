@@ -298,10 +298,10 @@ void Guidance::InputFlightplanData(const std::string &plan_id, const std::list<w
     larcfm::Plan newPlan(plan_id); 
     if (fp != NULL){
         fp->clear();
-        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate);
+        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate,&kinematicPlans[plan_id]);
     }else{
         fp = &newPlan;
-        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate);
+        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate,&kinematicPlans[plan_id]);
         planList.push_back(newPlan);
     }
     //std::cout<<newPlan.toString()<<std::endl;
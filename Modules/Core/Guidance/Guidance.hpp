@@ -18,6 +18,7 @@
 
 #include "Guidance.h"
 #include "Interfaces.h"
+#include "WP2Plan.hpp"
 
 /**
  * @brief Core class for performing guidance computations
@@ -27,6 +28,7 @@ class Guidance{
 private:
 
     std::list<larcfm::Plan> planList;                 ///< List of all plans received by guidance
+    std::map<std::string,kinematicPlanCache_t> kinematicPlans; ///< Linear and kinematic plans last generated for each plan id
     std::map<std::string,int> nextWpId;               ///< Map from flight plan id to next waypoint id
     std::string activePlanId;                         ///< Plan ID for active plan
     std::string prevPlan;                             ///< Plan ID for previous plan
@@ -5,10 +5,15 @@
 #include "DaidalusMonitor.hpp"
 #include "StateReader.h"
 #include "ParameterData.h"
+#include "ParameterKey.h"
 #include <sys/time.h>
 #include <list>
 #include <cstring>
 #include <Units.h>
+#include <algorithm>
+#include "WCV_tvar.h"
+#include "CDCylinder.h"
+#include "TCASTable.h"
 
 DaidalusMonitor::DaidalusMonitor(std::string callsgn,std::string daaConfig) {
     conflictStartTime = 0;
@@ -29,10 +34,23 @@ DaidalusMonitor::DaidalusMonitor(std::string callsgn,std::string daaConfig) {
     vsIntTypes.push_back(larcfm::BandsRegion::NONE);
     altIntTypes.push_back(larcfm::BandsRegion::NONE);
 
+    prefilter = false;
+    prefilterMargin = 0;
+    numPrunedTraffic = 0;
+
     UpdateParameters(daaConfig); 
 
 }
 
+// Parameter keys read on every configuration update
+static const larcfm::ParameterKey RECORD_DAA_LOGS("record_daa_logs");
+static const larcfm::ParameterKey ALERT_1_ALERTING_TIME("alert_1_alerting_time");
+static const larcfm::ParameterKey TRAFFIC_SOURCE("traffic_source");
+static const larcfm::ParameterKey STALE_THRESHOLD("stale_threshold");
+static const larcfm::ParameterKey SENSOR_MAPPING("sensor_mapping");
+static const larcfm::ParameterKey TRAFFIC_PREFILTER("traffic_prefilter");
+static const larcfm::ParameterKey TRAFFIC_PREFILTER_MARGIN("traffic_prefilter_margin");
+
 void DaidalusMonitor::UpdateParameters(std::string daaParameters) {
 
     larcfm::StateReader reader;
@@ -46,7 +64,7 @@ void DaidalusMonitor::UpdateParameters(std::string daaParameters) {
     double localT = tv.tv_sec + static_cast<float>(tv.tv_nsec)/1E9;
     sprintf(fmt1,"log/Daidalus-%s-%f.log",callsign.c_str(),localT);
 
-    if(parameters.getBool("record_daa_logs")) {
+    if(parameters.getBool(RECORD_DAA_LOGS)) {
         if(!logfileIn.is_open()){
            logfileIn.open(fmt1);
         }
@@ -55,10 +73,137 @@ void DaidalusMonitor::UpdateParameters(std::string daaParameters) {
     DAA1.setParameterData(parameters);
     DAA2.setParameterData(parameters);
 
-    alertingTime = DAA1.getAlerterAt(1).getParameters().getValue("alert_1_alerting_time");
-    dataSource = parameters.getInt("traffic_source");
-    staleThreshold = parameters.getValue("stale_threshold");
-    sensorMapping = parameters.getBool("sensor_mapping");
+    alertingTime = DAA1.getAlerterAt(1).getParameters().getValue(ALERT_1_ALERTING_TIME);
+    dataSource = parameters.getInt(TRAFFIC_SOURCE);
+    staleThreshold = parameters.getValue(STALE_THRESHOLD);
+    sensorMapping = parameters.getBool(SENSOR_MAPPING);
+
+    prefilter = parameters.getBool(TRAFFIC_PREFILTER);
+    prefilterMargin = parameters.contains(TRAFFIC_PREFILTER_MARGIN) ? parameters.getValue(TRAFFIC_PREFILTER_MARGIN) : 5.0;
+    SetPrefilterBounds();
+    prunableSince.clear();
+}
+
+// Largest well clear volume and time horizon over all the alerters of DAA1. The bounds only cover
+// cylinders and WCV_TAUMOD/TCPA/TEP volumes, which are within DTHR + TTHR*(closure rate) horizontally
+// and ZTHR + TCOA*(vertical closure rate) vertically. The pre-filter is not supported for other
+// detectors (e.g., SUM or TCAS), nor with DTA logic, where the alerter of an intruder depends on its position.
+void DaidalusMonitor::SetPrefilterBounds() {
+    prefilterSupported = DAA1.isDisabledDTALogic();
+    prefilterHorizon = DAA1.getLookaheadTime();
+    prefilterDist = std::max(DAA1.getMinHorizontalRecovery(),DAA1.getHorizontalNMAC());
+    prefilterHeight = std::max(DAA1.getMinVerticalRecovery(),DAA1.getVerticalNMAC());
+    prefilterTime = 0;
+    prefilterVertTime = 0;
+    // Recovery thresholds that are not set are taken from the RA table, at sensitivity level 3 or above
+    const larcfm::TCASTable& ra = larcfm::TCASTable::TCASII_RA();
+    for(int sl=3;sl<=ra.getMaxSensitivityLevel();++sl){
+        if(DAA1.getMinHorizontalRecovery() <= 0){
+            prefilterDist = std::max(prefilterDist,ra.getHMD(sl));
+        }
+        if(DAA1.getMinVerticalRecovery() <= 0){
+            prefilterHeight = std::max(prefilterHeight,ra.getZTHR(sl));
+        }
+    }
+    for(int i=1;i<=DAA1.numberOfAlerters();++i){
+        const larcfm::Alerter& alerter = DAA1.getAlerterAt(i);
+        for(int level=1;level<=alerter.mostSevereAlertLevel();++level){
+            const larcfm::AlertThresholds& thresholds = alerter.getLevel(level);
+            prefilterHorizon = std::max(prefilterHorizon,std::max(thresholds.getAlertingTime(),thresholds.getEarlyAlertingTime()));
+            larcfm::Detection3D* detector = alerter.getDetectorPtr(level);
+            if(detector == NULL){
+                continue;
+            }
+            if(detector->instanceOf("gov.nasa.larcfm.ACCoRD.WCV_TAUMOD") ||
+               detector->instanceOf("gov.nasa.larcfm.ACCoRD.WCV_TCPA") ||
+               detector->instanceOf("gov.nasa.larcfm.ACCoRD.WCV_TEP")){
+                larcfm::WCV_tvar* wcv = static_cast<larcfm::WCV_tvar*>(detector);
+                prefilterDist = std::max(prefilterDist,wcv->getDTHR());
+                prefilterTime = std::max(prefilterTime,wcv->getTTHR());
+                prefilterHeight = std::max(prefilterHeight,wcv->getZTHR());
+                prefilterVertTime = std::max(prefilterVertTime,wcv->getTCOA());
+            }else if(detector->instanceOf("gov.nasa.larcfm.ACCoRD.CDCylinder")){
+                larcfm::CDCylinder* cyl = static_cast<larcfm::CDCylinder*>(detector);
+                prefilterDist = std::max(prefilterDist,cyl->getHorizontalSeparation());
+                prefilterHeight = std::max(prefilterHeight,cyl->getVerticalSeparation());
+            }else{
+                prefilterSupported = false;
+            }
+        }
+    }
+    prefilterHorizon += prefilterMargin;
+}
+
+// True if no ownship maneuver within the limits of the bands (speeds, vertical speeds, altitudes)
+// can bring the intruder into any well clear volume within the pre-filter horizon. The states are
+// those DAIDALUS uses: the intruder is projected to the current time and both aircraft are in the
+// ownship's Euclidean frame, with the wind removed from their velocities.
+bool DaidalusMonitor::CannotConflict(const object& intruder) {
+    const larcfm::TrafficState& own = DAA1.getOwnshipState();
+    double dt = DAA1.getCurrentTime() - intruder.time;
+    larcfm::Position pos = dt == 0 ? intruder.position : intruder.position.linear(intruder.velocity,dt);
+    larcfm::TrafficState ac = own.makeIntruder(intruder.callsign,pos,intruder.velocity);
+    if(!ac.isValid()){
+        return false;
+    }
+    ac.applyWindVector(DAA1.getWindVelocityTo());
+    double T = prefilterHorizon;
+
+    // Horizontally, the intruder is within DTHR + TTHR*(closure rate) of the ownship only if
+    // it was within that distance plus T*(closure rate) at the current time
+    const larcfm::Vect3& so = own.get_s();
+    const larcfm::Velocity& vo = own.get_v();
+    const larcfm::Vect3& si = ac.get_s();
+    const larcfm::Velocity& vi = ac.get_v();
+    double gso = std::max(DAA1.getMaxHorizontalSpeed(),vo.gs()+std::max(0.0,DAA1.getAboveRelativeHorizontalSpeed()));
+    double vh = gso + vi.gs();
+    if(si.vect2().Sub(so.vect2()).norm() > prefilterDist + vh*(prefilterTime + T)){
+        return true;
+    }
+
+    // Vertically, the ownship stays between the altitudes it can reach, widened by its largest vertical
+    // speed (altitude bands change altitude instantaneously when vertical_rate is 0)
+    double vso = std::max(std::max(std::fabs(DAA1.getMinVerticalSpeed()),std::fabs(DAA1.getMaxVerticalSpeed())),
+                          std::max(std::fabs(vo.vs())+std::max(0.0,std::max(DAA1.getAboveRelativeVerticalSpeed(),DAA1.getBelowRelativeVerticalSpeed())),
+                                   DAA1.getVerticalRate()));
+    double lowOwn = so.z;
+    double highOwn = so.z;
+    if(DAA1.getVerticalRate() <= 0){
+        lowOwn = std::min(lowOwn,std::min(DAA1.getMinAltitude(),so.z-std::max(0.0,DAA1.getBelowRelativeAltitude())));
+        highOwn = std::max(highOwn,std::max(DAA1.getMaxAltitude(),so.z+std::max(0.0,DAA1.getAboveRelativeAltitude())));
+    }
+    lowOwn -= vso*T;
+    highOwn += vso*T;
+    double lowIntruder = std::min(si.z,si.z+vi.vs()*T);
+    double highIntruder = std::max(si.z,si.z+vi.vs()*T);
+    double height = prefilterHeight + (vso + std::fabs(vi.vs()))*prefilterVertTime;
+    return lowIntruder > highOwn + height || highIntruder < lowOwn - height;
+}
+
+// An intruder is only removed once it has been found prunable, while still given to DAIDALUS, for at
+// least N cycles and for the persistence time. Its alerting hysteresis is then all zeros, which is the
+// same as the fresh hysteresis it gets when it is added again (its first raw alert is 0 because the
+// horizon of the bounds exceeds the lookahead time by the margin).
+bool DaidalusMonitor::PruneIntruder(const object& intruder) {
+    if(!prefilter || !prefilterSupported || !CannotConflict(intruder)){
+        prunableSince.erase(intruder.callsign);
+        return false;
+    }
+    auto it = prunableSince.find(intruder.callsign);
+    if(it == prunableSince.end()){
+        prunableSince[intruder.callsign] = std::make_pair(elapsedTime,1);
+        return false;
+    }
+    std::pair<double,int>& since = it->second;
+    if(since.second < DAA1.getAlertingParameterN() || elapsedTime - since.first < DAA1.getPersistenceTime()){
+        since.second++;
+        return false;
+    }
+    return true;
+}
+
+int DaidalusMonitor::GetNumPrunedTraffic(void){
+    return numPrunedTraffic;
 }
 
 std::string DaidalusMonitor::GetAlerter(object& intruder){
@@ -92,29 +237,42 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
     };
 
 
-    DAA1.setOwnshipState("Ownship", position, velocity, elapsedTime);
+    // The ownship is updated in place, and so are the intruders that were given to DAA1 in the previous cycle
+    if(!DAA1.updateOwnshipState(position, velocity, elapsedTime)){
+        DAA1.setOwnshipState("Ownship", position, velocity, elapsedTime);
+    }
     SetSUM(0,posSigma,velSigma); 
     int count = 0;
     bool conflict = false;
     std::list<object> staleData;
-    for (auto elem:trafficList){
+    numPrunedTraffic = 0;
+    for (auto& elem:trafficList){
         if( !(dataSource == 0 || elem.second.source == dataSource) ){
             continue;
         }
         count++;
+        int alert = -1;
         // Use traffic only if its data has been updated within the last 10s.
         if(elapsedTime - elem.second.time < staleThreshold && elem.second.position.alt() > 1){
-            DAA1.addTrafficState(elem.second.callsign, elem.second.position, elem.second.velocity, elem.second.time);
-            SetSUM(count,elem.second.posSigma,elem.second.velSigma);
-            if(!DAA1.isAlertingLogicOwnshipCentric() && sensorMapping){
-                std::string alerter = GetAlerter(elem.second);
-                DAA1.setAlerter(count,alerter);
+            if(PruneIntruder(elem.second)){
+                // SUM is still applied, in the same order, so that the other intruders see the same uncertainties
+                SetSUM(count,elem.second.posSigma,elem.second.velSigma);
+                numPrunedTraffic++;
+                alert = 0;
+            }else{
+                int index = DAA1.addTrafficState(elem.second.callsign, elem.second.position, elem.second.velocity, elem.second.time);
+                SetSUM(count,elem.second.posSigma,elem.second.velSigma);
+                if(!DAA1.isAlertingLogicOwnshipCentric() && sensorMapping){
+                    std::string alerter = GetAlerter(elem.second);
+                    DAA1.setAlerter(index,alerter);
+                }
+                alert = DAA1.alertLevel(index);
             }
         }else{
             staleData.push_back(elem.second);
+            prunableSince.erase(elem.second.callsign);
         }
 
-        int alert = DAA1.alertLevel(count);
         if(alert > 0) {
             conflict = true;
             conflictStartTime = elapsedTime;
@@ -128,6 +286,14 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
         trafficList.erase(elem.callsign);
     }
 
+    for(auto it = prunableSince.begin(); it != prunableSince.end();){
+        if(trafficList.find(it->first) == trafficList.end()){
+            prunableSince.erase(it++);
+        }else{
+            ++it;
+        }
+    }
+
 
     double daaTimeElapsed = elapsedTime - conflictStartTime;
     const double holdConflictTime = 0; 
@@ -152,7 +318,7 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
         trackIntTypes.clear();
         trackInterval.clear();
         for (int i = 0; i < numTrackBands; ++i) {
-            larcfm::Interval iv = DAA1.horizontalDirectionIntervalAt(i, "deg");
+            larcfm::Interval iv = DAA1.horizontalDirectionIntervalAt(i, larcfm::unit::deg);
             trackIntTypes.push_back((int) DAA1.horizontalDirectionRegionAt(i));
             std::vector<double> trkband(2,0);
             trkband[0] = iv.low;
@@ -164,7 +330,7 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
         speedIntTypes.clear();
         speedInterval.clear();
         for (int i = 0; i < numSpeedBands; ++i) {
-            larcfm::Interval iv = DAA1.horizontalSpeedIntervalAt(i, "m/s");
+            larcfm::Interval iv = DAA1.horizontalSpeedIntervalAt(i, larcfm::unit::mps);
             speedIntTypes.push_back((int) DAA1.horizontalSpeedRegionAt(i));
             std::vector<double> speedband(2,0);
             speedband[0] = iv.low;
@@ -176,7 +342,7 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
         vsIntTypes.clear();
         vsInterval.clear();
         for (int i = 0; i < numVerticalSpeedBands; ++i) {
-            larcfm::Interval iv = DAA1.verticalSpeedIntervalAt(i, "m/s");
+            larcfm::Interval iv = DAA1.verticalSpeedIntervalAt(i, larcfm::unit::mps);
             vsIntTypes.push_back((int) DAA1.verticalSpeedRegionAt(i));
             std::vector<double> vsband(2,0);
             vsband[0] = iv.low;
@@ -188,7 +354,7 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
         altIntTypes.clear();
         altInterval.clear();
         for(int i =0;i< numAltitudeBands; ++i){
-            larcfm::Interval iv = DAA1.altitudeIntervalAt(i,"m");
+            larcfm::Interval iv = DAA1.altitudeIntervalAt(i,larcfm::unit::m);
             altIntTypes.push_back((int) DAA1.altitudeRegionAt(i));
             std::vector<double> altband(2,0);
             altband[0] = iv.low;
@@ -201,6 +367,9 @@ void DaidalusMonitor::MonitorTraffic(larcfm::Velocity windfrom) {
 
     if(logfileIn.is_open() && elapsedTime > prevLogTime+0.5){
         logfileIn << "**************** Current Time:"+std::to_string(elapsedTime)+" *******************\n";
+        if(prefilter){
+            logfileIn << "Pruned traffic: "+std::to_string(numPrunedTraffic)+"\n";
+        }
         logfileIn << DAA1.toString()+"\n";
         prevLogTime = elapsedTime;
     }
@@ -222,7 +391,7 @@ bool DaidalusMonitor::CheckPositionFeasibility(const larcfm::Position wp,double
     double verticalSpeed;
     double gs;
     if (speed < 0){
-        gs = velocity.groundSpeed("m/s");
+        gs = velocity.gs();
     }else{
         gs = speed;
     }
@@ -236,7 +405,7 @@ bool DaidalusMonitor::CheckPositionFeasibility(const larcfm::Position wp,double
     }
 
 
-    vo = larcfm::Velocity::makeTrkGsVs(track,"degree",gs,"m/s",verticalSpeed,"m/s");
+    vo = larcfm::Velocity::mkTrkGsVs(larcfm::Units::from(larcfm::unit::deg,track),gs,verticalSpeed);
     DAA2.setOwnshipState("Ownship", position, vo, elapsedTime);
     double dist2traffic = MAXDOUBLE;
     int count = 0;
@@ -267,8 +436,8 @@ bool DaidalusMonitor::CheckPositionFeasibility(const larcfm::Position wp,double
 }
 
 bool DaidalusMonitor::CheckSafeToTurn(double position[],double velocity[],double fromHeading,double toHeading){
-    larcfm::Position so = larcfm::Position::makeLatLonAlt(position[0],"degree",position[1],"degree",position[2],"m");
-    larcfm::Velocity vo = larcfm::Velocity::makeTrkGsVs(toHeading,"degree",velocity[1],"m/s",velocity[2],"m/s");
+    larcfm::Position so = larcfm::Position::mkLatLonAlt(larcfm::Units::from(larcfm::unit::deg,position[0]),larcfm::Units::from(larcfm::unit::deg,position[1]),position[2]);
+    larcfm::Velocity vo = larcfm::Velocity::mkTrkGsVs(larcfm::Units::from(larcfm::unit::deg,toHeading),velocity[1],velocity[2]);
 
     bool conflict = false;
 
@@ -285,7 +454,7 @@ bool DaidalusMonitor::CheckSafeToTurn(double position[],double velocity[],double
 
     for (int i = 0; i < DAA2.horizontalDirectionBandsLength(); ++i){
 
-        larcfm::Interval iv = DAA2.track(i, "deg");
+        larcfm::Interval iv = DAA2.horizontalDirectionIntervalAt(i, larcfm::unit::deg);
         double low = iv.low;
         double high = iv.up;
 
@@ -391,8 +560,8 @@ bands_t DaidalusMonitor::GetTrackBands(void) {
            larcfm::RecoveryInformation rec = DAA1.horizontalDirectionRecoveryInformation();
            trkband.recovery = rec.nFactor();
            trkband.timeToRecovery = rec.timeToRecovery();
-           trkband.minHDist = rec.recoveryHorizontalDistance("m");
-           trkband.minVDist = rec.recoveryVerticalDistance("m");
+           trkband.minHDist = rec.recoveryHorizontalDistance();
+           trkband.minVDist = rec.recoveryVerticalDistance();
        }
        
     }
@@ -438,16 +607,16 @@ bands_t DaidalusMonitor::GetSpeedBands(void) {
            larcfm::RecoveryInformation rec = DAA1.horizontalSpeedRecoveryInformation();
            band.recovery = rec.nFactor();
            band.timeToRecovery = rec.timeToRecovery();
-           band.minHDist = rec.recoveryHorizontalDistance("m");
-           band.minVDist = rec.recoveryVerticalDistance("m");
+           band.minHDist = rec.recoveryHorizontalDistance();
+           band.minVDist = rec.recoveryVerticalDistance();
        }
 
     }
     band.timeToViolation[0] = timeIntervalOfConflictLow;
     band.timeToViolation[1] = timeIntervalOfConflictHigh;
 
-    double speedMax = DAA1.getMaxHorizontalSpeed("m/s");
-    double speedMin = DAA1.getMinHorizontalSpeed("m/s");
+    double speedMax = DAA1.getMaxHorizontalSpeed();
+    double speedMin = DAA1.getMinHorizontalSpeed();
 
     band.resUp = DAA1.horizontalSpeedResolution(true);
     band.resDown = DAA1.horizontalSpeedResolution(false);
@@ -483,8 +652,8 @@ bands_t DaidalusMonitor::GetVerticalSpeedBands(void){
 	       larcfm::RecoveryInformation rec = DAA1.verticalSpeedRecoveryInformation();
            band.recovery = rec.nFactor();
            band.timeToRecovery = rec.timeToRecovery();
-           band.minHDist = rec.recoveryHorizontalDistance("m");
-           band.minVDist = rec.recoveryVerticalDistance("m");
+           band.minHDist = rec.recoveryHorizontalDistance();
+           band.minVDist = rec.recoveryVerticalDistance();
        }
 
     }
@@ -525,13 +694,13 @@ bands_t DaidalusMonitor::GetAltBands(void){
             larcfm::RecoveryInformation rec = DAA1.altitudeRecoveryInformation();
             band.recovery = rec.nFactor();
             band.timeToRecovery = rec.timeToRecovery();
-            band.minHDist = rec.recoveryHorizontalDistance("m");
-            band.minVDist = rec.recoveryVerticalDistance("m");
+            band.minHDist = rec.recoveryHorizontalDistance();
+            band.minVDist = rec.recoveryVerticalDistance();
         }
     }
 
-    double altMax = DAA1.getMaxAltitude("m");
-    double altMin = DAA1.getMinAltitude("m");
+    double altMax = DAA1.getMaxAltitude();
+    double altMin = DAA1.getMinAltitude();
 
     band.timeToViolation[0] = timeIntervalOfConflictLow;
     band.timeToViolation[1] = timeIntervalOfConflictHigh;
@@ -62,6 +62,21 @@ private:
     double DTHR;
     double timeIntervalOfConflictLow;
     double timeIntervalOfConflictHigh;
+
+    // Pre-filter removing far-field traffic before it is given to DAA1
+    bool prefilter;                 // traffic_prefilter: enable the pre-filter
+    double prefilterMargin;         // traffic_prefilter_margin [s]: added to the horizon, must exceed the monitoring period
+    bool prefilterSupported;        // false if a detector or alerting option is not covered by the bounds
+    double prefilterHorizon;        // [s] largest lookahead or alerting time, plus margin
+    double prefilterDist;           // [m] largest horizontal threshold (DTHR, D, recovery, NMAC)
+    double prefilterTime;           // [s] largest horizontal time threshold (TTHR)
+    double prefilterHeight;         // [m] largest vertical threshold (ZTHR, H, recovery, NMAC)
+    double prefilterVertTime;       // [s] largest vertical time threshold (TCOA)
+    std::map<std::string,std::pair<double,int>> prunableSince; // time and cycles since each intruder became prunable
+    int numPrunedTraffic;
+    void SetPrefilterBounds();
+    bool CannotConflict(const object& intruder);
+    bool PruneIntruder(const object& intruder);
 public:
 
     DaidalusMonitor(std::string callsign, std::string daaConfig);
@@ -70,6 +85,7 @@ public:
     bool CheckPositionFeasibility(const larcfm::Position pos,const double speed);
     void UpdateParameters(std::string daaParameters);
     int GetTrafficAlerts(int index,std::string& trafficID,int& alertLevel);
+    int GetNumPrunedTraffic(void);
     bands_t GetTrackBands(void);
     bands_t GetSpeedBands(void);
     bands_t GetAltBands(void);
@@ -0,0 +1,171 @@
+// Uses the Google unit test framework.
+
+// The traffic pre-filter of DaidalusMonitor (traffic_prefilter) removes intruders that cannot come
+// into conflict before they are given to DAIDALUS. A monitor with the pre-filter must compute the
+// same alerts and bands as a monitor without it, for traffic that converges after being pruned and
+// traffic that diverges after alerting.
+
+#include "DaidalusMonitor.hpp"
+#include "Position.h"
+#include "Velocity.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class DaidalusMonitorFilterTest : public ::testing::Test {
+
+public:
+  larcfm::Position own0;
+  larcfm::Velocity vo;
+  std::vector<object> traffic;
+  double sigma[6];
+
+protected:
+  virtual void SetUp() {
+    own0 = larcfm::Position::makeLatLonAlt(37.10,"deg",-76.38,"deg",50.0,"m");
+    vo = larcfm::Velocity::makeTrkGsVs(0.0,"deg",4.0,"m/s",0.0,"fpm");
+    for (int i = 0; i < 6; ++i) {
+      sigma[i] = 0.0;
+    }
+    // Converging head-on, pruned until it gets close, then diverging until it is pruned again
+    addTraffic("conv",600.0,0.0,50.0,180.0,4.0,0.0);
+    // Converging from the right, pruned until it gets close
+    addTraffic("cross",400.0,400.0,52.0,270.0,4.0,0.0);
+    // In loss of separation at the start, then diverging until it is pruned
+    addTraffic("div",3.0,2.0,50.0,120.0,4.0,0.0);
+    // Behind the ownship and diverging
+    addTraffic("tail",-40.0,0.0,50.0,180.0,3.0,0.0);
+    // Crossing overhead, above the altitudes the ownship can reach
+    addTraffic("above",200.0,0.0,400.0,180.0,4.0,0.0);
+    // Far away
+    addTraffic("far",3000.0,-3000.0,50.0,45.0,2.0,0.0);
+  }
+
+  // Intruder at dn meters north and de meters east of the ownship's initial position
+  void addTraffic(const std::string& id, double dn, double de, double alt, double trk, double gs, double vs) {
+    object obj;
+    obj.callsign = id;
+    obj.source = 0;
+    obj.id = static_cast<int>(traffic.size())+1;
+    obj.time = 0.0;
+    obj.position = own0.linearEst(dn,de).mkAlt(alt);
+    obj.velocity = larcfm::Velocity::makeTrkGsVs(trk,"deg",gs,"m/s",vs,"fpm");
+    for (int i = 0; i < 6; ++i) {
+      obj.posSigma[i] = 0.0;
+      obj.velSigma[i] = 0.0;
+    }
+    traffic.push_back(obj);
+  }
+
+  // Writes the test DAIDALUS configuration, with the monitor parameters, to a file
+  std::string writeConfig(const std::string& name, bool prefilter, const std::string& extra) {
+    std::ifstream in(std::string(TRAFFIC_MONITOR_TEST_DIR)+"/DaidalusQuadConfig.txt");
+    std::stringstream config;
+    config << in.rdbuf();
+    config << "record_daa_logs = false\n";
+    config << "traffic_source = 0\n";
+    config << "stale_threshold = 10 [s]\n";
+    config << "sensor_mapping = false\n";
+    config << "traffic_prefilter = " << (prefilter ? "true" : "false") << "\n";
+    config << "traffic_prefilter_margin = 5 [s]\n";
+    config << extra;
+    std::string filename = name+(prefilter ? "_on.txt" : "_off.txt");
+    std::ofstream out(filename.c_str());
+    out << config.str();
+    return filename;
+  }
+
+  // Runs both monitors for the given number of 1 s cycles, comparing their outputs at every cycle
+  void run(const std::string& name, const std::string& extra, const larcfm::Velocity& wind, int cycles) {
+    DaidalusMonitor off("Ownship",writeConfig(name,false,extra));
+    DaidalusMonitor on("Ownship",writeConfig(name,true,extra));
+    int pruned = 0;
+    int alerts = 0;
+    for (int c = 0; c < cycles; ++c) {
+      double t = c;
+      SCOPED_TRACE("time "+std::to_string(t));
+      for (int i = 0; i < static_cast<int>(traffic.size()); ++i) {
+        object obj = traffic[i];
+        obj.position = traffic[i].position.linear(traffic[i].velocity,t);
+        obj.time = t;
+        off.InputIntruderData(obj);
+        on.InputIntruderData(obj);
+      }
+      larcfm::Position own = own0.linear(vo,t);
+      off.InputOwnshipData(own,vo,t,sigma,sigma);
+      on.InputOwnshipData(own,vo,t,sigma,sigma);
+      off.MonitorTraffic(wind);
+      on.MonitorTraffic(wind);
+      EXPECT_EQ(0,off.GetNumPrunedTraffic());
+      pruned += on.GetNumPrunedTraffic();
+      alerts += expectSameAlerts(off,on);
+      expectSameBands(off.GetTrackBands(),on.GetTrackBands());
+      expectSameBands(off.GetSpeedBands(),on.GetSpeedBands());
+      expectSameBands(off.GetVerticalSpeedBands(),on.GetVerticalSpeedBands());
+      expectSameBands(off.GetAltBands(),on.GetAltBands());
+    }
+    // The encounters must exercise the pre-filter and the alerting logic
+    EXPECT_GT(pruned,0);
+    EXPECT_GT(alerts,0);
+  }
+
+  // Returns the number of alerting intruders
+  int expectSameAlerts(DaidalusMonitor& off, DaidalusMonitor& on) {
+    std::string id_off;
+    std::string id_on;
+    int alert_off = 0;
+    int alert_on = 0;
+    int n = off.GetTrafficAlerts(0,id_off,alert_off);
+    EXPECT_EQ(n,on.GetTrafficAlerts(0,id_on,alert_on));
+    int alerts = 0;
+    for (int i = 0; i < n; ++i) {
+      off.GetTrafficAlerts(i,id_off,alert_off);
+      on.GetTrafficAlerts(i,id_on,alert_on);
+      EXPECT_EQ(id_off,id_on);
+      EXPECT_EQ(alert_off,alert_on) << id_off;
+      if (alert_off > 0) {
+        ++alerts;
+      }
+    }
+    return alerts;
+  }
+
+  static bool same(double a, double b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+  }
+
+  void expectSameBands(const bands_t& off, const bands_t& on) {
+    ASSERT_EQ(off.numBands,on.numBands);
+    for (int i = 0; i < off.numBands; ++i) {
+      EXPECT_EQ(off.type[i],on.type[i]);
+      EXPECT_EQ(off.min[i],on.min[i]);
+      EXPECT_EQ(off.max[i],on.max[i]);
+    }
+    EXPECT_EQ(off.currentConflictBand,on.currentConflictBand);
+    EXPECT_EQ(off.recovery,on.recovery);
+    EXPECT_TRUE(same(off.timeToRecovery,on.timeToRecovery));
+    EXPECT_TRUE(same(off.timeToViolation[0],on.timeToViolation[0]));
+    EXPECT_TRUE(same(off.timeToViolation[1],on.timeToViolation[1]));
+    EXPECT_TRUE(same(off.resUp,on.resUp));
+    EXPECT_TRUE(same(off.resDown,on.resDown));
+    EXPECT_TRUE(same(off.resPreferred,on.resPreferred));
+  }
+};
+
+TEST_F(DaidalusMonitorFilterTest, testNoWind) {
+  run("filter_nowind","",larcfm::Velocity::makeTrkGsVs(0.0,"deg",0.0,"m/s",0.0,"fpm"),150);
+}
+
+TEST_F(DaidalusMonitorFilterTest, testWind) {
+  run("filter_wind","",larcfm::Velocity::makeTrkGsVs(250.0,"deg",2.0,"m/s",0.0,"fpm"),150);
+}
+
+TEST_F(DaidalusMonitorFilterTest, testHysteresis) {
+  run("filter_hysteresis",
+      "hysteresis_time = 5 [s]\npersistence_time = 3 [s]\nalerting_m = 2\nalerting_n = 3\n",
+      larcfm::Velocity::makeTrkGsVs(0.0,"deg",0.0,"m/s",0.0,"fpm"),150);
+}
@@ -17,8 +17,8 @@ int TrafficMonitor_InputIntruderData(void * obj, int source, int id, char* calls
                  source,
                  id,
                  time,
-                 larcfm::Position::makeLatLonAlt(pos[0],"degree",pos[1],"degree",pos[2],"m"),
-                 larcfm::Velocity::makeTrkGsVs(vel[0],"degree",vel[1],"m/s",vel[2],"m/s")};
+                 larcfm::Position::mkLatLonAlt(larcfm::Units::from(larcfm::unit::deg,pos[0]),larcfm::Units::from(larcfm::unit::deg,pos[1]),pos[2]),
+                 larcfm::Velocity::mkTrkGsVs(larcfm::Units::from(larcfm::unit::deg,vel[0]),vel[1],vel[2])};
     std::memcpy(tf.posSigma,sumPos,sizeof(double)*6);
     std::memcpy(tf.velSigma,sumVel,sizeof(double)*6);
     return monitor->InputIntruderData(tf); 
@@ -26,20 +26,20 @@ int TrafficMonitor_InputIntruderData(void * obj, int source, int id, char* calls
 
 void TrafficMonitor_InputOwnshipData(void * obj, double * position, double * velocity, double time,double sumPos[6],double sumVel[6]){
     TrafficMonitor* monitor = (TrafficMonitor*)obj;
-    larcfm::Position pos = larcfm::Position::makeLatLonAlt(position[0],"degree",position[1],"degree",position[2],"m");
-    larcfm::Velocity vel = larcfm::Velocity::makeTrkGsVs(velocity[0],"degree",velocity[1],"m/s",velocity[2],"m/s");
+    larcfm::Position pos = larcfm::Position::mkLatLonAlt(larcfm::Units::from(larcfm::unit::deg,position[0]),larcfm::Units::from(larcfm::unit::deg,position[1]),position[2]);
+    larcfm::Velocity vel = larcfm::Velocity::mkTrkGsVs(larcfm::Units::from(larcfm::unit::deg,velocity[0]),velocity[1],velocity[2]);
     monitor->InputOwnshipData(pos,vel,time,sumPos,sumVel);
 }
 
 void TrafficMonitor_MonitorTraffic(void* obj,double* windfrom){
-    larcfm::Velocity wind = larcfm::Velocity::makeTrkGsVs(windfrom[0]+180,"degree",windfrom[1],"m/s",0,"m/s");
+    larcfm::Velocity wind = larcfm::Velocity::mkTrkGsVs(larcfm::Units::from(larcfm::unit::deg,windfrom[0]+180),windfrom[1],0);
     TrafficMonitor* monitor = (TrafficMonitor*)obj;
     monitor->MonitorTraffic(wind);
 }
 
 bool TrafficMonitor_CheckPointFeasibility(void * obj, double * position,double speed){
     TrafficMonitor* monitor = (TrafficMonitor*)obj;
-    larcfm::Position pos = larcfm::Position::makeLatLonAlt(position[0],"degree",position[1],"degree",position[2],"m");
+    larcfm::Position pos = larcfm::Position::mkLatLonAlt(larcfm::Units::from(larcfm::unit::deg,position[0]),larcfm::Units::from(larcfm::unit::deg,position[1]),position[2]);
     return monitor->CheckPositionFeasibility(pos,speed);
 }
 
@@ -73,6 +73,11 @@ int TrafficMonitor_GetTrafficAlerts(void* obj,int id,char* calls,int* alert){
     return size;
 }
 
+int TrafficMonitor_GetNumPrunedTraffic(void* obj){
+    DaidalusMonitor* monitor = (DaidalusMonitor*)obj;
+    return monitor->GetNumPrunedTraffic();
+}
+
 void delDaidalusTrafficMonitor(void * obj){
     DaidalusMonitor* monitor = (DaidalusMonitor*)obj;
     delete(monitor);
@@ -20,6 +20,7 @@ void TrafficMonitor_GetSpeedBands(void *obj,bands_t*);
 void TrafficMonitor_GetAltBands(void *obj,bands_t*);
 void TrafficMonitor_GetVerticalSpeedBands(void *obj,bands_t*);
 int TrafficMonitor_GetTrafficAlerts(void* obj,int id,char* calls,int* alert);
+int TrafficMonitor_GetNumPrunedTraffic(void* obj);
 
 #ifdef __cplusplus
 }
@@ -28,6 +28,7 @@ void DubinsPlanner::SetBoundary(larcfm::Poly3D& bBox){
     auto origVertices = bBox.getVerticesRef();
     shrunkbbox = larcfm::PolycarpResolution::contract_polygon_2D(0.1,0.5,origVertices);
     boundingBox = larcfm::Poly3D(larcfm::Poly2D(shrunkbbox),bBox.getBottom(),bBox.getTop());
+    preparedBoundary = larcfm::CDPolycarp().prepare(boundingBox);
 }
 
 void DubinsPlanner::SetZBoundary(double zMin,double zMax){
@@ -55,6 +56,11 @@ void DubinsPlanner::SetTraffic(larcfm::Plan& fp){
 
 void DubinsPlanner::SetObstacles(std::list<larcfm::Poly3D> &obsList){
     obstacleList = obsList;
+    preparedObstacles.clear();
+    larcfm::CDPolycarp geoPolycarp;
+    for(auto &obs: obstacleList){
+        preparedObstacles.push_back(geoPolycarp.prepare(obs));
+    }
 }
 
 void DubinsPlanner::SetGoal(larcfm::Vect3& goal,larcfm::Velocity vel){
@@ -79,12 +85,11 @@ void DubinsPlanner::GetPotentialFixes(){
     potentialFixes.push_back(goal);
     int count =2; 
 
-    /// Use POLYCarp class for detecting obstacle violations
-    larcfm::CDPolycarp geoPolycarp;
-
     /// Get positons close to each obstacle vertex as a potential fix
+    /// Obstacle violations are detected with the polygons prepared for POLYCarp
     double turnRadius = rootVel.gs()/(params.turnRate);
-    for(auto &obs: obstacleList){
+    for(auto &prepObs: preparedObstacles){
+        const larcfm::Poly3D& obs = prepObs.poly3D();
         /// Expand each obstacle by 2.1 times the turn radius
         double exp = std::max(params.vertexBuffer,2.1*turnRadius);
         auto origVertices = obs.getVerticesRef();
@@ -126,7 +131,7 @@ void DubinsPlanner::GetPotentialFixes(){
                     gfix.pos = larcfm::Vect3(vert, gzh);
                     gfix.goal = false;
                     gfix.id = count;
-                    if (geoPolycarp.definitelyOutside(gfix.pos, obs) && geoPolycarp.definitelyInside(gfix.pos, boundingBox))
+                    if (prepObs.definitelyOutside(gfix.pos) && preparedBoundary.definitelyInside(gfix.pos))
                     {
                         potentialFixes.push_back(gfix);
                         count++;
@@ -140,7 +145,7 @@ void DubinsPlanner::GetPotentialFixes(){
                     if (fabs(szh - gzh) > 1)
                     {
                         sfix.pos = larcfm::Vect3(vert, szh);
-                        if (geoPolycarp.definitelyOutside(sfix.pos, obs) && geoPolycarp.definitelyInside(gfix.pos, boundingBox))
+                        if (prepObs.definitelyOutside(sfix.pos) && preparedBoundary.definitelyInside(gfix.pos))
                         {
                             potentialFixes.push_back(sfix);
                             count++;
@@ -839,17 +844,38 @@ bool DubinsPlanner::CheckTrafficConflict(double startTime,larcfm::Vect3 center1,
     return false;
 }
 
+bool DubinsPlanner::NearFence(const larcfm::PreparedPolygon& fence,const larcfm::Vect2& A,const larcfm::Vect2& B,double r){
+    /// LinePlanIntersection also reports a line nearly on an edge, within 2e-3/|edge| of it.
+    /// Expand the rectangle enough to cover that for the shortest edge.
+    double minEdge = MAXDOUBLE;
+    for (int i = 0; i < fence.size(); ++i){
+        double len = fence.edge(i).norm();
+        if (len > 0 && len < minEdge){
+            minEdge = len;
+        }
+    }
+    double margin = std::max(1.0, 2e-3/minEdge);
+    larcfm::BoundingRectangle rect;
+    rect.add(std::min(A.x,B.x) - r, std::min(A.y,B.y) - r);
+    rect.add(std::max(A.x,B.x) + r, std::max(A.y,B.y) + r);
+    return fence.getBoundingRectangle().intersects(rect, margin);
+}
+
 bool DubinsPlanner::CheckFenceConflict(tcpData_t trajectory){
     int trajSize = trajectory.size();
     bool conflict = false;
-    std::list<larcfm::Poly3D> obsList = obstacleList;
-    obsList.push_back(boundingBox);
-    for (auto &obs : obsList)
+    std::list<const larcfm::PreparedPolygon*> obsList;
+    for (auto &obs : preparedObstacles)
+    {
+        obsList.push_back(&obs);
+    }
+    obsList.push_back(&preparedBoundary);
+    for (auto obs : obsList)
     {
-        auto vertices = obs.getVerticesRef();
+        auto vertices = obs->poly3D().getVerticesRef();
         int totalVertices = vertices.size();
-        double floor = obs.getBottom();
-        double roof = obs.getTop();
+        double floor = obs->getBottom();
+        double roof = obs->getTop();
         for (int i = 1; i < trajSize; ++i)
         {
             auto trajpt1 = trajectory[i - 1];
@@ -864,7 +890,7 @@ bool DubinsPlanner::CheckFenceConflict(tcpData_t trajectory){
                 /// with fence vertices. Note: This is overly conservative
                 larcfm::Vect3 center = trajpt1.second.turnCenter().vect3();
                 double R = fabs(trajpt1.second.getRadiusSigned());
-                if (center.z >= floor && center.z <= roof)
+                if (center.z >= floor && center.z <= roof && NearFence(*obs, center.vect2(), center.vect2(), R))
                 {
                     for (int j = 0; j < totalVertices; ++j)
                     {
@@ -886,7 +912,7 @@ bool DubinsPlanner::CheckFenceConflict(tcpData_t trajectory){
                     }
                 }
             }
-            else
+            else if (NearFence(*obs, posA.vect2(), posB.vect2(), 0))
             {
                 /// For all other types of TCPs, find linear intersection
                 for (int j = 0; j < totalVertices; ++j)
@@ -907,7 +933,11 @@ bool DubinsPlanner::CheckFenceConflict(tcpData_t trajectory){
 }
 
 bool DubinsPlanner::CheckProjectedFenceConflict(node* qnode,node* goal){
-    for(auto &obs: obstacleList){
+    for(auto &prepObs: preparedObstacles){
+        if (!NearFence(prepObs, qnode->pos.vect2(), goal->pos.vect2(), 0)){
+            continue;
+        }
+        const larcfm::Poly3D& obs = prepObs.poly3D();
         int sizePoly = obs.size();
         for(int i=0;i<sizePoly;i++){
             int j = (i+1)%sizePoly;
@@ -922,6 +952,9 @@ bool DubinsPlanner::CheckProjectedFenceConflict(node* qnode,node* goal){
         }
     }
 
+    if (!NearFence(preparedBoundary, qnode->pos.vect2(), goal->pos.vect2(), 0)){
+        return false;
+    }
     int sizePoly = shrunkbbox.size();
     for(int i=0;i<sizePoly;++i){
             int j = (i+1)%sizePoly;
@@ -1191,26 +1224,24 @@ bool DubinsPlanner::CheckConflictLineCircle(larcfm::Vect3 center1, larcfm::Vect3
          return false;
      }
 
-     auto projTurn = [&] (double t) {
-       double startTrk = (start1-center1).vect2().trk();  
-       double turnDelta = turnRate*t;
-       double newTrk  = startTrk + turnDelta* (radius1>0?+1:-1);
-       double R = fabs(radius1);
-       larcfm::Vect3 newPoint = center1 + larcfm::Vect3::makeXYZ(R*sin(newTrk),"m",R*cos(newTrk),"m",center1.z,"m");
-       return newPoint;
-     };
-
-
-     // Check for conflicts by discretizing the turn into a finite number of points
-     
+     // Positions on the turn circle, sampled with the batched turn kernel
      double dT = (timeInterval1.y  - timeInterval1.x);
      int N = (int)fmax(dT,15);
      double dt = dT/N;
+     double dir = radius1>0?+1:-1;
+     double R = fabs(radius1);
+     double startTrk = (start1-center1).vect2().trk();
+     larcfm::Vect3 startPos = center1 + larcfm::Vect3::mkXYZ(R*sin(startTrk),R*cos(startTrk),0);
+     larcfm::Velocity startVel = larcfm::Velocity::mkTrkGsVs(startTrk+dir*M_PI/2,R*turnRate,0);
+     std::vector<larcfm::Vect3> posOnCircle;
+     std::vector<larcfm::Velocity> velOnCircle;
+     larcfm::Kinematics::turnOmega(startPos,startVel,0,dt,N+1,dir*turnRate,posOnCircle,velOnCircle);
+
+     // Check for conflicts by discretizing the turn into a finite number of points
      for(int i=0;i<=N;++i){
          double projectedTime = (timeInterval1.x  + dt*i);
-         larcfm::Vect3 posOnCircle = projTurn(projectedTime - timeInterval1.x);
          larcfm::Vect3 projTrafficPos = start2 + startVel2.Scal(projectedTime - t0);
-         if ( projTrafficPos.distanceH(posOnCircle) < params.wellClearDistH) return true;
+         if ( projTrafficPos.distanceH(posOnCircle[i]) < params.wellClearDistH) return true;
      }
      
 
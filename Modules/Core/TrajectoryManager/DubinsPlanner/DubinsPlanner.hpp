@@ -11,6 +11,7 @@
 #include "Position.h"
 #include "Velocity.h"
 #include "CDPolycarp.h"
+#include "PreparedPolygon.h"
 #include "Projection.h"
 #include "EuclideanProjection.h"
 #include "Plan.h"
@@ -59,6 +60,10 @@ private:
 
     std::list<larcfm::Poly3D> obstacleList; ///<  list of obstacles
 
+    larcfm::PreparedPolygon preparedBoundary; ///< boundingBox prepared for containment checks
+
+    std::list<larcfm::PreparedPolygon> preparedObstacles; ///< obstacles prepared for containment checks
+
     std::vector<node> potentialFixes; ///< feasible nodes
 
     int nodeCount; ///< Total node explored
@@ -342,6 +347,18 @@ private:
      */
     bool CheckProjectedFenceConflict(node* qnode,node* goal);
 
+    /**
+     * @brief Check if the rectangle spanned by points A and B, expanded by r, can reach an edge of a fence.
+     * If not, neither LinePlanIntersection nor a turn circle of radius r can intersect the fence.
+     * 
+     * @param fence prepared fence
+     * @param A corner of rectangle
+     * @param B opposite corner of rectangle
+     * @param r expansion
+     * @return false if no edge of fence can be reached
+     */
+    static bool NearFence(const larcfm::PreparedPolygon& fence,const larcfm::Vect2& A,const larcfm::Vect2& B,double r);
+
     /**
      * @brief Get parameters describing dubins curves between two nodes
      * 
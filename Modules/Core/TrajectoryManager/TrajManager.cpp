@@ -16,6 +16,7 @@
 #include "WP2Plan.hpp"
 #include "StateReader.h"
 #include "ParameterData.h"
+#include "ParameterKey.h"
 
 TrajManager::TrajManager(std::string callsign,std::string config) {
     char            fmt1[64];
@@ -28,27 +29,42 @@ TrajManager::TrajManager(std::string callsign,std::string config) {
     ReadParamFromFile(std::string(config));
 }
 
+// Parameter keys of the Dubins planner
+static const larcfm::ParameterKey MIN_HS("min_hs");
+static const larcfm::ParameterKey MAX_HS("max_hs");
+static const larcfm::ParameterKey TURN_RATE("turn_rate");
+static const larcfm::ParameterKey VERTICAL_ACCEL("vertical_accel");
+static const larcfm::ParameterKey HORIZONTAL_ACCEL("horizontal_accel");
+static const larcfm::ParameterKey MIN_VS("min_vs");
+static const larcfm::ParameterKey MAX_VS("max_vs");
+static const larcfm::ParameterKey OBSTACLE_BUFFER("obstacle_buffer");
+static const larcfm::ParameterKey DUBINS_WELLCLEAR_RADIUS("dubins_wellclear_radius");
+static const larcfm::ParameterKey DUBINS_WELLCLEAR_HEIGHT("dubins_wellclear_height");
+static const larcfm::ParameterKey CLIMB_SPEED("climb_speed");
+static const larcfm::ParameterKey MAX_ALT("max_alt");
+static const larcfm::ParameterKey ALT_BINS("alt_bins");
+
 void TrajManager::ReadParamFromFile(std::string config){
     larcfm::StateReader reader;
     larcfm::ParameterData parameters;
     reader.open(config);
     reader.updateParameterData(parameters);
     DubinsParams_t params;
-    params.minGS = parameters.getValue("min_hs");
-    params.maxGS = parameters.getValue("max_hs");
-    params.turnRate = parameters.getValue("turn_rate");
-    params.vAccel = parameters.getValue("vertical_accel");
-    params.hAccel = parameters.getValue("horizontal_accel");
+    params.minGS = parameters.getValue(MIN_HS);
+    params.maxGS = parameters.getValue(MAX_HS);
+    params.turnRate = parameters.getValue(TURN_RATE);
+    params.vAccel = parameters.getValue(VERTICAL_ACCEL);
+    params.hAccel = parameters.getValue(HORIZONTAL_ACCEL);
     params.hDaccel = -params.hAccel * 0.5;
     params.vDaccel = -params.vAccel * 0.5;
-    params.minVS = parameters.getValue("min_vs");
-    params.maxVS = parameters.getValue("max_vs");
-    params.vertexBuffer = parameters.getValue("obstacle_buffer");
-    params.wellClearDistH = parameters.getValue("dubins_wellclear_radius");
-    params.wellClearDistV = parameters.getValue("dubins_wellclear_height");
-    params.climbgs = parameters.getValue("climb_speed");
-    params.maxH = parameters.getValue("max_alt");
-    params.zSections = parameters.getValue("alt_bins");
+    params.minVS = parameters.getValue(MIN_VS);
+    params.maxVS = parameters.getValue(MAX_VS);
+    params.vertexBuffer = parameters.getValue(OBSTACLE_BUFFER);
+    params.wellClearDistH = parameters.getValue(DUBINS_WELLCLEAR_RADIUS);
+    params.wellClearDistV = parameters.getValue(DUBINS_WELLCLEAR_HEIGHT);
+    params.climbgs = parameters.getValue(CLIMB_SPEED);
+    params.maxH = parameters.getValue(MAX_ALT);
+    params.zSections = parameters.getValue(ALT_BINS);
     dbPlanner.SetParameters(params);
     wellClearDistH = params.wellClearDistH;
     wellClearDistV = params.wellClearDistV;
@@ -66,6 +82,7 @@ void TrajManager::InputGeofenceData(int type,int index, int totalVertices, doubl
     fence.fenceType = type;
     fence.id = index;
     fence.polygon = larcfm::SimplePoly::mk(vertices,floor,ceiling);
+    fence.path = larcfm::PolyPath(std::to_string(index), fence.polygon);
     fenceList.push_back(fence);
 }
 
@@ -74,6 +91,7 @@ void TrajManager::InputGeofenceData(int type,int index, int totalVertices, doubl
     fence.fenceType = type;
     fence.id = index;
     fence.polygon = larcfm::SimplePoly::mk(vertices,floor,ceiling);
+    fence.path = larcfm::PolyPath(std::to_string(index), fence.polygon);
     fenceList.push_back(fence);
 }
 
@@ -82,6 +100,16 @@ void TrajManager::ClearFences() {
     fenceList.clear();
 }
 
+const larcfm::PreparedPolygon& TrajManager::GetPreparedFence(fenceObject& gf, const larcfm::EuclideanProjection& proj){
+    larcfm::LatLonAlt origin = proj.getProjectionPoint();
+    if (gf.prepared.size() == 0 || !gf.preparedOrigin.equals(origin)) {
+        larcfm::CDPolycarp geoPolycarp(0.01, 0.001, false);
+        gf.prepared = geoPolycarp.prepare(gf.polygon, proj);
+        gf.preparedOrigin = origin;
+    }
+    return gf.prepared;
+}
+
 int TrajManager::InputTraffic(std::string callsign, larcfm::Position &position, larcfm::Velocity &velocity,double time) {
  
     pObject obj = {.callsign = callsign, 
@@ -253,10 +281,10 @@ void TrajManager::InputFlightPlan(const std::string &plan_id, const std::list<wa
     larcfm::Plan newPlan(plan_id); 
     if (fp != NULL){
         fp->clear();
-        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate);
+        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate,&kinematicPlans[plan_id]);
     }else{
         fp = &newPlan;
-        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate);
+        ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,repairTurnRate,&kinematicPlans[plan_id]);
         flightPlans.push_back(newPlan);
     }
     if(plan_id == "Plan0"){
@@ -341,6 +369,7 @@ void TrajManager::CombinePlan(std::string planA,std::string planB,int index){
 
 void TrajManager::ClearAllPlans() {
     flightPlans.clear();
+    kinematicPlans.clear();
     ClearFences(); 
 }
 
@@ -497,18 +526,17 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
         {
             /// Keep in fence checks
             larcfm::Vect3 locpos = projection.project(pos);
-            larcfm::CDPolycarp geoPolycarp(0.01, 0.001, false);
+            const larcfm::PreparedPolygon& localPoly = GetPreparedFence(gf, projection);
 
             /// - Check fence conflict with current position
             if (gf.fenceType == fenceObject::FENCE_TYPE::KEEP_IN)
             {
-                larcfm::Poly3D localPoly = gf.polygon.poly3D(projection);
-                bool conflict = geoPolycarp.definitelyOutside(locpos, localPoly);
+                bool conflict = localPoly.definitelyOutside(locpos);
                 if (conflict)
                     gfTimes.push_back(0.0);
                 /// - Check for projected fence conflict based on flightplan
                 double eps = 0.5; // a small additional delta to add to the output. 
-                double t = FindTimeToFenceViolation(localPoly, locpos, vel) + eps;
+                double t = FindTimeToFenceViolation(localPoly.poly3D(), locpos, vel) + eps;
                 int seg = fp->getSegment(correctedtime + t);
                 if (seg < 0)
                 {
@@ -518,8 +546,8 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
                 larcfm::Position posOnPlan = fp->posVelWithinSeg(seg, t + correctedtime, fp->isLinear(), fp->gsOut(seg)).first;
                 larcfm::Vect3 qPos = projection.project(posOnPlan);
                 /// - If projected point on plan is outside fence, we have a real problem.
-                bool projConflict = geoPolycarp.definitelyOutside(qPos, localPoly);
-                projConflict |= geoPolycarp.nearEdge(qPos, localPoly, 2, 2);
+                bool projConflict = localPoly.definitelyOutside(qPos);
+                projConflict |= localPoly.nearEdge(qPos, 2, 2);
                 if (projConflict)
                 {
                     conflict |= true;
@@ -531,13 +559,12 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
             {
                 /// Keep out fence conflict
                 /// - Check conflict based on current position
-                bool conflict = geoPolycarp.definitelyInside(locpos, gf.polygon.poly3D(projection));
+                bool conflict = localPoly.definitelyInside(locpos);
                 if (conflict)
                     gfTimes.push_back(0.0);
                 /// - Check for projected fence conflict based on flightplan
                 larcfm::CDIIPolygon cdiipolygon;
-                larcfm::PolyPath objpath(std::to_string(gf.id), gf.polygon);
-                bool pathConflict = cdiipolygon.detection(*fp, objpath, correctedtime, fp->getLastTime());
+                bool pathConflict = cdiipolygon.detection(*fp, gf.path, correctedtime, fp->getLastTime());
                 conflict |= pathConflict;
 
                 int n = cdiipolygon.size();
@@ -556,15 +583,20 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
         }
 
         /// Check for projected traffic conflict based on traffic flightplans
-        for (auto &tp : trafficPlans)
+        if (!trafficPlans.empty())
         {
             larcfm::CDII cdii = larcfm::CDII::make(wellClearDistH, "m", wellClearDistV, "m");
-            cdii.detection(*fp, tp, time, fp->getLastTime());
-            int n = cdii.size();
-            if (n > 0)
+            std::vector<larcfm::Plan> plans(trafficPlans.begin(), trafficPlans.end());
+            std::vector<larcfm::CDII> results;
+            // One thread: this runs inside the flight software task, which must not spawn threads
+            cdii.detection(*fp, plans, time, fp->getLastTime(), results, 1);
+            for (auto &res : results)
             {
-                tfTimes.push_back(cdii.getTimeIn(0) - correctedtime);
-                trafficConflict = true;
+                if (res.size() > 0)
+                {
+                    tfTimes.push_back(res.getTimeIn(0) - correctedtime);
+                    trafficConflict = true;
+                }
             }
         }
 
@@ -597,25 +629,8 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
     /// Check for next feasible waypoint in the main plan
     fp = GetPlan("Plan0");
     int findex = nextWP1;
-    auto CheckWPFeasibility = [&](int index) {
-        larcfm::Vect3 locpos = projection.project(fp->getPos(index));
-        bool conflict = false;
-        for (auto &gf : fenceList)
-        {
-            larcfm::CDPolycarp geoPolycarp(0.01, 0.001, false);
-            // Check fence conflict with waypoint
-            if (gf.fenceType == fenceObject::FENCE_TYPE::KEEP_IN)
-            {
-                conflict |= geoPolycarp.definitelyOutside(locpos, gf.polygon.poly3D(projection));
-            }
-            else
-            {
-                conflict |= geoPolycarp.definitelyInside(locpos, gf.polygon.poly3D(projection));
-            }
-        }
-        return conflict;
-    };
     int maxwp = fp->size();
+    std::vector<int> candidates;
     for (; findex < maxwp; ++findex)
     {
         /// - Check if next wp is before the conflict time
@@ -648,10 +663,43 @@ trajectoryMonitorData_t TrajManager::MonitorTrajectory(double time, std::string
             continue;
         }
 
-        /// - Check fence feasibility
-        bool conflict = CheckWPFeasibility(findex);
-        if (!conflict)
+        candidates.push_back(findex);
+    }
+
+    /// - Check fence feasibility of all candidates, each fence is projected and prepared once
+    std::vector<larcfm::Position> candidatePos;
+    candidatePos.reserve(candidates.size());
+    for (int index : candidates)
+    {
+        candidatePos.push_back(fp->getPos(index));
+    }
+    std::vector<larcfm::Vect3> locpos;
+    projection.project(candidatePos, locpos);
+    std::vector<bool> conflict(candidates.size(), false);
+    std::vector<bool> fenceConflicts;
+    for (auto &gf : fenceList)
+    {
+        const larcfm::PreparedPolygon& poly = GetPreparedFence(gf, projection);
+        // Check fence conflict with waypoint
+        if (gf.fenceType == fenceObject::FENCE_TYPE::KEEP_IN)
+        {
+            poly.definitelyOutside(locpos, fenceConflicts);
+        }
+        else
+        {
+            poly.definitelyInside(locpos, fenceConflicts);
+        }
+        for (int i = 0; i < (int) candidates.size(); ++i)
+        {
+            conflict[i] = conflict[i] || fenceConflicts[i];
+        }
+    }
+    findex = maxwp;
+    for (int i = 0; i < (int) candidates.size(); ++i)
+    {
+        if (!conflict[i])
         {
+            findex = candidates[i];
             break;
         }
     }
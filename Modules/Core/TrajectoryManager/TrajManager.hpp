@@ -10,11 +10,14 @@
 #include "CDSI.h"
 #include "CDIIPolygon.h"
 #include "CDPolycarp.h"
+#include "PreparedPolygon.h"
+#include "PolyPath.h"
 #include "PolycarpDetection.h"
 #include "Projection.h"
 #include "EuclideanProjection.h"
 #include "DubinsPlanner.hpp"
 #include "Interfaces.h"
+#include "WP2Plan.hpp"
 #include <list>
 #include <map>
 
@@ -39,6 +42,9 @@ typedef struct{
     int fenceType;                       ///< fence type
     int id;                              ///< fence index
     larcfm::SimplePoly polygon;          ///< polygon
+    larcfm::PolyPath path;               ///< polygon as a static path for CDIIPolygon
+    larcfm::LatLonAlt preparedOrigin;    ///< projection origin of prepared
+    larcfm::PreparedPolygon prepared;    ///< polygon projected at preparedOrigin, prepared for containment checks
 }fenceObject;
 
 /**
@@ -54,6 +60,7 @@ private:
     int numPlans;                                ///< number of plans
     std::ofstream log;                           ///< log holder
     std::list<larcfm::Plan> flightPlans;         ///< list of plans
+    std::map<std::string,kinematicPlanCache_t> kinematicPlans; ///< linear and kinematic plans last generated for each plan id
     std::list<larcfm::Plan> trafficPlans;        ///< list of plans for traffic vehicles (intent information)
     std::list<fenceObject> fenceList;            ///< list of fences
     std::map<std::string,pObject> trafficList;   ///< list of traffic
@@ -66,6 +73,16 @@ private:
      */
     int64_t FindDubinsPath(std::string planID);
 
+    /**
+     * @brief Get a fence projected with proj and prepared for containment checks.
+     * The prepared polygon is kept with the fence and only recomputed when the projection changes.
+     *
+     * @param gf fence
+     * @param proj projection
+     * @return const larcfm::PreparedPolygon& prepared polygon
+     */
+    const larcfm::PreparedPolygon& GetPreparedFence(fenceObject& gf, const larcfm::EuclideanProjection& proj);
+
     /**
      * @brief Function to compute projected time to violation to all fence edges
      * 
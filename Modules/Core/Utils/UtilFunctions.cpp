@@ -356,6 +356,10 @@ void ComputeWaypointsETA(double scenarioTime,int numWP, double wpSpeed[], waypoi
 }
 
 void ConvertWPList2Plan(larcfm::Plan* fp,const std::string &plan_id, const std::list<waypoint_t> &waypoints, const double initHeading,bool repair,double turnRate){
+   ConvertWPList2Plan(fp,plan_id,waypoints,initHeading,repair,turnRate,nullptr);
+}
+
+void ConvertWPList2Plan(larcfm::Plan* fp,const std::string &plan_id, const std::list<waypoint_t> &waypoints, const double initHeading,bool repair,double turnRate,kinematicPlanCache_t* cache){
    int count = 0;
    for(auto waypt: waypoints){
        double eta = waypt.time;
@@ -414,8 +418,23 @@ void ConvertWPList2Plan(larcfm::Plan* fp,const std::string &plan_id, const std::
    if(repair){
        double speed = fp->gsOut(1);
        double bankAngle = larcfm::Kinematics::bankAngle(speed,turnRate*M_PI/180);
-       double turnRadius= larcfm::Kinematics::turnRadius(speed,bankAngle);
-       *fp = larcfm::TrajGen::makeKinematicPlan(*fp,bankAngle,2,1.47,true,true,true);
+       if(cache == nullptr){
+           *fp = larcfm::TrajGen::makeKinematicPlan(*fp,bankAngle,2,1.47,true,true,true);
+           return;
+       }
+       /// Only the waypoints that differ from the previous plan need to be regenerated
+       /// when the turn bank angle is the same
+       larcfm::Plan linear = *fp;
+       if(cache->linear.size() > 0 && cache->bankAngle == bankAngle){
+           larcfm::TrajGen::updateKinematicPlan(cache->kinematic,cache->linear,linear,bankAngle,2,1.47,true,true,true);
+       }else{
+           cache->kinematic = larcfm::TrajGen::makeKinematicPlan(linear,bankAngle,2,1.47,true,true,true);
+       }
+       cache->linear = linear;
+       cache->bankAngle = bankAngle;
+       *fp = cache->kinematic;
+   }else if(cache != nullptr){
+       cache->linear.clear();
    }
 }
 
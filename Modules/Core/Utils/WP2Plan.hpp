@@ -8,8 +8,18 @@
 #include "Interfaces.h"
 typedef std::vector<std::vector<std::function<double(double)>>> trajTimeFunction;
 
+/// Linear plan and the kinematic plan generated from it by the last repaired conversion,
+/// used to regenerate only the edited waypoints of the next one
+typedef struct{
+    larcfm::Plan linear;
+    larcfm::Plan kinematic;
+    double bankAngle;
+}kinematicPlanCache_t;
+
 void ConvertWPList2Plan(larcfm::Plan* fp,const std::string &plan_id, const std::list<waypoint_t> &waypoints, 
                         const double initHeading,bool repair,double repairTurnRate);
+void ConvertWPList2Plan(larcfm::Plan* fp,const std::string &plan_id, const std::list<waypoint_t> &waypoints, 
+                        const double initHeading,bool repair,double repairTurnRate,kinematicPlanCache_t* cache);
 void GetWaypointFromPlan(const larcfm::Plan* fp,const int id,waypoint_t &wp);
 trajTimeFunction ConvertEUTL2TimeFunction(const larcfm::Plan* fp);
 #endif
\ No newline at end of file
@@ -122,6 +122,14 @@ Poly3D* fence::GetPoly3D(){
 	return &geoPoly3D;
 }
 
+void fence::PreparePoly3D(const CDPolycarp& detector){
+	geoPrepared = detector.prepare(geoPoly3D);
+}
+
+PreparedPolygon* fence::GetPreparedPoly3D(){
+	return &geoPrepared;
+}
+
 PolyPath* fence::GetPolyPath() {
     return &geoPolyPath;
 }
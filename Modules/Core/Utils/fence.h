@@ -54,6 +54,7 @@ enum FENCE_TYPE {KEEP_IN = 0,KEEP_OUT = 1};
 #include "PolyPath.h"
 #include "Poly3D.h"
 #include "CDPolycarp.h"
+#include "PreparedPolygon.h"
 #include "CDIIPolygon.h"
 #include "PolycarpDetection.h"
 #include "PolycarpResolution.h"
@@ -81,6 +82,7 @@ private:
 	SimplePoly geoPoly0;          // Original polygon in lat,lon
 	SimplePoly geoPoly1;          // Expanded/Contracted polygon in lat,lon
 	Poly3D geoPoly3D;             // 3D polygon in cartesian coordinates
+	PreparedPolygon geoPrepared;  // geoPoly3D prepared for containment checks
 	CDPolycarp geoPolyCarp;
 	PolycarpResolution geoPolyResolution;
 	PolycarpDetection geoPolyDetect;
@@ -100,6 +102,8 @@ public:
 	int16_t GetID();
 	uint16_t GetSize();
 	Poly3D* GetPoly3D();
+	void PreparePoly3D(const CDPolycarp& detector);
+	PreparedPolygon* GetPreparedPoly3D();
 	Position GetRecoveryPoint();
 	bool GetConflictStatus();
 	bool GetProjectedStatus();
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import csv
+import time
+import itertools
+import argparse
+import multiprocessing as mp
+import numpy as np
+
+from icutils.ichelper import GetHomePosition, ReadTrafficInput
+
+# Runs change their working directory, keep pycarous importable
+file_location = os.path.dirname(os.path.abspath(__file__))
+if file_location not in sys.path:
+    sys.path.insert(0, file_location)
+
+# Columns of the aggregated results file (one row per scenario)
+RESULT_COLUMNS = ["run", "seed", "windFrom", "windSpeed", "sigmaP", "sigmaV",
+                  "params", "status", "simTime", "wallTime", "numTraffic",
+                  "minHorizontalSep", "minVerticalSep", "min3dSep",
+                  "alerts", "cycles", "meanCycleTime", "maxCycleTime",
+                  "p99CycleTime"]
+
+# Matrix keys that are interpreted by the batch runner. Every other
+# key in the matrix is treated as an ICAROUS parameter sweep.
+SCENARIO_KEYS = ["seed", "wind", "sigmaP", "sigmaV"]
+
+
+def ReadBatchInput(filename):
+    """
+    Read a batch description from a yaml file. See README.md for an example
+    :param filename: yaml file describing the base scenario and the scenario matrix
+    """
+    import yaml
+    with open(filename, mode='r') as f:
+        batch = yaml.load(f, yaml.Loader)
+    base = os.path.dirname(os.path.abspath(filename))
+    for key in ["flightplan", "traffic", "params", "geofence"]:
+        if batch.get(key):
+            path = batch[key]
+            if not os.path.isabs(path) and not os.path.exists(path):
+                path = os.path.join(base, path)
+            batch[key] = os.path.abspath(path)
+    return batch
+
+
+def ExpandScenarioMatrix(matrix):
+    """
+    Expand a scenario matrix into a list of scenarios (cartesian product)
+    :param matrix: dict of key -> list of values to sweep, or a list of
+    such dicts whose expansions are concatenated
+    :return: list of dicts containing one value per key
+    """
+    if not matrix:
+        return [{}]
+    if isinstance(matrix, list):
+        return [sc for row in matrix for sc in ExpandScenarioMatrix(row)]
+    keys = list(matrix.keys())
+    values = [v if isinstance(v, list) else [v] for v in matrix.values()]
+    return [dict(zip(keys, combo)) for combo in itertools.product(*values)]
+
+
+def PerturbTraffic(tfinputs, seed, sigmas):
+    """
+    Randomize intruder initial conditions for a given traffic seed
+    :param tfinputs: list of intruder inputs (see data/traffic.yaml)
+    :param seed: seed for random generator (None leaves the traffic unchanged)
+    :param sigmas: std deviations for [range, bearing, altitude, speed, heading, climbrate]
+    """
+    if seed is None:
+        return tfinputs
+    rng = np.random.RandomState(seed)
+    perturbed = []
+    for tf in tfinputs:
+        tf = list(tf)
+        noise = rng.normal(0, 1, 6)*np.array(sigmas)
+        for i in range(6):
+            tf[i+1] = float(tf[i+1] + noise[i])
+        tf[1] = max(tf[1], 0.0)
+        tf[4] = max(tf[4], 0.0)
+        perturbed.append(tf)
+    return perturbed
+
+
+def RunScenario(job):
+    """
+    Run a single pycarous scenario in its own working directory and return
+    aggregated metrics. Executed inside a worker process.
+    :param job: tuple (run index, batch description, scenario dict, output directory)
+    """
+    run, batch, scenario, outdir = job
+
+    # Isolate log/ outputs of every run
+    rundir = os.path.join(outdir, "run-%05d" % run)
+    os.makedirs(os.path.join(rundir, "log"), exist_ok=True)
+    os.chdir(rundir)
+
+    seed = scenario.get("seed", None)
+    windFrom, windSpeed = scenario.get("wind", [0.0, 0.0])
+    sigmaP = scenario.get("sigmaP", None)
+    sigmaV = scenario.get("sigmaV", None)
+    params = {k: v for k, v in scenario.items() if k not in SCENARIO_KEYS}
+
+    result = {"run": run, "seed": -1 if seed is None else seed,
+              "windFrom": windFrom, "windSpeed": windSpeed,
+              "sigmaP": np.nan if sigmaP is None else sigmaP,
+              "sigmaV": np.nan if sigmaV is None else sigmaV,
+              "params": ";".join("%s=%s" % (k, v) for k, v in params.items()),
+              "status": "ok", "simTime": 0.0, "wallTime": 0.0, "numTraffic": 0,
+              "minHorizontalSep": np.inf, "minVerticalSep": np.inf, "min3dSep": np.inf,
+              "alerts": 0, "cycles": 0, "meanCycleTime": np.nan,
+              "maxCycleTime": np.nan, "p99CycleTime": np.nan}
+
+    wallStart = time.time()
+    try:
+        from SimEnvironment import SimEnvironment
+        from Icarous import Icarous
+
+        verbose = batch.get("verbosity", 0)
+        sim = SimEnvironment(fasttime=True, verbose=verbose)
+        sim.AddWind([(windFrom, windSpeed)])
+        HomePos = GetHomePosition(batch["flightplan"])
+
+        if batch.get("traffic"):
+            tfinputs = PerturbTraffic(ReadTrafficInput(batch["traffic"]), seed,
+                                      batch.get("trafficSigma", [10, 5, 1, 0.2, 5, 0]))
+            for tf in tfinputs:
+                sigP = tf[9:15] if len(tf) > 9 else []
+                sigV = tf[15:] if len(tf) > 9 else []
+                if sigmaP is not None:
+                    sigP = [sigmaP, sigmaP, sigmaP, 0.0, 0.0, 0.0]
+                if sigmaV is not None:
+                    sigV = [sigmaV, sigmaV, sigmaV, 0.0, 0.0, 0.0]
+                # AddTraffic applies both sigmas when either one is given
+                if sigP or sigV:
+                    sigP = sigP or [0.0]*6
+                    sigV = sigV or [0.0]*6
+                sim.AddTraffic(tf[0], HomePos, *tf[1:7], delay=tf[7], transmitter=tf[8],
+                               sigmaP=sigP, sigmaV=sigV)
+
+        ic = Icarous(HomePos, simtype=batch.get("simtype", "UAS_ROTOR"),
+                     monitor=batch.get("daaType", "DAIDALUS"), verbose=verbose,
+                     daaConfig=batch.get("daaConfig", batch["params"]),
+                     icConfig=batch["params"], fasttime=True)
+        ic.SetParameters(params)
+        ic.InputFlightplanFromFile(batch["flightplan"], eta=batch.get("eta", False),
+                                   repair=batch.get("repair", False))
+        if batch.get("geofence"):
+            ic.InputGeofence(batch["geofence"])
+        if sigmaP is not None:
+            ic.SetPosUncertainty(sigmaP, sigmaP, 0, 0, 0, 0)
+        if sigmaV is not None:
+            ic.SetVelUncertainty(sigmaV, sigmaV, 0, 0, 0, 0)
+        sim.AddIcarousInstance(ic, time_limit=batch.get("tlimit", 300))
+
+        # Instrument the Icarous cycle to collect metrics as the sim runs
+        cycleTimes = []
+        conflictTraffic = set()
+        icRun = ic.Run
+        def InstrumentedRun():
+            t0 = time.perf_counter()
+            status = icRun()
+            cycleTimes.append(time.perf_counter() - t0)
+            if not ic.missionStarted:
+                return status
+            opos = ic.localPos
+            for tf in sim.tfList:
+                tpos = tf.GetOutputPositionNED()
+                dh = np.hypot(opos[0] - tpos[0], opos[1] - tpos[1])
+                dv = abs(opos[2] - tpos[2])
+                result["minHorizontalSep"] = min(result["minHorizontalSep"], dh)
+                result["minVerticalSep"] = min(result["minVerticalSep"], dv)
+                result["min3dSep"] = min(result["min3dSep"], np.hypot(dh, dv))
+            if ic.trkband is not None:
+                current = set(ic.trkband['traffic'])
+                result["alerts"] += len(current - conflictTraffic)
+                conflictTraffic.clear()
+                conflictTraffic.update(current)
+            return status
+        ic.Run = InstrumentedRun
+
+        sim.RunSimulation()
+        if batch.get("writeLogs", False):
+            sim.WriteLog()
+
+        result["simTime"] = sim.current_time - sim.t0
+        result["numTraffic"] = len(sim.tfList)
+        if cycleTimes:
+            cycles = np.array(cycleTimes)
+            result["cycles"] = len(cycles)
+            result["meanCycleTime"] = float(np.mean(cycles))
+            result["maxCycleTime"] = float(np.max(cycles))
+            result["p99CycleTime"] = float(np.percentile(cycles, 99))
+    except Exception as e:
+        result["status"] = "error: %s" % str(e).replace(",", ";")
+
+    result["wallTime"] = time.time() - wallStart
+    return result
+
+
+def WriteColumnarResults(filename, rows):
+    """
+    Write results as one array per column (numpy .npz)
+    :param filename: output file
+    :param rows: list of result dicts
+    """
+    rows = sorted(rows, key=lambda r: r["run"])
+    columns = {}
+    for col in RESULT_COLUMNS:
+        values = [r[col] for r in rows]
+        if all(isinstance(v, str) for v in values):
+            columns[col] = np.array(values, dtype=str)
+        else:
+            columns[col] = np.array(values, dtype=np.float64)
+    np.savez_compressed(filename, **columns)
+
+
+def LoadResults(filename):
+    """ Load a columnar results file written by the batch runner """
+    with np.load(filename) as data:
+        return {k: data[k] for k in data.files}
+
+
+def RunBatch(batch, outdir, workers=None, verbose=1):
+    """
+    Run all scenarios of a batch concurrently
+    :param batch: batch description (see ReadBatchInput)
+    :param outdir: output directory, each run writes its logs into outdir/run-XXXXX/log
+    :param workers: number of worker processes (default: number of cores)
+    :return: list of result dicts, ordered by run index
+    """
+    outdir = os.path.abspath(outdir)
+    os.makedirs(outdir, exist_ok=True)
+    scenarios = ExpandScenarioMatrix(batch.get("matrix", {}))
+    jobs = [(i, batch, sc, outdir) for i, sc in enumerate(scenarios)]
+    workers = workers or mp.cpu_count()
+
+    if verbose > 0:
+        print("Running %d scenarios on %d workers" % (len(jobs), workers))
+
+    rows = []
+    csvname = os.path.join(outdir, "results.csv")
+    # Workers are recycled after every run so the C++ modules start
+    # from a clean state and log files of different runs never mix
+    with open(csvname, 'w', newline='') as fcsv, \
+         mp.Pool(workers, maxtasksperchild=1) as pool:
+        writer = csv.DictWriter(fcsv, fieldnames=RESULT_COLUMNS)
+        writer.writeheader()
+        for result in pool.imap_unordered(RunScenario, jobs):
+            writer.writerow(result)
+            fcsv.flush()
+            rows.append(result)
+            if verbose > 0:
+                print("[%d/%d] run %d: %s, min sep %.1f m, alerts %d" %
+                      (len(rows), len(jobs), result["run"], result["status"],
+                       result["min3dSep"], result["alerts"]))
+
+    WriteColumnarResults(os.path.join(outdir, "results.npz"), rows)
+    return sorted(rows, key=lambda r: r["run"])
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=\
+    " Run a Monte Carlo batch of pycarous fast time simulations.\n\
+  - The scenario matrix is described in a yaml file (see README.md).\n\
+  - Each run writes its logs to OUTPUT/run-XXXXX/log.\n\
+  - Aggregated metrics are streamed to OUTPUT/results.csv and\n\
+    written as columns to OUTPUT/results.npz.",
+                        formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("batch", type=str, help='batch description yaml file')
+    parser.add_argument("-o", "--output", type=str, default='batch_output',
+                       help='output directory. default: batch_output')
+    parser.add_argument("-j", "--jobs", type=int, default=None,
+                       help='number of worker processes. default: number of cores')
+    parser.add_argument("-v", "--verbosity", type=int, choices=[0,1,2], default=1,
+                       help='Set print verbosity level')
+    args = parser.parse_args()
+
+    RunBatch(ReadBatchInput(args.batch), args.output, args.jobs, args.verbosity)
@@ -21,6 +21,7 @@
 #define MAX_GEOFENCES 50
 #define MAX_CALLSIGN_LEN 17
 #define MAX_DATABUFFER_SIZE 10000
+#define MAX_TRAFFIC_BATCH 32
 #define MAX_DATABUFFER_SIZE 10000
 
 #define DEF_MSG(NAME,SIZE) typedef struct __attribute__((__packed__)){ CCSDS_PriHdr_t hdr; char databuffer[SIZE]; }NAME;
@@ -166,6 +167,36 @@ typedef struct{
     double sigmaV[6];                         /**< velocity covariance */
 }object_t;
 
+/**
+ * @struct object_state_t
+ * @brief state of a single object in a batch (object_t without cFS header)
+ *
+ */
+typedef struct{
+    uint8_t type;                             /**< object type: see object_type_t */
+    uint32_t index;                           /**< id of object */
+    callsign_t callsign;                      /**< call sign */
+    double latitude;                          /**< latitude (degrees) */
+    double longitude;                         /**< longitude (degrees) */
+    double altitude;                          /**< altitude (degrees) */
+    double ve;                                /**< velocity East component */
+    double vn;                                /**< velocity North component */
+    double vd;                                /**< velocity Down component */
+    double sigmaP[6];                         /**< position covariance */
+    double sigmaV[6];                         /**< velocity covariance */
+}object_state_t;
+
+/**
+ * @struct object_batch_t
+ * @brief message carrying the states of several objects (e.g. all reports decoded from one ADS-B receiver read)
+ *
+ */
+typedef struct{
+    uint8_t TlmHeader[CFE_SB_TLM_HDR_SIZE];   /**< cFS header information */
+    uint16_t numObjects;                      /**< number of valid entries in objects */
+    object_state_t objects[MAX_TRAFFIC_BATCH];/**< object states, oldest first */
+}object_batch_t;
+
 /**
  * @struct position_t
  * @brief position information of aircraft.
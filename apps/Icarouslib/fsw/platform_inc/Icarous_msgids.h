@@ -36,6 +36,11 @@
 #define ICAROUS_HOME_POSITION_MID 0x0828  ///< Home position message id
 #define ICAROUS_WPREACHED_EXTERNAL_MID 0x0829      ///< Waypoint reached. message type: missionItemReached_t
 #define ICAROUS_PARAMUPDATE_MID 0x0830      ///< Waypoint reached. message type: missionItemReached_t
+#define ICAROUS_AP_PORT_WAKEUP_MID 0x0831    ///< Data available on the autopilot port. message type: portWakeup_t
+#define ICAROUS_GS_PORT_WAKEUP_MID 0x0832    ///< Data available on the ground station port. message type: portWakeup_t
+#define ICAROUS_FLARM_PORT_WAKEUP_MID 0x0833 ///< Data available on the FLARM port. message type: portWakeup_t
+#define ICAROUS_APINTF_PORT_WAKEUP_MID 0x0834 ///< Data available on the apInterface autopilot port. message type: portWakeup_t
+#define ICAROUS_TRAFFIC_BATCH_MID 0x0835  ///< Batch of traffic information. message type: object_batch_t
 /**@}*/
 #define SendSBMsg(msg)\
 CFE_SB_TimeStampMsg((CFE_SB_Msg_t * ) &msg); \
@@ -31,6 +31,14 @@ void APINTERFACE_AppMain(void){
 			MsgId = CFE_SB_GetMsgId(appdataApIntf.Sch_MsgPtr);
 			switch (MsgId) {
 
+				case ICAROUS_APINTF_PORT_WAKEUP_MID:
+				    // Data is available on the autopilot port. readPort re-arms
+				    // the reactor for this port.
+				    if (readPort(&appdataApIntf.ap) > 0) {
+				        //TODO: Decode the autopilot data in appdataApIntf.ap.recvbuffer
+				    }
+					break;
+
 				case FREQ_50_WAKEUP_MID:
 					break;
 
@@ -95,6 +103,9 @@ void APINTERFACE_AppInit(void){
 	CFE_SB_Subscribe(FREQ_10_WAKEUP_MID,appdataApIntf.SchInterface_Pipe);
 	CFE_SB_Subscribe(FREQ_01_WAKEUP_MID,appdataApIntf.SchInterface_Pipe);
 
+	// Subscribe to data available notifications from the port reactor
+	CFE_SB_Subscribe(ICAROUS_APINTF_PORT_WAKEUP_MID,appdataApIntf.SchInterface_Pipe);
+
 	// Subscribe to messages from the software bus
 	//Subscribe to command messages from the SB to command the autopilot
 	CFE_SB_Subscribe(ICAROUS_COMMANDS_MID, appdataApIntf.INTERFACE_Pipe);
@@ -157,6 +168,7 @@ void APINTERFACE_InitializeAPPorts(){
    }else if(appdataApIntf.ap.portType == SERIAL){
 		InitializeSerialPort(&appdataApIntf.ap,false);
    }
+   PortReactor_Register(&appdataApIntf.ap,ICAROUS_APINTF_PORT_WAKEUP_MID);
 }
 
 void APINTERFACE_ProcessAPData() {
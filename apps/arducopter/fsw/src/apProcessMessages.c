@@ -11,18 +11,111 @@
 
 int GetMAVLinkMsgFromAP(void){
     int n = readPort(&appdataInt.ap);
-    mavlink_message_t message;
-    mavlink_status_t status;
-    uint8_t msgReceived = 0;
-    for(int i=0;i<n;i++){
-        uint8_t cp = appdataInt.ap.recvbuffer[i];
-        msgReceived = mavlink_parse_char(MAVLINK_COMM_0, cp, &message, &status);
-        if(msgReceived){
-            // Send SB message if necessary
+    if(n > 0){
+        MavlinkFrame_Parse(&appdataInt.apParser,(uint8_t*)appdataInt.ap.recvbuffer,n,ProcessAPFrame,NULL);
+    }
+    return n;
+}
+
+static void apDecodePosition(const mavlink_global_position_int_t* globalPositionInt,position_t* pos){
+    pos->aircraft_id = CFE_PSP_GetSpacecraftId();
+    memcpy(&pos->callsign,&appdataInt.callsign.value,sizeof(callsign_t));
+    pos->time_boot  = globalPositionInt->time_boot_ms;
+    pos->latitude  = (double)globalPositionInt->lat/1E7;
+    pos->longitude = (double)globalPositionInt->lon/1E7;
+    pos->altitude_abs  = (double)globalPositionInt->alt/1E3;
+    pos->altitude_rel  = (double)globalPositionInt->relative_alt/1E3;
+    pos->vn = (double)globalPositionInt->vx/100;
+    pos->ve = (double)globalPositionInt->vy/100;
+    pos->vd = (double)globalPositionInt->vz/100;
+    pos->hdg = (double)globalPositionInt->hdg/100;
+}
+
+static void apPublishPosition(const mavlinkFrame_t* frame){
+    mavlink_global_position_int_t globalPositionInt;
+    MavlinkFrame_Decode(frame,&globalPositionInt,sizeof(mavlink_global_position_int_t));
+
+    // The last position is kept for waypoint checks and position commands
+    apDecodePosition(&globalPositionInt,&position);
+
+    CFE_SB_ZeroCopyHandle_t cpyhandle;
+    position_t *pos = (position_t *)CFE_SB_ZeroCopyGetPtr(sizeof(position_t),&cpyhandle);
+    if(pos == NULL){
+        SendSBMsg(position);
+        return;
+    }
+
+    // Decode into the software bus buffer. Only the gps fields, which come
+    // from GPS_STATUS, GPS_RAW_INT and SYSTEM_TIME, are carried over
+    CFE_SB_InitMsg(pos,ICAROUS_POSITION_MID,sizeof(position_t),FALSE);
+    apDecodePosition(&globalPositionInt,pos);
+    pos->time_gps = position.time_gps;
+    pos->hdop = position.hdop;
+    pos->vdop = position.vdop;
+    pos->numSats = position.numSats;
+
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *)pos);
+    if(CFE_SB_ZeroCopySend((CFE_SB_Msg_t *)pos,cpyhandle) != CFE_SUCCESS){
+        CFE_SB_ZeroCopyReleasePtr((CFE_SB_Msg_t *)pos,cpyhandle);
+    }
+}
+
+static void apPublishAttitude(const mavlinkFrame_t* frame){
+    mavlink_attitude_t apAttitude;
+    MavlinkFrame_Decode(frame,&apAttitude,sizeof(mavlink_attitude_t));
+
+    // ATTITUDE provides every field of attitude_t, nothing is carried over
+    CFE_SB_ZeroCopyHandle_t cpyhandle;
+    attitude_t *att = (attitude_t *)CFE_SB_ZeroCopyGetPtr(sizeof(attitude_t),&cpyhandle);
+    if(att == NULL){
+        att = &attitude;
+    }else{
+        CFE_SB_InitMsg(att,ICAROUS_ATTITUDE_MID,sizeof(attitude_t),FALSE);
+    }
+    att->pitch = apAttitude.pitch*180/M_PI;
+    att->roll  = apAttitude.roll*180/M_PI;
+    att->yaw = apAttitude.yaw*180/M_PI;
+    att->pitchspeed = apAttitude.pitchspeed*180/M_PI;
+    att->rollspeed = apAttitude.rollspeed*180/M_PI;
+    att->yawspeed = apAttitude.yawspeed*180/M_PI;
+    att->time_boot = apAttitude.time_boot_ms;
+
+    if(att->yaw < 0){
+        att->yaw = 360 + att->yaw;
+    }
+
+    if(att == &attitude){
+        SendSBMsg(attitude);
+        return;
+    }
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *)att);
+    if(CFE_SB_ZeroCopySend((CFE_SB_Msg_t *)att,cpyhandle) != CFE_SUCCESS){
+        CFE_SB_ZeroCopyReleasePtr((CFE_SB_Msg_t *)att,cpyhandle);
+    }
+}
+
+void ProcessAPFrame(const mavlinkFrame_t* frame,void* ctx){
+
+    // Ignore message produced by self
+    if(frame->sysid == sysid_ic && frame->compid == compid_ic){
+        return;
+    }
+
+    // High rate telemetry is decoded without going through a mavlink_message_t
+    switch(frame->msgid){
+        case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+            apPublishPosition(frame);
+            break;
+        case MAVLINK_MSG_ID_ATTITUDE:
+            apPublishAttitude(frame);
+            break;
+        default:{
+            mavlink_message_t message;
+            MavlinkFrame_ToMessage(frame,&message);
             ProcessAPMessage(message);
+            break;
         }
     }
-    return n;
 }
 
 void apSendHeartbeat(void){
@@ -206,26 +299,6 @@ void ProcessAPMessage(mavlink_message_t message) {
         }
 
 
-        case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
-        {
-            mavlink_global_position_int_t globalPositionInt;
-            mavlink_msg_global_position_int_decode(&message,&globalPositionInt);
-            position.aircraft_id = CFE_PSP_GetSpacecraftId();
-            memcpy(&position.callsign,&appdataInt.callsign.value,sizeof(callsign_t));
-            position.time_boot  = globalPositionInt.time_boot_ms;
-            position.latitude  = (double)globalPositionInt.lat/1E7;
-            position.longitude = (double)globalPositionInt.lon/1E7;
-            position.altitude_abs  = (double)globalPositionInt.alt/1E3;
-            position.altitude_rel  = (double)globalPositionInt.relative_alt/1E3;
-            position.vn = (double)globalPositionInt.vx/100;
-            position.ve = (double)globalPositionInt.vy/100;
-            position.vd = (double)globalPositionInt.vz/100;
-            position.hdg = (double)globalPositionInt.hdg/100;
-
-            SendSBMsg(position);
-            break;
-        }
-
         case MAVLINK_MSG_ID_LOCAL_POSITION_NED:
         {
             //OS_printf("apInterface received local position\n");
@@ -243,25 +316,6 @@ void ProcessAPMessage(mavlink_message_t message) {
         }
 
 
-        case MAVLINK_MSG_ID_ATTITUDE:{
-            mavlink_attitude_t apAttitude;
-            mavlink_msg_attitude_decode(&message,&apAttitude);
-            attitude.pitch = apAttitude.pitch*180/M_PI;
-            attitude.roll  = apAttitude.roll*180/M_PI;
-            attitude.yaw = apAttitude.yaw*180/M_PI;
-            attitude.pitchspeed = apAttitude.pitchspeed*180/M_PI;
-            attitude.rollspeed = apAttitude.rollspeed*180/M_PI;
-            attitude.yawspeed = apAttitude.yawspeed*180/M_PI;
-            attitude.time_boot = apAttitude.time_boot_ms;
-
-            if(attitude.yaw < 0){
-                attitude.yaw = 360 + attitude.yaw;
-            }
-
-            SendSBMsg(attitude);
-            break;
-        }
-
         case MAVLINK_MSG_ID_BATTERY_STATUS:{
             mavlink_battery_status_t apBatteryStatus;
             mavlink_msg_battery_status_decode(&message,&apBatteryStatus);
@@ -32,6 +32,10 @@ void ARDUCOPTER_AppMain(void){
             CFE_SB_MsgId_t MsgId;
             MsgId = CFE_SB_GetMsgId(appdataInt.Sch_MsgPtr);
             switch (MsgId) {
+                case ICAROUS_AP_PORT_WAKEUP_MID:
+                    GetMAVLinkMsgFromAP();
+                    break;
+
                 case FREQ_50_WAKEUP_MID:
                     for (int i = 0; i < 10; i++)
                         GetMAVLinkMsgFromAP();
@@ -124,6 +128,9 @@ void ARDUCOPTER_AppInit(void){
     CFE_SB_SubscribeLocal(FREQ_50_WAKEUP_MID,appdataInt.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
     CFE_SB_SubscribeLocal(FREQ_01_WAKEUP_MID,appdataInt.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
 
+    // Subscribe to data available notifications from the port reactor
+    CFE_SB_SubscribeLocal(ICAROUS_AP_PORT_WAKEUP_MID,appdataInt.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
+
 
     //Subscribe to command messages and kinematic band messages from the SB
     CFE_SB_SubscribeLocal(ICAROUS_COMMANDS_MID, appdataInt.Command_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
@@ -212,6 +219,8 @@ void ARDUCOPTER_AppInitializeData(){
     }else if(appdataInt.ap.portType == SERIAL){
         InitializeSerialPort(&appdataInt.ap,false);
     }
+    PortReactor_Register(&appdataInt.ap,ICAROUS_AP_PORT_WAKEUP_MID);
+    MavlinkFrame_Init(&appdataInt.apParser);
 
     appdataInt.waypoint_type = (int*)malloc(sizeof(int)*2);
     appdataInt.startWPUplink = false;
@@ -33,6 +33,7 @@
 #include <sch_msgids.h>
 #include <mavlink/ardupilotmega/mavlink.h>
 #include <port_lib.h>
+#include <mavlink_frame.h>
 
 #define ARDUCOPTER_PIPE_NAME "FLIGHTPLAN"
 #define ARDUCOPTER_PIPE_DEPTH 100
@@ -93,6 +94,7 @@ typedef struct{
     CFE_TBL_Handle_t   INTERFACE_tblHandle; ///< table handle
     ArducopterTable_t  Table;
     port_t ap;                              ///< autopilot port
+    mavlinkFrameParser_t apParser;          ///< frame parser for the autopilot port
     uint8_t runThreads;                     ///< thread active status
     int numWaypoints;                       ///< num total waypoints
     int waypointSeq;                        ///< received position waypoint
@@ -180,6 +182,15 @@ int GetMAVLinkMsgFromAP(void);
  */
 void ProcessAPMessage(mavlink_message_t message);
 
+/**
+ * Process a mavlink frame from arducopter. Position and attitude are decoded
+ * from the frame straight into software bus buffers, other messages are
+ * handed to ProcessAPMessage.
+ * @param frame validated frame
+ * @param ctx unused
+ */
+void ProcessAPFrame(const mavlinkFrame_t* frame,void* ctx);
+
 /**
  * Process SB messages from pipes and take action
  */
@@ -41,6 +41,7 @@ void FLARM_AppMain(void){
 			CFE_SB_MsgId_t MsgId;
 			MsgId = CFE_SB_GetMsgId(flarmAppData.Sch_MsgPtr);
 			switch (MsgId) {
+				case ICAROUS_FLARM_PORT_WAKEUP_MID:
 				case FREQ_10_WAKEUP_MID:
 					FLARM_ProcessData();
 					break;
@@ -88,6 +89,9 @@ void FLARM_AppInit(void){
 	// Subscribe to wakeup messages from scheduler
 	CFE_SB_Subscribe(FREQ_10_WAKEUP_MID,flarmAppData.SchInterface_Pipe);
 
+	// Subscribe to data available notifications from the port reactor
+	CFE_SB_Subscribe(ICAROUS_FLARM_PORT_WAKEUP_MID,flarmAppData.SchInterface_Pipe);
+
 	//Subscribe to command messages and kinematic band messages from the SB
 	CFE_SB_Subscribe(ICAROUS_POSITION_MID,flarmAppData.INTERFACE_Pipe);
 
@@ -149,6 +153,7 @@ void FLARM_InitializePorts(){
 	}else if(flarmAppData.fp.portType == SERIAL){
 		InitializeSerialPort(&flarmAppData.fp,false);
 	}
+	PortReactor_Register(&flarmAppData.fp,ICAROUS_FLARM_PORT_WAKEUP_MID);
 }
 
 void FLARM_ProcessData() {
@@ -34,6 +34,10 @@ void gsInterface_AppMain(void){
       CFE_SB_MsgId_t  MsgId;
       MsgId = CFE_SB_GetMsgId(appdataIntGS.Sch_MsgPtr);
       switch (MsgId){
+        case ICAROUS_GS_PORT_WAKEUP_MID:
+          GetMAVLinkMsgFromGS();
+          break;
+
         case FREQ_50_WAKEUP_MID:
           for(int i=0;i<10;++i)
             GetMAVLinkMsgFromGS();
@@ -129,6 +133,9 @@ void gsInterface_AppInit(void){
   CFE_SB_SubscribeLocal(FREQ_50_WAKEUP_MID,appdataIntGS.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
   CFE_SB_SubscribeLocal(FREQ_01_WAKEUP_MID,appdataIntGS.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
 
+  // Subscribe to data available notifications from the port reactor
+  CFE_SB_SubscribeLocal(ICAROUS_GS_PORT_WAKEUP_MID,appdataIntGS.SchInterface_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
+
   //Subscribe to command messages and kinematic band messages from the SB
   CFE_SB_Subscribe(ICAROUS_POSITION_MID,appdataIntGS.INTERFACE_Pipe);
   CFE_SB_SubscribeLocal(ICAROUS_ATTITUDE_MID,appdataIntGS.INTERFACE_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
@@ -200,6 +207,7 @@ void gsInterface_InitializeAppData(void){
   }else if(appdataIntGS.gs.portType == SERIAL){
     InitializeSerialPort(&appdataIntGS.gs,false);
   }
+  PortReactor_Register(&appdataIntGS.gs,ICAROUS_GS_PORT_WAKEUP_MID);
 
   appdataIntGS.currentIcarousMode = 0;
   appdataIntGS.numGeofences = 0;
@@ -488,9 +488,10 @@ void ProcessGSMessage(mavlink_message_t message) {
                     appdataIntGS.storedparams[i].type,
                     PARAM_COUNT, i);
 
-                writeMavlinkData(&appdataIntGS.gs,&param_value_msg);
+                queueMavlinkData(&appdataIntGS.gs,&param_value_msg);
                 //printf("Sending parameter : %s: %f\n",appdataIntGS.param_ids[i],appdataIntGS.params[i].param_value);
             }
+            flushPort(&appdataIntGS.gs);
 
             break;
         }
@@ -0,0 +1,99 @@
+/**
+ * @file mavlink_frame.h
+ * @brief Frame level MAVLink parser
+ *
+ * Scans a receive buffer for complete MAVLink v1/v2 frames and validates them
+ * in place. Valid frames are handed to a callback that points into the receive
+ * buffer, so payloads can be decoded directly into their destination without
+ * going through a mavlink_message_t.
+ */
+#ifndef _mavlink_frame_h_
+#define _mavlink_frame_h_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "mavlink/ardupilotmega/mavlink.h"
+
+/**
+ * @struct mavlinkFrame_t
+ * @brief View of a validated frame. The payload points into the parser input
+ * and is only valid during the frame callback.
+ */
+typedef struct{
+    uint8_t magic;            ///< MAVLINK_STX (v2) or MAVLINK_STX_MAVLINK1
+    uint8_t len;              ///< payload length on the wire (v2 payloads may be truncated)
+    uint8_t seq;              ///< packet sequence
+    uint8_t sysid;            ///< sender system id
+    uint8_t compid;           ///< sender component id
+    uint8_t incompat_flags;   ///< v2 incompatibility flags
+    uint8_t compat_flags;     ///< v2 compatibility flags
+    uint32_t msgid;           ///< message id
+    const uint8_t* payload;   ///< payload
+    uint16_t checksum;        ///< frame checksum
+    const uint8_t* signature; ///< signature block, NULL if the frame is not signed
+}mavlinkFrame_t;
+
+/**
+ * @struct mavlinkFrameParser_t
+ * @brief Parser state, holds the partial frame at the end of the last buffer
+ */
+typedef struct{
+    uint8_t pending[MAVLINK_MAX_PACKET_LEN]; ///< partial frame carried over from the previous buffer
+    int pendingLen;                          ///< number of bytes in pending
+    uint32_t frames;                         ///< number of valid frames
+    uint32_t crcErrors;                      ///< number of frames with a bad checksum
+    uint32_t unknownMsgs;                    ///< number of frames with an unknown message id
+    uint64_t droppedBytes;                   ///< bytes skipped while looking for a frame start
+}mavlinkFrameParser_t;
+
+/**
+ * Callback invoked for each valid frame
+ * @param frame frame view, only valid during the call
+ * @param ctx user context
+ */
+typedef void (*mavlinkFrameHandler_t)(const mavlinkFrame_t* frame,void* ctx);
+
+/**
+ * Reset parser state and counters
+ * @param parser pointer to parser
+ */
+void MavlinkFrame_Init(mavlinkFrameParser_t* parser);
+
+/**
+ * Parse a buffer of received bytes
+ * @param parser pointer to parser
+ * @param data received bytes
+ * @param len number of received bytes
+ * @param handler callback invoked for every valid frame
+ * @param ctx user context passed to the callback
+ * @return number of valid frames
+ */
+int MavlinkFrame_Parse(mavlinkFrameParser_t* parser,const uint8_t* data,int len,
+                       mavlinkFrameHandler_t handler,void* ctx);
+
+/**
+ * Table driven X.25 checksum (same as crc_accumulate_buffer)
+ * @param crc initial checksum
+ * @param data bytes to accumulate
+ * @param len number of bytes
+ * @return checksum
+ */
+uint16_t MavlinkFrame_Crc(uint16_t crc,const uint8_t* data,size_t len);
+
+/**
+ * Copy the payload of a frame into a mavlink_*_t struct. Truncated
+ * (zero trimmed) v2 payloads are zero filled.
+ * @param frame pointer to frame
+ * @param dst destination struct
+ * @param size size of the destination struct
+ */
+void MavlinkFrame_Decode(const mavlinkFrame_t* frame,void* dst,size_t size);
+
+/**
+ * Convert a frame into a mavlink_message_t for code using the mavlink_msg_*_decode functions
+ * @param frame pointer to frame
+ * @param msg output message
+ */
+void MavlinkFrame_ToMessage(const mavlinkFrame_t* frame,mavlink_message_t* msg);
+
+#endif
@@ -15,10 +15,14 @@
 #include <stdbool.h>
 #include <fcntl.h>   // File control definitions
 #include <termios.h> // POSIX terminal control definitions
+#include <sys/uio.h> // Vectored I/O
 #include "network_includes.h"
 #include "mavlink/ardupilotmega/mavlink.h"
 
 #define BUFFER_LENGTH 1000  ///< Mavlink message receive buffer size
+#define TX_BUFFER_LENGTH 4096  ///< Transmit ring buffer size (serial ports)
+#define PORT_REACTOR_MAX_PORTS 8  ///< Maximum number of ports watched by the port reactor
+#define PORT_LATENCY_BINS 16      ///< Number of log2(us) bins of the wakeup latency histogram
 
 /**
  * @enum PortType_t
@@ -30,6 +34,28 @@ typedef enum {
 } portType_e;
 
 
+/**
+ *\struct portStats_t
+ * @brief Throughput counters of a port
+ */
+typedef struct{
+    uint64_t bytesRead;              ///< total bytes received
+    uint64_t bytesWritten;           ///< total bytes transmitted
+    uint64_t bytesDropped;           ///< bytes discarded because the transmit buffer was full or the send failed
+    uint32_t readCalls;              ///< number of read syscalls
+    uint32_t writeCalls;             ///< number of write syscalls
+    uint32_t latencyHist[PORT_LATENCY_BINS]; ///< data arrival to read latency, bin i counts latencies < 2^i us
+}portStats_t;
+
+/**
+ *\struct portWakeup_t
+ * @brief Message sent by the port reactor when data is available on a port
+ */
+typedef struct{
+    uint8 TlmHeader[CFE_SB_TLM_HDR_SIZE]; ///< cFS header information
+    uint32 portIndex;                      ///< index of the port in the reactor
+}portWakeup_t;
+
 /**
  *\struct port_t
  * @brief Structure to hold port attributes
@@ -46,6 +72,12 @@ typedef struct{
     char target[50];                 ///< target ip address/or name of serial port
     char recvbuffer[BUFFER_LENGTH];  ///< buffer for incoming data
     int baudrate;                    ///< baud rate only if a serial port
+    char txbuffer[TX_BUFFER_LENGTH]; ///< ring buffer for outgoing data (serial ports)
+    int txhead;                      ///< index of the first pending byte in txbuffer
+    int txcount;                     ///< number of pending bytes in txbuffer
+    portStats_t stats;               ///< throughput counters
+    int reactorIndex;                ///< 1 + index of the port in the reactor, 0 if not registered
+    uint64_t readyTime;              ///< time [ns] at which the reactor reported data, 0 if armed
 }port_t;
 
 /**
@@ -74,18 +106,70 @@ int InitializeSerialPort(port_t* prt,bool should_block);
 void writeMavlinkData(port_t* prt,mavlink_message_t *message);
 
 /**
- * Read raw data from port
+ * Queue mavlink message for a given port without flushing it.
+ * Queued data is sent with the next call to flushPort or writeData
+ * @param *prt pointer to output port
+ * @param *message pointer to mavlink message
+ */
+void queueMavlinkData(port_t* prt,mavlink_message_t *message);
+
+/**
+ * Read raw data from port. The received data is null terminated.
  * @param prt pointer to port to read from
+ * @return number of bytes read
  */
 int readPort(port_t *prt);
 
 /**
- * Write raw data to port
+ * Write raw data to port. Pending queued data is flushed first.
  * @param prt  pointer to port to read data from
  * @param sendbuffer pointer to char array contiaining data
  * @param datalength length of data to be used
  */
 void writeData(port_t* prt,char* sendbuffer,int datalength);
 
+/**
+ * Queue raw data in the port transmit buffer without flushing it.
+ * Sockets have no transmit buffer and send the data immediately.
+ * A message that doesn't fit in the transmit buffer, even after flushing it,
+ * is dropped as a whole.
+ * @param prt  pointer to port
+ * @param sendbuffer pointer to char array contiaining data
+ * @param datalength length of data to be used
+ * @return number of bytes queued (or sent), 0 if the message was dropped
+ */
+int queueData(port_t* prt,char* sendbuffer,int datalength);
+
+/**
+ * Write all pending data of the transmit buffer with a single vectored write
+ * @param prt pointer to port
+ * @return number of bytes written
+ */
+int flushPort(port_t* prt);
+
+/**
+ * Watch a port with the port reactor. When data arrives, a wakeup message
+ * (portWakeup_t) with the given message id is published on the software bus.
+ * No further wakeup is sent for this port until the data is read with readPort.
+ * The reactor task is started as a child task of the first app registering a port.
+ * @param prt pointer to an initialized port
+ * @param wakeupMid message id of the wakeup message
+ * @return CFE_SUCCESS if the port is watched
+ */
+int32 PortReactor_Register(port_t* prt,CFE_SB_MsgId_t wakeupMid);
+
+/**
+ * Re-enable reactor wakeups for a port and record the wakeup latency.
+ * Called by readPort.
+ * @param prt pointer to port
+ */
+void PortReactor_Rearm(port_t* prt);
+
+/**
+ * Print throughput counters and wakeup latency histogram of a port
+ * @param prt pointer to port
+ */
+void printPortStats(port_t* prt);
+
 #endif
 
@@ -0,0 +1,246 @@
+/**
+ * @file mavlink_frame.c
+ * @brief Frame level MAVLink parser
+ */
+
+#include "mavlink_frame.h"
+#include <string.h>
+#include <stdbool.h>
+
+#define MAVLINK_FRAME_V1_HEADER_LEN (MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1)
+#define MAVLINK_FRAME_V2_HEADER_LEN (MAVLINK_CORE_HEADER_LEN + 1)
+
+/// X.25 update term of each byte value: crc' = (crc >> 8) ^ crc_table[(crc ^ byte) & 0xff]
+static const uint16_t crc_table[256] = {
+    0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+    0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+    0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+    0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+    0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+    0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+    0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+    0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+    0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+    0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+    0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+    0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+    0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+    0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+    0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+    0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+    0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+    0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+    0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+    0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+    0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+    0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+    0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+    0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+    0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+    0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+    0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+    0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+    0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+    0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+    0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+    0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78
+};
+
+uint16_t MavlinkFrame_Crc(uint16_t crc,const uint8_t* data,size_t len){
+    for(size_t i=0;i<len;++i){
+        crc = (crc >> 8) ^ crc_table[(crc ^ data[i]) & 0xff];
+    }
+    return crc;
+}
+
+void MavlinkFrame_Init(mavlinkFrameParser_t* parser){
+    memset(parser,0,sizeof(mavlinkFrameParser_t));
+}
+
+/**
+ * Total length of the frame starting at buf
+ * @return frame length, 0 if the header is incomplete, -1 if the header is invalid
+ */
+static int MavlinkFrame_Length(const uint8_t* buf,int avail){
+    if(buf[0] == MAVLINK_STX_MAVLINK1){
+        if(avail < MAVLINK_FRAME_V1_HEADER_LEN) return 0;
+        return MAVLINK_FRAME_V1_HEADER_LEN + buf[1] + MAVLINK_NUM_CHECKSUM_BYTES;
+    }
+
+    if(avail < MAVLINK_FRAME_V2_HEADER_LEN) return 0;
+    uint8_t incompat_flags = buf[2];
+    if(incompat_flags & ~MAVLINK_IFLAG_MASK){
+        return -1;
+    }
+    int length = MAVLINK_FRAME_V2_HEADER_LEN + buf[1] + MAVLINK_NUM_CHECKSUM_BYTES;
+    if(incompat_flags & MAVLINK_IFLAG_SIGNED){
+        length += MAVLINK_SIGNATURE_BLOCK_LEN;
+    }
+    return length;
+}
+
+/**
+ * Validate a complete frame in place and fill the frame view
+ * @return true if the checksum matches
+ */
+static bool MavlinkFrame_Validate(mavlinkFrameParser_t* parser,const uint8_t* buf,mavlinkFrame_t* frame){
+    int headerLen;
+    frame->magic = buf[0];
+    frame->len = buf[1];
+    if(frame->magic == MAVLINK_STX_MAVLINK1){
+        headerLen = MAVLINK_FRAME_V1_HEADER_LEN;
+        frame->incompat_flags = 0;
+        frame->compat_flags = 0;
+        frame->seq = buf[2];
+        frame->sysid = buf[3];
+        frame->compid = buf[4];
+        frame->msgid = buf[5];
+    }else{
+        headerLen = MAVLINK_FRAME_V2_HEADER_LEN;
+        frame->incompat_flags = buf[2];
+        frame->compat_flags = buf[3];
+        frame->seq = buf[4];
+        frame->sysid = buf[5];
+        frame->compid = buf[6];
+        frame->msgid = buf[7] | ((uint32_t)buf[8] << 8) | ((uint32_t)buf[9] << 16);
+    }
+
+    const mavlink_msg_entry_t* entry = mavlink_get_msg_entry(frame->msgid);
+    if(entry == NULL){
+        parser->unknownMsgs++;
+        return false;
+    }
+
+    const uint8_t* ck = buf + headerLen + frame->len;
+    uint16_t crc = MavlinkFrame_Crc(X25_INIT_CRC, buf + 1, headerLen - 1 + frame->len);
+    crc = MavlinkFrame_Crc(crc, &entry->crc_extra, 1);
+    frame->checksum = ck[0] | ((uint16_t)ck[1] << 8);
+    if(crc != frame->checksum){
+        parser->crcErrors++;
+        return false;
+    }
+
+    frame->payload = buf + headerLen;
+    frame->signature = (frame->incompat_flags & MAVLINK_IFLAG_SIGNED) ? ck + MAVLINK_NUM_CHECKSUM_BYTES : NULL;
+    return true;
+}
+
+/**
+ * Parse all complete frames of a contiguous buffer
+ * @return number of bytes consumed, the remaining bytes are the start of a partial frame
+ */
+static int MavlinkFrame_Scan(mavlinkFrameParser_t* parser,const uint8_t* buf,int len,
+                             mavlinkFrameHandler_t handler,void* ctx,int* count){
+    int i = 0;
+    mavlinkFrame_t frame;
+    while(i < len){
+        // Skip to the next frame start marker
+        int start = i;
+        while(i < len && buf[i] != MAVLINK_STX && buf[i] != MAVLINK_STX_MAVLINK1){
+            i++;
+        }
+        parser->droppedBytes += i - start;
+        if(i == len){
+            break;
+        }
+
+        int length = MavlinkFrame_Length(buf + i, len - i);
+        if(length == 0 || (length > 0 && length > len - i)){
+            // Incomplete frame
+            break;
+        }
+
+        if(length > 0 && MavlinkFrame_Validate(parser, buf + i, &frame)){
+            parser->frames++;
+            (*count)++;
+            handler(&frame, ctx);
+            i += length;
+        }else{
+            // Not a frame, resynchronize on the next marker
+            parser->droppedBytes++;
+            i++;
+        }
+    }
+    return i;
+}
+
+int MavlinkFrame_Parse(mavlinkFrameParser_t* parser,const uint8_t* data,int len,
+                       mavlinkFrameHandler_t handler,void* ctx){
+    int count = 0;
+    int used = 0;
+
+    // Complete the frame left over from the previous buffer, copying only the bytes it needs
+    while(parser->pendingLen > 0 && used < len){
+        int headerLen = parser->pending[0] == MAVLINK_STX ? MAVLINK_FRAME_V2_HEADER_LEN : MAVLINK_FRAME_V1_HEADER_LEN;
+        int length = MavlinkFrame_Length(parser->pending, parser->pendingLen);
+        int need = (length > 0 ? length : headerLen) - parser->pendingLen;
+        if(length >= 0 && need > 0){
+            int n = need < len - used ? need : len - used;
+            memcpy(parser->pending + parser->pendingLen, data + used, n);
+            parser->pendingLen += n;
+            used += n;
+            length = MavlinkFrame_Length(parser->pending, parser->pendingLen);
+        }
+
+        if(length == 0 || (length > 0 && parser->pendingLen < length)){
+            continue;
+        }
+
+        mavlinkFrame_t frame;
+        if(length > 0 && MavlinkFrame_Validate(parser, parser->pending, &frame)){
+            parser->frames++;
+            count++;
+            handler(&frame, ctx);
+            parser->pendingLen = 0;
+        }else{
+            // Not a frame, rescan the bytes following the marker
+            int rest = parser->pendingLen - 1;
+            parser->droppedBytes++;
+            memmove(parser->pending, parser->pending + 1, rest);
+            parser->pendingLen = 0;
+            int consumed = MavlinkFrame_Scan(parser, parser->pending, rest, handler, ctx, &count);
+            memmove(parser->pending, parser->pending + consumed, rest - consumed);
+            parser->pendingLen = rest - consumed;
+        }
+    }
+
+    if(used < len){
+        int consumed = MavlinkFrame_Scan(parser, data + used, len - used, handler, ctx, &count);
+        parser->pendingLen = len - used - consumed;
+        memcpy(parser->pending, data + used + consumed, parser->pendingLen);
+    }
+
+    return count;
+}
+
+void MavlinkFrame_Decode(const mavlinkFrame_t* frame,void* dst,size_t size){
+    size_t n = frame->len < size ? frame->len : size;
+    memcpy(dst, frame->payload, n);
+    if(n < size){
+        memset((uint8_t*)dst + n, 0, size - n);
+    }
+}
+
+void MavlinkFrame_ToMessage(const mavlinkFrame_t* frame,mavlink_message_t* msg){
+    msg->magic = frame->magic;
+    msg->len = frame->len;
+    msg->incompat_flags = frame->incompat_flags;
+    msg->compat_flags = frame->compat_flags;
+    msg->seq = frame->seq;
+    msg->sysid = frame->sysid;
+    msg->compid = frame->compid;
+    msg->msgid = frame->msgid;
+    msg->checksum = frame->checksum;
+    msg->ck[0] = frame->checksum & 0xff;
+    msg->ck[1] = frame->checksum >> 8;
+    memcpy(_MAV_PAYLOAD_NON_CONST(msg), frame->payload, frame->len);
+
+    // Zero fill truncated payloads as mavlink_parse_char does
+    const mavlink_msg_entry_t* entry = mavlink_get_msg_entry(frame->msgid);
+    if(entry != NULL && frame->len < entry->msg_len){
+        memset(_MAV_PAYLOAD_NON_CONST(msg) + frame->len, 0, entry->msg_len - frame->len);
+    }
+    if(frame->signature != NULL){
+        memcpy(msg->signature, frame->signature, MAVLINK_SIGNATURE_BLOCK_LEN);
+    }
+}
@@ -25,8 +25,19 @@ int32 Port_LibInit(void)
 }
 
 
+static void ResetPortBuffers(port_t* prt){
+    prt->txhead = 0;
+    prt->txcount = 0;
+    prt->recvbuffer[0] = '\0';
+    prt->reactorIndex = 0;
+    prt->readyTime = 0;
+    memset(&prt->stats, 0, sizeof(prt->stats));
+}
+
 void InitializeSocketPort(port_t* prt){
 
+    ResetPortBuffers(prt);
+
     memset(&prt->self_addr, 0, sizeof(prt->self_addr));
     prt->self_addr.sin_family      = AF_INET;
     prt->self_addr.sin_addr.s_addr = htonl(INADDR_ANY);
@@ -54,6 +65,8 @@ void InitializeSocketPort(port_t* prt){
 
 int InitializeSerialPort(port_t* prt,bool should_block){
 
+    ResetPortBuffers(prt);
+
     prt->id = open (prt->target, O_RDWR | O_NOCTTY | O_SYNC);
     if (prt->id < 0)
     {
@@ -122,42 +135,120 @@ int InitializeSerialPort(port_t* prt,bool should_block){
 
 int readPort(port_t* prt){
     int n = 0;
-    memset(prt->recvbuffer, 0, BUFFER_LENGTH);
+    // Leave space for a null terminator instead of clearing the whole buffer
     if (prt->portType == SOCKET){
         if(prt->portout == 0) {
-            n = recvfrom(prt->sockId, (void *) prt->recvbuffer, BUFFER_LENGTH, 0, (struct sockaddr *) &prt->target_addr,
+            n = recvfrom(prt->sockId, (void *) prt->recvbuffer, BUFFER_LENGTH - 1, 0, (struct sockaddr *) &prt->target_addr,
                          &prt->recvlen);
             prt->portout = ntohs(prt->target_addr.sin_port);
         }else{
-            n = recvfrom(prt->sockId, (void *) prt->recvbuffer, BUFFER_LENGTH, 0, NULL, NULL);
+            n = recvfrom(prt->sockId, (void *) prt->recvbuffer, BUFFER_LENGTH - 1, 0, NULL, NULL);
         }
     }else if(prt->portType == SERIAL){
-        n = read (prt->id, prt->recvbuffer, BUFFER_LENGTH);
+        n = read (prt->id, prt->recvbuffer, BUFFER_LENGTH - 1);
     }else{
 
     }
+    prt->stats.readCalls++;
+    if (n > 0){
+        prt->stats.bytesRead += n;
+        prt->recvbuffer[n] = '\0';
+    }else{
+        prt->recvbuffer[0] = '\0';
+    }
+    PortReactor_Rearm(prt);
     return n;
 }
 
-void writeData(port_t* prt,char* sendbuffer,int datalength){
+int flushPort(port_t* prt){
+    if(prt->portType != SERIAL || prt->txcount == 0){
+        return 0;
+    }
+
+    // Pending data wraps around the end of the ring at most once
+    struct iovec iov[2];
+    int iovcnt = 1;
+    int first = TX_BUFFER_LENGTH - prt->txhead;
+    iov[0].iov_base = prt->txbuffer + prt->txhead;
+    if(prt->txcount > first){
+        iov[0].iov_len = first;
+        iov[1].iov_base = prt->txbuffer;
+        iov[1].iov_len = prt->txcount - first;
+        iovcnt = 2;
+    }else{
+        iov[0].iov_len = prt->txcount;
+    }
+
+    ssize_t n = writev(prt->id, iov, iovcnt);
+    prt->stats.writeCalls++;
+    if(n <= 0){
+        return 0;
+    }
+
+    // Keep anything that wasn't written for the next flush
+    prt->stats.bytesWritten += n;
+    prt->txhead = (prt->txhead + n) % TX_BUFFER_LENGTH;
+    prt->txcount -= n;
+    if(prt->txcount == 0){
+        prt->txhead = 0;
+    }
+    return n;
+}
+
+int queueData(port_t* prt,char* sendbuffer,int datalength){
     if(prt->portType == SOCKET){
-        sendto(prt->sockId, sendbuffer, datalength, 0, (struct sockaddr*)&prt->target_addr, sizeof (struct sockaddr_in));
-    }else if(prt->portType == SERIAL){
-        for(int i=0;i<datalength;i++){
-            char c = sendbuffer[i];
-            write(prt->id,&c,1);
+        ssize_t n = sendto(prt->sockId, sendbuffer, datalength, 0, (struct sockaddr*)&prt->target_addr, sizeof (struct sockaddr_in));
+        prt->stats.writeCalls++;
+        if(n < 0){
+            prt->stats.bytesDropped += datalength;
+            return 0;
         }
-    }else{
+        prt->stats.bytesWritten += n;
+        return n;
+    }else if(prt->portType != SERIAL){
         // unimplemented port type
+        return 0;
+    }
+
+    if(prt->txcount + datalength > TX_BUFFER_LENGTH){
+        flushPort(prt);
+    }
+
+    // Never queue part of a message, a truncated frame would desynchronize the receiver
+    if(prt->txcount + datalength > TX_BUFFER_LENGTH){
+        prt->stats.bytesDropped += datalength;
+        return 0;
+    }
+
+    int tail = (prt->txhead + prt->txcount) % TX_BUFFER_LENGTH;
+    int first = TX_BUFFER_LENGTH - tail;
+    if(datalength > first){
+        memcpy(prt->txbuffer + tail, sendbuffer, first);
+        memcpy(prt->txbuffer, sendbuffer + first, datalength - first);
+    }else{
+        memcpy(prt->txbuffer + tail, sendbuffer, datalength);
     }
+    prt->txcount += datalength;
+    return datalength;
+}
+
+void writeData(port_t* prt,char* sendbuffer,int datalength){
+    queueData(prt,sendbuffer,datalength);
+    flushPort(prt);
 }
 
 void writeMavlinkData(port_t *prt,mavlink_message_t* message){
-    char sendbuffer[300];
+    char sendbuffer[MAVLINK_MAX_PACKET_LEN];
     uint16_t datalen = mavlink_msg_to_send_buffer((uint8_t*)sendbuffer, message);
     writeData(prt,sendbuffer,datalen);
 }
 
+void queueMavlinkData(port_t *prt,mavlink_message_t* message){
+    char sendbuffer[MAVLINK_MAX_PACKET_LEN];
+    uint16_t datalen = mavlink_msg_to_send_buffer((uint8_t*)sendbuffer, message);
+    queueData(prt,sendbuffer,datalen);
+}
+
 /************************/
 /*  End of File Comment */
 /************************/
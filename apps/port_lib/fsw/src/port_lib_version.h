@@ -14,7 +14,7 @@
 
 
 #define PORT_LIB_MAJOR_VERSION    1
-#define PORT_LIB_MINOR_VERSION    0
+#define PORT_LIB_MINOR_VERSION    3
 #define PORT_LIB_REVISION         0
 #define PORT_LIB_MISSION_REV      0
 
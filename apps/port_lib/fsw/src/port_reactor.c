@@ -0,0 +1,172 @@
+/**
+ * @file port_reactor.c
+ * @brief epoll based reactor that wakes apps as soon as data arrives on their ports
+ */
+
+#include "port_lib.h"
+#include <sys/epoll.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#define PORT_REACTOR_TASK_NAME "PORT_REACTOR"
+#define PORT_REACTOR_STACK_SIZE 16384
+#define PORT_REACTOR_PRIORITY 50
+#define PORT_REACTOR_TIMEOUT_MS 100
+
+/**
+ * @struct portReactor_t
+ * @brief Reactor state shared by all apps using port_lib
+ */
+typedef struct{
+    int epfd;                                      ///< epoll instance
+    uint32 taskId;                                 ///< reactor child task id
+    int numPorts;                                  ///< number of registered ports
+    port_t* ports[PORT_REACTOR_MAX_PORTS];         ///< registered ports
+    portWakeup_t wakeup[PORT_REACTOR_MAX_PORTS];   ///< wakeup message of each port
+    pthread_mutex_t lock;                          ///< protects registration
+}portReactor_t;
+
+static portReactor_t reactor = {
+    .epfd = -1,
+    .numPorts = 0,
+    .lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+static uint64_t PortReactor_Now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+static int PortReactor_Fd(port_t* prt){
+    return prt->portType == SOCKET ? prt->sockId : prt->id;
+}
+
+static void PortReactor_Task(void){
+    CFE_ES_RegisterChildTask();
+
+    struct epoll_event events[PORT_REACTOR_MAX_PORTS];
+    while(1){
+        int n = epoll_wait(reactor.epfd, events, PORT_REACTOR_MAX_PORTS, PORT_REACTOR_TIMEOUT_MS);
+        if(n < 0 && errno != EINTR){
+            OS_printf("Port reactor: epoll_wait failed (%d)\n", errno);
+            break;
+        }
+
+        for(int i=0;i<n;++i){
+            uint32_t index = events[i].data.u32;
+            port_t* prt = reactor.ports[index];
+
+            // The port stays disarmed (EPOLLONESHOT) until the owner reads it
+            __atomic_store_n(&prt->readyTime, PortReactor_Now(), __ATOMIC_RELEASE);
+            CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &reactor.wakeup[index]);
+            CFE_SB_SendMsg((CFE_SB_Msg_t *) &reactor.wakeup[index]);
+        }
+    }
+
+    CFE_ES_ExitChildTask();
+}
+
+int32 PortReactor_Register(port_t* prt,CFE_SB_MsgId_t wakeupMid){
+    int32 status = CFE_SUCCESS;
+    pthread_mutex_lock(&reactor.lock);
+
+    if(reactor.numPorts >= PORT_REACTOR_MAX_PORTS){
+        OS_printf("Port reactor: too many ports\n");
+        pthread_mutex_unlock(&reactor.lock);
+        return -1;
+    }
+
+    // The reactor runs as a child task of the first app registering a port
+    if(reactor.epfd < 0){
+        reactor.epfd = epoll_create1(0);
+        if(reactor.epfd < 0){
+            OS_printf("Port reactor: couldn't create epoll instance\n");
+            pthread_mutex_unlock(&reactor.lock);
+            return -1;
+        }
+
+        status = CFE_ES_CreateChildTask(&reactor.taskId, PORT_REACTOR_TASK_NAME,
+                                        PortReactor_Task, NULL, PORT_REACTOR_STACK_SIZE,
+                                        PORT_REACTOR_PRIORITY, 0);
+        if(status != CFE_SUCCESS){
+            OS_printf("Port reactor: couldn't create reactor task\n");
+            close(reactor.epfd);
+            reactor.epfd = -1;
+            pthread_mutex_unlock(&reactor.lock);
+            return status;
+        }
+    }
+
+    int index = reactor.numPorts;
+    CFE_SB_InitMsg(&reactor.wakeup[index], wakeupMid, sizeof(portWakeup_t), TRUE);
+    reactor.wakeup[index].portIndex = index;
+    reactor.ports[index] = prt;
+    prt->reactorIndex = index + 1;
+    prt->readyTime = 0;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.u32 = index;
+    if(epoll_ctl(reactor.epfd, EPOLL_CTL_ADD, PortReactor_Fd(prt), &ev) < 0){
+        OS_printf("Port reactor: couldn't watch port %s\n", prt->target);
+        prt->reactorIndex = 0;
+        pthread_mutex_unlock(&reactor.lock);
+        return -1;
+    }
+
+    reactor.numPorts++;
+    pthread_mutex_unlock(&reactor.lock);
+    return status;
+}
+
+void PortReactor_Rearm(port_t* prt){
+    if(prt->reactorIndex == 0){
+        return;
+    }
+
+    uint64_t readyTime = __atomic_exchange_n(&prt->readyTime, 0, __ATOMIC_ACQ_REL);
+    if(readyTime == 0){
+        // Port is still armed
+        return;
+    }
+
+    // Record the time between data arrival and the owner reading it
+    uint64_t latency = (PortReactor_Now() - readyTime)/1000;
+    int bin = 0;
+    while(latency > 0 && bin < PORT_LATENCY_BINS - 1){
+        latency >>= 1;
+        bin++;
+    }
+    prt->stats.latencyHist[bin]++;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.u32 = prt->reactorIndex - 1;
+    epoll_ctl(reactor.epfd, EPOLL_CTL_MOD, PortReactor_Fd(prt), &ev);
+}
+
+void printPortStats(port_t* prt){
+    OS_printf("Port %s: read %llu bytes (%u calls), wrote %llu bytes (%u calls), dropped %llu bytes\n",
+              prt->target,
+              (unsigned long long)prt->stats.bytesRead, prt->stats.readCalls,
+              (unsigned long long)prt->stats.bytesWritten, prt->stats.writeCalls,
+              (unsigned long long)prt->stats.bytesDropped);
+    if(prt->reactorIndex == 0){
+        return;
+    }
+    OS_printf("Wakeup to read latency histogram [us]:\n");
+    for(int i=0;i<PORT_LATENCY_BINS;++i){
+        if(prt->stats.latencyHist[i] == 0){
+            continue;
+        }
+        if(i == PORT_LATENCY_BINS - 1){
+            OS_printf(" >= %6u: %u\n", 1u << (i - 1), prt->stats.latencyHist[i]);
+        }else{
+            OS_printf("  < %6u: %u\n", 1u << i, prt->stats.latencyHist[i]);
+        }
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * @file mavlink_frame_bench.c
+ * @brief Throughput of the frame level MAVLink parser against mavlink_parse_char
+ *
+ * Built as the mavlink_frame_bench target when ENABLE_UNIT_TESTS is set, or by hand (host):
+ *   gcc -std=c11 -D_XOPEN_SOURCE=600 -O2 -I../public_inc ../src/mavlink_frame.c mavlink_frame_bench.c -o mavlink_frame_bench
+ *
+ * Usage:
+ *   ./mavlink_frame_bench [telemetry.tlog|raw stream] [chunk size]
+ *
+ * A .tlog file (8 byte timestamp followed by a frame) or a raw stream of frames
+ * recorded from the autopilot port is replayed in chunks of the given size
+ * (default 1000 bytes, the port receive buffer size). Without input file,
+ * synthetic autopilot telemetry is generated.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mavlink_frame.h"
+
+#define BENCH_REPEAT 20
+
+typedef struct{
+    uint64_t frames;
+    uint64_t checksum;
+}benchResult_t;
+
+static double Now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static uint8_t* ReadFile(const char* filename,size_t* size){
+    FILE* fp = fopen(filename, "rb");
+    if(fp == NULL){
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t* data = malloc(*size);
+    if(fread(data, 1, *size, fp) != *size){
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    return data;
+}
+
+/**
+ * Strip the 8 byte timestamps of a .tlog file
+ */
+static size_t StripTlog(uint8_t* data,size_t size){
+    size_t in = 0, out = 0;
+    mavlinkFrameParser_t parser;
+    MavlinkFrame_Init(&parser);
+    while(in + 8 < size){
+        const uint8_t* frame = data + in + 8;
+        size_t length;
+        if(frame[0] == MAVLINK_STX_MAVLINK1){
+            length = frame[1] + MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 + MAVLINK_NUM_CHECKSUM_BYTES;
+        }else if(frame[0] == MAVLINK_STX){
+            length = frame[1] + MAVLINK_NUM_NON_PAYLOAD_BYTES +
+                     ((frame[2] & MAVLINK_IFLAG_SIGNED) ? MAVLINK_SIGNATURE_BLOCK_LEN : 0);
+        }else{
+            break;
+        }
+        if(in + 8 + length > size){
+            break;
+        }
+        memmove(data + out, frame, length);
+        out += length;
+        in += 8 + length;
+    }
+    return out;
+}
+
+/**
+ * Generate telemetry similar to what an ArduPilot autopilot streams
+ */
+static uint8_t* GenerateTelemetry(size_t nframes,size_t* size){
+    uint8_t* data = malloc(nframes*MAVLINK_MAX_PACKET_LEN);
+    size_t offset = 0;
+    mavlink_message_t msg;
+    for(size_t i=0;i<nframes;++i){
+        uint32_t t = i*10;
+        switch(i % 6){
+            case 0:
+                mavlink_msg_global_position_int_pack(1, 1, &msg, t, 373000000 + i, -764000000 - i, 10000, 5000, 100, -50, 3, 9000);
+                break;
+            case 1:
+                mavlink_msg_attitude_pack(1, 1, &msg, t, 0.01f, -0.02f, 1.5f, 0.0f, 0.0f, 0.1f);
+                break;
+            case 2:
+                mavlink_msg_heartbeat_pack(1, 1, &msg, MAV_TYPE_QUADROTOR, MAV_AUTOPILOT_ARDUPILOTMEGA, 0, 4, MAV_STATE_ACTIVE);
+                break;
+            case 3:
+                mavlink_msg_vfr_hud_pack(1, 1, &msg, 5.0f, 5.1f, 90, 50, 10.0f, 0.1f);
+                break;
+            case 4:
+                mavlink_msg_gps_raw_int_pack(1, 1, &msg, t*1000ULL, 3, 373000000, -764000000, 10000, 80, 120, 500, 9000, 12, 0, 0, 0, 0, 0);
+                break;
+            default:
+                mavlink_msg_mission_current_pack(1, 1, &msg, i % 10);
+                break;
+        }
+        offset += mavlink_msg_to_send_buffer(data + offset, &msg);
+    }
+    *size = offset;
+    return data;
+}
+
+static void CountFrame(const mavlinkFrame_t* frame,void* ctx){
+    benchResult_t* result = (benchResult_t*)ctx;
+    result->frames++;
+    result->checksum += frame->msgid ^ frame->seq ^ frame->checksum;
+}
+
+static benchResult_t RunFrameParser(const uint8_t* data,size_t size,size_t chunk){
+    benchResult_t result = {0, 0};
+    mavlinkFrameParser_t parser;
+    MavlinkFrame_Init(&parser);
+    for(size_t i=0;i<size;i+=chunk){
+        size_t n = size - i < chunk ? size - i : chunk;
+        MavlinkFrame_Parse(&parser, data + i, n, CountFrame, &result);
+    }
+    return result;
+}
+
+static benchResult_t RunParseChar(const uint8_t* data,size_t size){
+    benchResult_t result = {0, 0};
+    mavlink_message_t msg;
+    mavlink_status_t status;
+    memset(mavlink_get_channel_status(MAVLINK_COMM_0), 0, sizeof(mavlink_status_t));
+    for(size_t i=0;i<size;++i){
+        if(mavlink_parse_char(MAVLINK_COMM_0, data[i], &msg, &status)){
+            result.frames++;
+            result.checksum += msg.msgid ^ msg.seq ^ msg.checksum;
+        }
+    }
+    return result;
+}
+
+int main(int argc,char** argv){
+    size_t size = 0;
+    uint8_t* data;
+    size_t chunk = argc > 2 ? strtoul(argv[2], NULL, 10) : 1000;
+
+    if(argc > 1){
+        data = ReadFile(argv[1], &size);
+        if(data == NULL){
+            printf("Couldn't read %s\n", argv[1]);
+            return 1;
+        }
+        const char* ext = strrchr(argv[1], '.');
+        if(ext != NULL && strcmp(ext, ".tlog") == 0){
+            size = StripTlog(data, size);
+        }
+    }else{
+        data = GenerateTelemetry(200000, &size);
+    }
+
+    benchResult_t ref = RunParseChar(data, size);
+    benchResult_t res = RunFrameParser(data, size, chunk);
+    // On corrupted recordings the frame parser resynchronizes right after a bad
+    // marker and may recover frames mavlink_parse_char skips
+    if(res.frames < ref.frames || (res.frames == ref.frames && ref.checksum != res.checksum)){
+        printf("Mismatch: mavlink_parse_char %llu frames, frame parser %llu frames\n",
+               (unsigned long long)ref.frames, (unsigned long long)res.frames);
+        free(data);
+        return 1;
+    }else if(res.frames > ref.frames){
+        printf("Frame parser recovered %llu frames dropped by mavlink_parse_char\n",
+               (unsigned long long)(res.frames - ref.frames));
+    }
+
+    double t0 = Now();
+    for(int i=0;i<BENCH_REPEAT;++i){
+        RunParseChar(data, size);
+    }
+    double tParseChar = (Now() - t0)/BENCH_REPEAT;
+
+    t0 = Now();
+    for(int i=0;i<BENCH_REPEAT;++i){
+        RunFrameParser(data, size, chunk);
+    }
+    double tFrame = (Now() - t0)/BENCH_REPEAT;
+
+    printf("%zu bytes, %llu frames, %zu byte chunks\n", size, (unsigned long long)res.frames, chunk);
+    printf("mavlink_parse_char: %8.1f MB/s %10.0f frames/s\n", size/tParseChar/1e6, res.frames/tParseChar);
+    printf("MavlinkFrame_Parse: %8.1f MB/s %10.0f frames/s\n", size/tFrame/1e6, res.frames/tFrame);
+    printf("speedup: %.1fx\n", tParseChar/tFrame);
+
+    free(data);
+    return 0;
+}
@@ -58,6 +58,7 @@ void TRAFFIC_AppInit(void) {
     //Subscribe to plexil output messages from the SB
     CFE_SB_Subscribe(ICAROUS_POSITION_MID,trafficAppData.Traffic_Pipe);
     CFE_SB_SubscribeLocal(ICAROUS_TRAFFIC_MID,trafficAppData.Traffic_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
+    CFE_SB_SubscribeLocal(ICAROUS_TRAFFIC_BATCH_MID,trafficAppData.Traffic_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
     CFE_SB_SubscribeLocal(FREQ_10_WAKEUP_MID,trafficAppData.Traffic_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
     CFE_SB_SubscribeLocal(ICAROUS_PARAMUPDATE_MID,trafficAppData.Traffic_Pipe,CFE_SB_DEFAULT_MSG_LIMIT);
 
@@ -124,12 +125,24 @@ void TRAFFIC_ProcessPacket(void){
             }
 
             double pos[3] = {msg->latitude,msg->longitude,msg->altitude};
-            double trkGsVs[3] = {0,0,0};
-            double sumPos[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
-            double sumVel[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
-            ConvertVnedToTrkGsVs(msg->vn,msg->ve,msg->vd,trkGsVs,trkGsVs+1,trkGsVs+2);
-            int val = TrafficMonitor_InputIntruderData(trafficAppData.tfMonitor,msg->type,msg->index,(char*)msg->callsign.value,pos,trkGsVs,trafficAppData.time,sumPos,sumVel);
-            trafficAppData.numTraffic = val;
+            TRAFFIC_QueueIntruder(msg->type,msg->index,(char*)msg->callsign.value,pos,msg->vn,msg->ve,msg->vd);
+            break;
+        }
+
+        case ICAROUS_TRAFFIC_BATCH_MID:{
+            object_batch_t* msg;
+            msg = (object_batch_t*) trafficAppData.Traffic_MsgPtr;
+
+            int n = msg->numObjects < MAX_TRAFFIC_BATCH ? msg->numObjects : MAX_TRAFFIC_BATCH;
+            for(int i=0;i<n;++i){
+                object_state_t* obj = &msg->objects[i];
+                if (trafficAppData.trafficSrc != 0 && obj->type != trafficAppData.trafficSrc)
+                {
+                    continue;
+                }
+                double pos[3] = {obj->latitude,obj->longitude,obj->altitude};
+                TRAFFIC_QueueIntruder(obj->type,obj->index,(char*)obj->callsign.value,pos,obj->vn,obj->ve,obj->vd);
+            }
             break;
         }
 
@@ -140,12 +153,7 @@ void TRAFFIC_ProcessPacket(void){
             if (msg->aircraft_id != CFE_PSP_GetSpacecraftId()) {
 
                 double pos[3] = {msg->latitude,msg->longitude,msg->altitude_abs};
-                double trkGsVs[3] = {0,0,0};
-                ConvertVnedToTrkGsVs(msg->vn,msg->ve,msg->vd,trkGsVs,trkGsVs+1,trkGsVs+2);
-                double sumPos[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
-                double sumVel[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
-                int val = TrafficMonitor_InputIntruderData(trafficAppData.tfMonitor,0,msg->aircraft_id,(char*)msg->callsign.value,pos,trkGsVs,trafficAppData.time,sumPos,sumVel);
-                trafficAppData.numTraffic = val;
+                TRAFFIC_QueueIntruder(0,msg->aircraft_id,(char*)msg->callsign.value,pos,msg->vn,msg->ve,msg->vd);
             }else{
 
                 trafficAppData.position[0] = msg->latitude;
@@ -167,6 +175,8 @@ void TRAFFIC_ProcessPacket(void){
 
         case FREQ_10_WAKEUP_MID:{
 
+            TRAFFIC_FlushIntruders();
+
             if(trafficAppData.numTraffic == 0)
                 break;
             
@@ -256,6 +266,63 @@ void TRAFFIC_ProcessPacket(void){
     }
 }
 
+uint32_t TRAFFIC_HashCallsign(const char* callsign){
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for(int i=0;i<MAX_CALLSIGN_LEN-1 && callsign[i] != '\0';++i){
+        hash = (hash ^ (uint8_t)callsign[i])*16777619u;
+    }
+    return hash;
+}
+
+void TRAFFIC_QueueIntruder(int source,uint32_t index,const char* callsign,const double position[3],double vn,double ve,double vd){
+
+    trafficAppData.reportsReceived++;
+
+    // Coalesce with a pending report of the same intruder
+    uint32_t slot = TRAFFIC_HashCallsign(callsign) & (TRAFFIC_PENDING_HASH_SIZE - 1);
+    trafficUpdate_t* update = NULL;
+    while(trafficAppData.pendingHash[slot] != 0){
+        trafficUpdate_t* pending = &trafficAppData.pending[trafficAppData.pendingHash[slot] - 1];
+        if(strncmp(pending->callsign,callsign,MAX_CALLSIGN_LEN) == 0){
+            update = pending;
+            trafficAppData.reportsCoalesced++;
+            break;
+        }
+        slot = (slot + 1) & (TRAFFIC_PENDING_HASH_SIZE - 1);
+    }
+
+    if(update == NULL){
+        if(trafficAppData.numPending == TRAFFIC_MAX_PENDING){
+            TRAFFIC_FlushIntruders();
+            slot = TRAFFIC_HashCallsign(callsign) & (TRAFFIC_PENDING_HASH_SIZE - 1);
+        }
+        update = &trafficAppData.pending[trafficAppData.numPending++];
+        trafficAppData.pendingHash[slot] = (int16_t)trafficAppData.numPending;
+        strncpy(update->callsign,callsign,MAX_CALLSIGN_LEN);
+        update->callsign[MAX_CALLSIGN_LEN-1] = '\0';
+    }
+
+    update->source = source;
+    update->index = index;
+    memcpy(update->position,position,sizeof(double)*3);
+    ConvertVnedToTrkGsVs(vn,ve,vd,update->velocity,update->velocity+1,update->velocity+2);
+    update->time = trafficAppData.time;
+}
+
+void TRAFFIC_FlushIntruders(void){
+    double sumPos[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+    double sumVel[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+    for(int i=0;i<trafficAppData.numPending;++i){
+        trafficUpdate_t* update = &trafficAppData.pending[i];
+        int val = TrafficMonitor_InputIntruderData(trafficAppData.tfMonitor,update->source,update->index,update->callsign,
+                                                   update->position,update->velocity,update->time,sumPos,sumVel);
+        trafficAppData.numTraffic = val;
+    }
+    trafficAppData.numPending = 0;
+    memset(trafficAppData.pendingHash,0,sizeof(trafficAppData.pendingHash));
+}
+
 int32_t TrafficTableValidationFunc(void *TblPtr){
     return 0;
 }
@@ -32,7 +32,10 @@
 #define TRAFFIC_PIPE_DEPTH 100
 #define TRAFFIC_PIPE_NAME "TRAFFIC_PIPE"
 #define TRAFFIC_MAJOR_VERSION 1
-#define TRAFFIC_MINOR_VERSION 0
+#define TRAFFIC_MINOR_VERSION 1
+
+#define TRAFFIC_MAX_PENDING 64  ///< Maximum number of distinct intruders buffered between monitor cycles
+#define TRAFFIC_PENDING_HASH_SIZE 128  ///< Size of the callsign lookup table of pending updates (power of two > TRAFFIC_MAX_PENDING)
 
 /**
  * @defgroup TRAFFIC_cFS_APP
@@ -50,6 +53,19 @@
  */
 
 
+/**
+ * @struct trafficUpdate_t
+ * @brief Latest intruder state received since the last monitor cycle
+ */
+typedef struct{
+    int source;                            ///< Traffic source (see object_type_t)
+    uint32_t index;                        ///< Intruder id
+    char callsign[MAX_CALLSIGN_LEN];       ///< Intruder call sign
+    double position[3];                    ///< Position as lat (deg), lon (deg) and alt (m)
+    double velocity[3];                    ///< Velocity as track (deg), ground speed (m/s) and vertical speed (m/s)
+    double time;                           ///< Ownship time at which the report was received
+}trafficUpdate_t;
+
 /**
  * @struct TrajectoryAppData_t
  * @brief Structure to hold app data
@@ -77,6 +93,11 @@ typedef struct{
     uint32_t trafficSrc;                   ///< Traffic source selector
     bool updateDaaParams;                  ///< Update DAA params via SB messages
     traffic_parameters_t params;           ///< DAIDALUS parameters
+    trafficUpdate_t pending[TRAFFIC_MAX_PENDING]; ///< Intruder updates waiting for the next monitor cycle
+    int numPending;                        ///< Number of pending intruder updates
+    int16_t pendingHash[TRAFFIC_PENDING_HASH_SIZE]; ///< Open addressing callsign table, 1 + index in pending or 0 if free
+    uint32_t reportsReceived;              ///< Total number of intruder reports received
+    uint32_t reportsCoalesced;             ///< Reports superseded by a newer report before a monitor cycle
 }TrafficAppData_t;
 
 /**
@@ -99,6 +120,29 @@ void TRAFFIC_AppCleanUp(void);
  */
 void TRAFFIC_ProcessPacket(void);
 
+/**
+ * Buffer an intruder report until the next monitor cycle. A newer report for
+ * the same callsign replaces the pending one.
+ * @param source traffic source (see object_type_t)
+ * @param index intruder id
+ * @param callsign intruder call sign
+ * @param position lat (deg), lon (deg), alt (m)
+ * @param vn,ve,vd velocity North/East/Down (m/s)
+ */
+void TRAFFIC_QueueIntruder(int source,uint32_t index,const char* callsign,const double position[3],double vn,double ve,double vd);
+
+/**
+ * Hash of a call sign, used to find pending intruder updates
+ * @param callsign intruder call sign
+ * @return hash value
+ */
+uint32_t TRAFFIC_HashCallsign(const char* callsign);
+
+/**
+ * Input all pending intruder updates to the traffic monitor
+ */
+void TRAFFIC_FlushIntruders(void);
+
 /**
  * Validates table parameters
  * @param TblPtr Pointer to table